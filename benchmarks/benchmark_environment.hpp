@@ -0,0 +1,25 @@
+#ifndef RENDERBOI__BENCHMARKS__BENCHMARK_ENVIRONMENT_HPP
+#define RENDERBOI__BENCHMARKS__BENCHMARK_ENVIRONMENT_HPP
+
+#include <benchmark/benchmark.h>
+
+namespace Renderboi::Benchmarks
+{
+
+/// @brief Whether a GL context is current on the thread running the
+/// benchmarks. Set up by main() before any benchmark runs.
+extern bool GLContextAvailable;
+
+/// @brief Skip a benchmark which needs a GL context if there is none.
+///
+/// @param state State of the benchmark.
+///
+/// @return Whether a GL context is available.
+bool RequireGLContext(benchmark::State& state);
+
+}//namespace Renderboi::Benchmarks
+
+/// @brief Range of object counts of synthetic scenes: 1K, 32K, 1M.
+#define RB_BENCHMARK_OBJECT_COUNTS RangeMultiplier(32)->Range(1 << 10, 1 << 20)
+
+#endif//RENDERBOI__BENCHMARKS__BENCHMARK_ENVIRONMENT_HPP
@@ -0,0 +1,157 @@
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <glad/gl.h>
+#include <glm/glm.hpp>
+
+#include <renderboi/core/camera.hpp>
+#include <renderboi/core/frame_of_reference.hpp>
+#include <renderboi/core/gl_resource_registry.hpp>
+#include <renderboi/core/material_registry.hpp>
+#include <renderboi/core/mesh.hpp>
+#include <renderboi/core/render_stats.hpp>
+#include <renderboi/core/shader/shader_builder.hpp>
+#include <renderboi/core/shader/shader_program_registry.hpp>
+#include <renderboi/core/transform.hpp>
+
+#include <renderboi/toolbox/factory.hpp>
+#include <renderboi/toolbox/mesh_generators/mesh_type.hpp>
+#include <renderboi/toolbox/scene/scene.hpp>
+#include <renderboi/toolbox/scene/scene_object.hpp>
+#include <renderboi/toolbox/scene/scene_renderer.hpp>
+#include <renderboi/toolbox/scene/components/camera_component.hpp>
+#include <renderboi/toolbox/scene/components/mesh_component.hpp>
+
+#include "benchmark_environment.hpp"
+
+namespace Renderboi::Benchmarks
+{
+
+void MeshGeneratorTorus(benchmark::State& state)
+{
+    if (!RequireGLContext(state)) return;
+
+    const unsigned int resolution = (unsigned int)state.range(0);
+    const bool optimize = state.range(1) != 0;
+
+    for (auto _ : state)
+    {
+        MeshPtr mesh = Factory::MakeMesh<MeshType::Torus>({1.f, 0.25f, resolution, resolution / 2}, optimize);
+        benchmark::DoNotOptimize(mesh);
+
+        state.PauseTiming();
+        mesh.reset();
+        GLResourceRegistry::ProcessPendingDeletions();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * resolution * (resolution / 2));
+}
+BENCHMARK(MeshGeneratorTorus)->ArgsProduct({{32, 128, 512}, {0, 1}})->Unit(benchmark::kMicrosecond);
+
+void MeshGeneratorPlane(benchmark::State& state)
+{
+    if (!RequireGLContext(state)) return;
+
+    const unsigned int tileCount = (unsigned int)state.range(0);
+
+    for (auto _ : state)
+    {
+        MeshPtr mesh = Factory::MakeMesh<MeshType::Plane>({
+            1.f,            // tileSizeX
+            1.f,            // tileSizeY
+            tileCount,      // tileAmountX
+            tileCount,      // tileAmountY
+            1.f,            // xTexSize
+            1.f,            // yTexSize
+            0.f,            // xTexCoordOffset
+            0.f,            // yTexCoordOffset
+            false,          // invertXTexCoords
+            false,          // invertYTexCoords
+            0.f,            // texRotation
+            {1.f, 1.f, 1.f} // color
+        });
+        benchmark::DoNotOptimize(mesh);
+
+        state.PauseTiming();
+        mesh.reset();
+        GLResourceRegistry::ProcessPendingDeletions();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * tileCount * tileCount);
+}
+BENCHMARK(MeshGeneratorPlane)->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMicrosecond);
+
+void MeshGeneratorCube(benchmark::State& state)
+{
+    if (!RequireGLContext(state)) return;
+
+    for (auto _ : state)
+    {
+        MeshPtr mesh = Factory::MakeMesh<MeshType::Cube>({1.f, {1.f, 1.f, 1.f}, false});
+        benchmark::DoNotOptimize(mesh);
+
+        state.PauseTiming();
+        mesh.reset();
+        GLResourceRegistry::ProcessPendingDeletions();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(MeshGeneratorCube)->Unit(benchmark::kMicrosecond);
+
+void SceneRendererRenderScene(benchmark::State& state)
+{
+    if (!RequireGLContext(state)) return;
+
+    using Ref = FrameOfReference;
+
+    const unsigned int count = (unsigned int)state.range(0);
+    const unsigned int side = (unsigned int)std::ceil(std::sqrt((float)count));
+
+    // All objects share a mesh, material and shader, laid out on a grid
+    // facing the camera
+    ScenePtr scene = Factory::MakeScene();
+    const MeshPtr mesh = Factory::MakeMesh<MeshType::Torus>({0.4f, 0.1f, 24, 12});
+    const MaterialHandle material = MaterialRegistry::GetDefault();
+    const ShaderProgramHandle shader = ShaderProgramRegistry::Register(ShaderBuilder::MinimalShaderProgram());
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        SceneObjectPtr object = scene->newObject();
+        object->addComponent<MeshComponent>(mesh, material, shader);
+        object->transform.setPosition<Ref::World>({(float)(i % side) - side / 2.f, (float)(i / side) - side / 2.f, 0.f});
+    }
+
+    SceneObjectPtr cameraObj = scene->newObject("Camera");
+    cameraObj->addComponent<CameraComponent>(std::make_shared<Camera>());
+    cameraObj->transform.setPosition<Ref::World>({0.f, 0.f, (float)side});
+    cameraObj->transform.rotateBy<Ref::Parent>(glm::radians(180.f), Transform::Y);
+
+    SceneRenderer renderer;
+    RenderStats::Reset();
+
+    for (auto _ : state)
+    {
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        renderer.renderScene(scene);
+        glFinish();
+        RenderStats::EndFrame();
+    }
+
+    const RenderStats::Frame lastFrame = RenderStats::GetLastFrame();
+    state.counters["DrawCalls"] = (double)lastFrame.counters[(std::size_t)RenderCounter::DrawCalls];
+    state.counters["CulledObjects"] = (double)lastFrame.counters[(std::size_t)RenderCounter::CulledObjects];
+    state.SetItemsProcessed(state.iterations() * count);
+
+    Factory::DestroyScene(scene);
+    GLResourceRegistry::ProcessPendingDeletions();
+}
+BENCHMARK(SceneRendererRenderScene)->RangeMultiplier(8)->Range(64, 1 << 15)->Unit(benchmark::kMillisecond);
+
+}//namespace Renderboi::Benchmarks
@@ -0,0 +1,114 @@
+#include <filesystem>
+#include <iostream>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include <renderboi/core/gl_resource_registry.hpp>
+
+#include <renderboi/window/enums.hpp>
+#include <renderboi/window/gl_context_client.hpp>
+#include <renderboi/window/window_factory.hpp>
+#include <renderboi/window/window_backend.hpp>
+
+#include <renderboi/utilities/resource_locator.hpp>
+
+#include "project_env.hpp"
+#include "benchmark_environment.hpp"
+
+namespace Renderboi::Benchmarks
+{
+
+bool GLContextAvailable = false;
+
+bool RequireGLContext(benchmark::State& state)
+{
+    if (!GLContextAvailable)
+    {
+        state.SkipWithError("No GL context available");
+    }
+
+    return GLContextAvailable;
+}
+
+}//namespace Renderboi::Benchmarks
+
+// Run all benchmarks, those which need a GL context running in a hidden
+// window (or a headless context with the EGL backend). Results are best
+// written as JSON with --benchmark_out=<file> --benchmark_out_format=json,
+// which the run_benchmarks target does.
+int main(int argc, char** argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return EXIT_FAILURE;
+
+    const std::filesystem::path assetsDir = RENDERBOI_ASSETS_DIR;
+
+    using ReLoc = rb::ResourceLocator;
+    using ReType = rb::ResourceType;
+    ReLoc::setPrefixFor(ReType::ShaderSource, assetsDir / "shaders/");
+    ReLoc::setPrefixFor(ReType::Texture,      assetsDir / "textures/");
+    ReLoc::setPrefixFor(ReType::Any,          assetsDir);
+
+    rbw::GLWindowPtr window;
+    rbw::GLContextClientPtr contextClient;
+    const bool backendInitialized = (AppBackend != rbw::WindowBackend::Unknown) && AppWindowFactory::InitializeBackend();
+    if (backendInitialized)
+    {
+        rbw::WindowCreationParameters windowParams = {
+            "RenderBoi benchmarks",             // title
+            1280,                               // width
+            720,                                // height
+            false,                              // resizable
+            GL_CONTEXT_VERSION_MAJOR,           // glVersionMajor
+            GL_CONTEXT_VERSION_MINOR,           // glVersionMinor
+            rb::Window::OpenGLProfile::Core,    // glProfile
+            nullptr,                            // shareContext
+            nullptr,                            // monitor
+            false,                              // borderlessFullscreen
+            false,                              // autoMinimize
+            false,                              // decorated
+            false,                              // transparentFramebuffer
+            false,                              // visible
+            false,                              // maximized
+            false,                              // alwaysOnTop
+            false,                              // focused
+            false,                              // focusOnShow
+            false,                              // scaleToMonitor
+            false                               // debug
+        };
+
+        try
+        {
+            window = AppWindowFactory::MakeWindow(windowParams);
+            contextClient = std::make_shared<rbw::GLContextClient>(window);
+            window->makeContextCurrent(contextClient);
+            rb::Benchmarks::GLContextAvailable = true;
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "Could not create a GL context, GL benchmarks will be skipped:\n" << e.what() << std::endl;
+        }
+    }
+    else
+    {
+        std::cerr << "Could not initialize the window backend, GL benchmarks will be skipped." << std::endl;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    if (window)
+    {
+        rb::GLResourceRegistry::ProcessPendingDeletions();
+        window->releaseContext();
+        AppWindowFactory::DestroyWindow(window);
+    }
+
+    if (backendInitialized)
+    {
+        AppWindowFactory::TerminateBackend();
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,219 @@
+#include <cstddef>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <renderboi/core/transform.hpp>
+
+#include <renderboi/toolbox/factory.hpp>
+#include <renderboi/toolbox/scene/scene.hpp>
+#include <renderboi/toolbox/scene/scene_object.hpp>
+#include <renderboi/toolbox/scene/components/light_component.hpp>
+
+#include "benchmark_environment.hpp"
+#include "scene_generators.hpp"
+
+namespace Renderboi::Benchmarks
+{
+
+namespace
+{
+
+/// @brief How many objects are moved or queried per iteration by the
+/// benchmarks which do not touch the whole scene.
+constexpr std::size_t SampleCount = 1024;
+
+/// @brief Pick evenly spread IDs out of an array.
+std::vector<unsigned int> sample(const std::vector<unsigned int>& ids, const std::size_t count)
+{
+    std::vector<unsigned int> result;
+    const std::size_t step = (ids.size() > count) ? ids.size() / count : 1;
+    for (std::size_t i = 0; i < ids.size() && result.size() < count; i += step)
+    {
+        result.push_back(ids[i]);
+    }
+
+    return result;
+}
+
+}//namespace
+
+template<Hierarchy Shape>
+void SceneRegisterObject(benchmark::State& state)
+{
+    const unsigned int count = (unsigned int)state.range(0);
+    std::vector<int> parents;
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        ScenePtr scene = Factory::MakeScene();
+        std::vector<SceneObjectPtr> objects = MakeUnregisteredObjects(Shape, count, parents);
+        state.ResumeTiming();
+
+        for (std::size_t i = 0; i < objects.size(); i++)
+        {
+            if (parents[i] < 0)
+            {
+                scene->registerObject(objects[i]);
+            }
+            else
+            {
+                scene->registerObject(objects[i], objects[parents[i]]->id);
+            }
+        }
+
+        state.PauseTiming();
+        Factory::DestroyScene(scene);
+        objects.clear();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(SceneRegisterObject, Hierarchy::Wide)->RB_BENCHMARK_OBJECT_COUNTS->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(SceneRegisterObject, Hierarchy::Deep)->RB_BENCHMARK_OBJECT_COUNTS->Unit(benchmark::kMillisecond);
+
+template<Hierarchy Shape>
+void SceneRemoveObject(benchmark::State& state)
+{
+    const unsigned int count = (unsigned int)state.range(0);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        ScenePtr scene = Factory::MakeScene();
+        const GeneratedHierarchy hierarchy = MakeHierarchy(scene, Shape, count);
+        state.ResumeTiming();
+
+        // Removing an object removes its whole subtree
+        for (const unsigned int id : hierarchy.roots)
+        {
+            scene->removeObject(id);
+        }
+
+        state.PauseTiming();
+        Factory::DestroyScene(scene);
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(SceneRemoveObject, Hierarchy::Wide)->RB_BENCHMARK_OBJECT_COUNTS->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(SceneRemoveObject, Hierarchy::Deep)->RB_BENCHMARK_OBJECT_COUNTS->Unit(benchmark::kMillisecond);
+
+template<Hierarchy Shape>
+void SceneMoveObject(benchmark::State& state)
+{
+    const unsigned int count = (unsigned int)state.range(0);
+    ScenePtr scene = Factory::MakeScene();
+    const GeneratedHierarchy hierarchy = MakeHierarchy(scene, Shape, count);
+
+    // Subtrees are moved back and forth between two objects which are not
+    // part of any of them, so that no move ever creates a cycle
+    const unsigned int anchors[2] = {scene->newObject()->id, scene->newObject()->id};
+    const std::vector<unsigned int> moved = sample(hierarchy.roots, SampleCount);
+
+    std::size_t iteration = 0;
+    for (auto _ : state)
+    {
+        const unsigned int anchor = anchors[iteration++ % 2];
+        for (const unsigned int id : moved)
+        {
+            scene->moveObject(id, anchor);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * moved.size());
+    Factory::DestroyScene(scene);
+}
+BENCHMARK_TEMPLATE(SceneMoveObject, Hierarchy::Wide)->RB_BENCHMARK_OBJECT_COUNTS;
+BENCHMARK_TEMPLATE(SceneMoveObject, Hierarchy::Deep)->RB_BENCHMARK_OBJECT_COUNTS;
+
+template<Hierarchy Shape>
+void SceneUpdateAllTransforms(benchmark::State& state)
+{
+    const unsigned int count = (unsigned int)state.range(0);
+    ScenePtr scene = Factory::MakeScene();
+    const GeneratedHierarchy hierarchy = MakeHierarchy(scene, Shape, count);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        DirtyTransforms(scene, hierarchy.roots);
+        state.ResumeTiming();
+
+        scene->updateAllTransforms();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+    Factory::DestroyScene(scene);
+}
+BENCHMARK_TEMPLATE(SceneUpdateAllTransforms, Hierarchy::Wide)->RB_BENCHMARK_OBJECT_COUNTS->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(SceneUpdateAllTransforms, Hierarchy::Deep)->RB_BENCHMARK_OBJECT_COUNTS->Unit(benchmark::kMillisecond);
+
+template<Hierarchy Shape>
+void SceneGetWorldTransform(benchmark::State& state)
+{
+    const unsigned int count = (unsigned int)state.range(0);
+    ScenePtr scene = Factory::MakeScene();
+    const GeneratedHierarchy hierarchy = MakeHierarchy(scene, Shape, count);
+    const std::vector<unsigned int> queried = sample(hierarchy.leaves, SampleCount);
+    const std::vector<unsigned int> dirtied = sample(hierarchy.roots, SampleCount);
+
+    // Leaves are queried with their whole parent chain outdated, so that
+    // the cascading update is measured as well
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        DirtyTransforms(scene, dirtied);
+        state.ResumeTiming();
+
+        for (const unsigned int id : queried)
+        {
+            benchmark::DoNotOptimize(scene->getWorldTransform(id));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * queried.size());
+    Factory::DestroyScene(scene);
+}
+BENCHMARK_TEMPLATE(SceneGetWorldTransform, Hierarchy::Wide)->RB_BENCHMARK_OBJECT_COUNTS;
+BENCHMARK_TEMPLATE(SceneGetWorldTransform, Hierarchy::Deep)->RB_BENCHMARK_OBJECT_COUNTS;
+
+template<Hierarchy Shape>
+void SceneGetObjectsWithComponent(benchmark::State& state)
+{
+    const unsigned int count = (unsigned int)state.range(0);
+    ScenePtr scene = Factory::MakeScene();
+    const GeneratedHierarchy hierarchy = MakeHierarchy(scene, Shape, count);
+    AddLights(scene, hierarchy.objects, 16);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(scene->getObjectsWithComponent<LightComponent>());
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+    Factory::DestroyScene(scene);
+}
+BENCHMARK_TEMPLATE(SceneGetObjectsWithComponent, Hierarchy::Wide)->RB_BENCHMARK_OBJECT_COUNTS->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(SceneGetObjectsWithComponent, Hierarchy::Deep)->RB_BENCHMARK_OBJECT_COUNTS->Unit(benchmark::kMillisecond);
+
+void TransformApplyOver(benchmark::State& state)
+{
+    const Transform parent = Transform({1.f, 2.f, 3.f}, glm::angleAxis(0.5f, Transform::Y), {2.f, 2.f, 2.f});
+    Transform child = Transform({0.5f, 0.25f, 0.f}, glm::angleAxis(0.25f, Transform::X), {1.f, 1.f, 1.f});
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(child);
+        Transform world = child.applyOver(parent);
+        benchmark::DoNotOptimize(world);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(TransformApplyOver);
+
+}//namespace Renderboi::Benchmarks
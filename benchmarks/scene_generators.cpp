@@ -0,0 +1,97 @@
+#include "scene_generators.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <renderboi/core/frame_of_reference.hpp>
+#include <renderboi/core/lights/point_light.hpp>
+
+#include <renderboi/toolbox/factory.hpp>
+#include <renderboi/toolbox/scene/scene_object.hpp>
+#include <renderboi/toolbox/scene/components/light_component.hpp>
+
+namespace Renderboi::Benchmarks
+{
+
+namespace
+{
+
+/// @brief Offset of each object relative to its parent.
+constexpr glm::vec3 ChildOffset = {0.5f, 0.25f, 0.f};
+
+}//namespace
+
+GeneratedHierarchy MakeHierarchy(const ScenePtr scene, const Hierarchy shape, const unsigned int count)
+{
+    using Ref = FrameOfReference;
+
+    GeneratedHierarchy result;
+    result.objects.reserve(count);
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        const bool chained = (shape == Hierarchy::Deep) && (i % DeepChainLength != 0);
+
+        SceneObjectPtr object = chained ?
+            scene->newObject(result.objects.back()) :
+            scene->newObject();
+
+        object->transform.translateBy<Ref::Parent>(ChildOffset);
+        result.objects.push_back(object->id);
+
+        if (!chained)
+        {
+            result.roots.push_back(object->id);
+        }
+
+        // The last object of a chain, or any object of a wide hierarchy
+        const bool lastOfChain = (i + 1 == count) || ((i + 1) % DeepChainLength == 0);
+        if (shape == Hierarchy::Wide || lastOfChain)
+        {
+            result.leaves.push_back(object->id);
+        }
+    }
+
+    return result;
+}
+
+std::vector<SceneObjectPtr> MakeUnregisteredObjects(const Hierarchy shape, const unsigned int count, std::vector<int>& parents)
+{
+    std::vector<SceneObjectPtr> objects;
+    objects.reserve(count);
+    parents.clear();
+    parents.reserve(count);
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        objects.push_back(Factory::MakeSceneObject());
+
+        const bool chained = (shape == Hierarchy::Deep) && (i % DeepChainLength != 0);
+        parents.push_back(chained ? (int)i - 1 : -1);
+    }
+
+    return objects;
+}
+
+void AddLights(const ScenePtr scene, const std::vector<unsigned int>& objects, const unsigned int every)
+{
+    const LightPtr light = std::make_shared<PointLight>(10.f);
+    for (std::size_t i = 0; i < objects.size(); i += every)
+    {
+        (*scene)[objects[i]]->addComponent<LightComponent>(light);
+    }
+}
+
+void DirtyTransforms(const ScenePtr scene, const std::vector<unsigned int>& roots)
+{
+    using Ref = FrameOfReference;
+
+    for (const unsigned int id : roots)
+    {
+        (*scene)[id]->transform.translateBy<Ref::Parent>(ChildOffset);
+    }
+}
+
+}//namespace Renderboi::Benchmarks
@@ -0,0 +1,78 @@
+#ifndef RENDERBOI__BENCHMARKS__SCENE_GENERATORS_HPP
+#define RENDERBOI__BENCHMARKS__SCENE_GENERATORS_HPP
+
+#include <vector>
+
+#include <renderboi/toolbox/scene/scene.hpp>
+
+namespace Renderboi::Benchmarks
+{
+
+/// @brief Collection of litterals describing the shapes of the synthetic
+/// hierarchies generated for benchmarks.
+enum class Hierarchy
+{
+    /// @brief All objects are children of the root.
+    Wide,
+
+    /// @brief Objects are chained to one another, in chains of
+    /// DeepChainLength objects hanging from the root.
+    Deep
+};
+
+/// @brief How many objects are chained to one another in deep hierarchies.
+/// Bounded so that recursive tree traversals do not run out of stack with
+/// a million objects.
+static constexpr unsigned int DeepChainLength = 256;
+
+/// @brief IDs of the objects of a generated hierarchy.
+struct GeneratedHierarchy
+{
+    /// @brief IDs of all generated objects, in creation order.
+    std::vector<unsigned int> objects;
+
+    /// @brief IDs of the generated objects which are children of the root.
+    std::vector<unsigned int> roots;
+
+    /// @brief IDs of the generated objects which have no children.
+    std::vector<unsigned int> leaves;
+};
+
+/// @brief Create objects and register them in a scene, each offset from
+/// its parent so that world transforms are not trivial.
+///
+/// @param scene Scene to register the objects in.
+/// @param shape Literal describing the shape of the hierarchy.
+/// @param count How many objects to create.
+///
+/// @return The IDs of the generated objects.
+GeneratedHierarchy MakeHierarchy(const ScenePtr scene, const Hierarchy shape, const unsigned int count);
+
+/// @brief Create objects without registering them, chained to one another
+/// if the hierarchy is deep.
+///
+/// @param shape Literal describing the shape of the hierarchy.
+/// @param count How many objects to create.
+/// @param[out] parents Will receive, for each object, the index of its
+/// parent in the returned array, or -1 if it hangs from the root.
+///
+/// @return The created objects.
+std::vector<SceneObjectPtr> MakeUnregisteredObjects(const Hierarchy shape, const unsigned int count, std::vector<int>& parents);
+
+/// @brief Attach a point light component to every nth generated object.
+///
+/// @param scene Scene the objects belong to.
+/// @param objects IDs of the objects.
+/// @param every Attach a light to one object out of this many.
+void AddLights(const ScenePtr scene, const std::vector<unsigned int>& objects, const unsigned int every);
+
+/// @brief Mark the world transforms of whole hierarchies as outdated, by
+/// moving the objects they hang from.
+///
+/// @param scene Scene the objects belong to.
+/// @param roots IDs of the objects to move.
+void DirtyTransforms(const ScenePtr scene, const std::vector<unsigned int>& roots);
+
+}//namespace Renderboi::Benchmarks
+
+#endif//RENDERBOI__BENCHMARKS__SCENE_GENERATORS_HPP
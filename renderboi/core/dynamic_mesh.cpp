@@ -0,0 +1,248 @@
+#include "dynamic_mesh.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "mesh.hpp"
+#include "render_stats.hpp"
+#include "vertex.hpp"
+
+namespace Renderboi
+{
+
+DynamicMesh::DynamicMesh(
+    const unsigned int drawMode,
+    std::vector<Vertex> vertices,
+    std::vector<unsigned int> indices,
+    const unsigned int bufferCount
+) :
+    DynamicMesh(drawMode, vertices, indices, {(unsigned int)indices.size()}, {nullptr}, bufferCount)
+{
+
+}
+
+DynamicMesh::DynamicMesh(
+    const unsigned int drawMode,
+    const std::vector<Vertex> vertices,
+    const std::vector<unsigned int> indices,
+    const std::vector<unsigned int> primitiveSizes,
+    const std::vector<void*> primitiveOffsets,
+    const unsigned int bufferCount
+) :
+    Mesh(drawMode, vertices, indices, primitiveSizes, primitiveOffsets),
+    _bufferCount(bufferCount),
+    _regionSize((GLsizeiptr)(vertices.size() * sizeof(Vertex))),
+    _currentRegion(0),
+    _fences(bufferCount, nullptr),
+    _dirtyRanges(bufferCount),
+    _baseVertices(primitiveSizes.size(), 0)
+{
+    if (!_bufferCount)
+    {
+        throw std::runtime_error("DynamicMesh: buffer count cannot be zero.");
+    }
+
+    // Vertices may be moved anywhere, so the mesh is never to be culled
+    _boundingSphereRadius = std::numeric_limits<float>::infinity();
+
+    // Reallocate the vertex buffer so that it holds one copy of the vertex
+    // data per region. The VAO refers to the buffer by name, so it is set
+    // up the same as for any other mesh.
+    glBindBuffer(GL_ARRAY_BUFFER, _vbo);
+    glBufferData(GL_ARRAY_BUFFER, _bufferCount * _regionSize, nullptr, GL_DYNAMIC_DRAW);
+    for (unsigned int i = 0; i < _bufferCount; i++)
+    {
+        glBufferSubData(GL_ARRAY_BUFFER, i * _regionSize, _regionSize, &_vertices[0]);
+    }
+    _setVertexBufferSize((uint64_t)(_bufferCount * _regionSize));
+}
+
+DynamicMesh::~DynamicMesh()
+{
+    for (GLsync fence : _fences)
+    {
+        if (fence) glDeleteSync(fence);
+    }
+}
+
+void DynamicMesh::setVertex(const unsigned int index, const Vertex& vertex)
+{
+    if (index >= _vertices.size())
+    {
+        throw std::runtime_error("DynamicMesh: vertex index is out of range.");
+    }
+
+    _vertices[index] = vertex;
+    _markDirty(index, index + 1);
+}
+
+void DynamicMesh::setVertices(const unsigned int first, const std::vector<Vertex>& vertices)
+{
+    if (vertices.empty()) return;
+
+    Vertex* destination = editVertices(first, (unsigned int)vertices.size());
+    std::copy(vertices.begin(), vertices.end(), destination);
+}
+
+Vertex* DynamicMesh::editVertices(const unsigned int first, const unsigned int count)
+{
+    if ((size_t)first + count > _vertices.size())
+    {
+        throw std::runtime_error("DynamicMesh: vertex range reaches past the last vertex.");
+    }
+
+    _markDirty(first, first + count);
+    return &_vertices[first];
+}
+
+void DynamicMesh::setEvictable(const bool evictable)
+{
+    // Vertex data is rewritten in place, and never evicted
+}
+
+unsigned int DynamicMesh::getBufferCount() const
+{
+    return _bufferCount;
+}
+
+void DynamicMesh::_markDirty(unsigned int begin, unsigned int end)
+{
+    if (begin >= end) return;
+
+    for (auto& ranges : _dirtyRanges)
+    {
+        // Find the first range which is not entirely before the new one
+        auto it = std::lower_bound(ranges.begin(), ranges.end(), begin,
+            [](const DirtyRange& range, const unsigned int value)
+            {
+                return range.end < value;
+            }
+        );
+
+        // Absorb all ranges overlapping or adjacent to the new one
+        DirtyRange merged = {begin, end};
+        auto last = it;
+        while (last != ranges.end() && last->begin <= end)
+        {
+            merged.begin = std::min(merged.begin, last->begin);
+            merged.end = std::max(merged.end, last->end);
+            last++;
+        }
+
+        it = ranges.erase(it, last);
+        ranges.insert(it, merged);
+    }
+}
+
+void DynamicMesh::_advanceRegion()
+{
+    const unsigned int next = (_currentRegion + 1) % _bufferCount;
+
+    _waitForRegion(next);
+    _uploadRegion(next);
+
+    _currentRegion = next;
+    std::fill(_baseVertices.begin(), _baseVertices.end(), (GLint)(_currentRegion * _vertices.size()));
+}
+
+void DynamicMesh::_waitForRegion(unsigned int region)
+{
+    GLsync& fence = _fences[region];
+    if (!fence) return;
+
+    // With enough regions the fence has long been signaled by now, and this
+    // does not block
+    GLenum status;
+    do
+    {
+        status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, FenceWaitTimeout);
+    }
+    while (status == GL_TIMEOUT_EXPIRED);
+
+    glDeleteSync(fence);
+    fence = nullptr;
+
+    if (status == GL_WAIT_FAILED)
+    {
+        throw std::runtime_error("DynamicMesh: failed to wait on the fence guarding a buffer region.");
+    }
+}
+
+void DynamicMesh::_uploadRegion(unsigned int region)
+{
+    std::vector<DirtyRange>& ranges = _dirtyRanges[region];
+    if (ranges.empty()) return;
+
+    // Map the span covering all dirty ranges. The region is known not to be
+    // in use by the GPU, so no implicit synchronisation is needed.
+    const unsigned int spanBegin = ranges.front().begin;
+    const GLintptr mapOffset = region * _regionSize + spanBegin * sizeof(Vertex);
+    const GLsizeiptr mapLength = (ranges.back().end - spanBegin) * sizeof(Vertex);
+
+    glBindBuffer(GL_ARRAY_BUFFER, _vbo);
+    char* mapped = (char*) glMapBufferRange(
+        GL_ARRAY_BUFFER,
+        mapOffset,
+        mapLength,
+        GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_FLUSH_EXPLICIT_BIT
+    );
+
+    if (mapped)
+    {
+        // Only write and flush what was actually modified
+        for (const auto& range : ranges)
+        {
+            const GLintptr offset = (range.begin - spanBegin) * sizeof(Vertex);
+            const GLsizeiptr length = (range.end - range.begin) * sizeof(Vertex);
+
+            std::memcpy(mapped + offset, &_vertices[range.begin], length);
+            glFlushMappedBufferRange(GL_ARRAY_BUFFER, offset, length);
+            RenderStats::Count(RenderCounter::BytesUploaded, (uint64_t)length);
+        }
+    }
+
+    if (!mapped || glUnmapBuffer(GL_ARRAY_BUFFER) == GL_FALSE)
+    {
+        // Mapping failed, or the buffer contents were lost (which may happen
+        // upon display mode changes): rewrite this region entirely and have
+        // all others be rewritten as well when their turn comes
+        _markDirty(0, (unsigned int)_vertices.size());
+        glBufferSubData(GL_ARRAY_BUFFER, region * _regionSize, _regionSize, &_vertices[0]);
+        RenderStats::Count(RenderCounter::BytesUploaded, (uint64_t)_regionSize);
+    }
+
+    ranges.clear();
+}
+
+void DynamicMesh::draw()
+{
+    // Pending modifications go to the next region, leaving the current one
+    // untouched for draws which may still be in flight
+    if (!_dirtyRanges[_currentRegion].empty())
+    {
+        _advanceRegion();
+    }
+
+    _bindVertexArray();
+    glMultiDrawElementsBaseVertex(
+        _drawMode,
+        (GLsizei*) &(_primitiveSizes[0]),
+        GL_UNSIGNED_INT,
+        (void* const*) &(_primitiveOffsets[0]),
+        (GLsizei) _primitiveSizes.size(),
+        &(_baseVertices[0])
+    );
+    RenderStats::Count(RenderCounter::DrawCalls);
+
+    // Guard the region against being written to until this draw completes
+    if (_fences[_currentRegion])
+    {
+        glDeleteSync(_fences[_currentRegion]);
+    }
+    _fences[_currentRegion] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+}//namespace Renderboi
@@ -0,0 +1,186 @@
+#ifndef RENDERBOI__CORE__DYNAMIC_MESH_HPP
+#define RENDERBOI__CORE__DYNAMIC_MESH_HPP
+
+#include <memory>
+#include <vector>
+
+#include <glad/gl.h>
+
+#include "mesh.hpp"
+#include "vertex.hpp"
+
+namespace Renderboi
+{
+
+class DynamicMesh;
+using DynamicMeshPtr = std::shared_ptr<DynamicMesh>;
+using DynamicMeshWPtr = std::weak_ptr<DynamicMesh>;
+
+/// @brief A mesh whose vertices can be updated after construction, for
+/// geometry which is animated or deformed on a per-frame basis. Vertex data
+/// lives in several regions of a single buffer on the GPU, one region being
+/// drawn from while the next one is written to, so that updates neither
+/// reallocate storage nor stall on draws still in flight. Only modified
+/// vertex ranges are written and flushed to the GPU. Vertex indices and
+/// primitive info cannot be modified.
+///
+/// @note All methods must be called on the thread the GL context which the
+/// mesh was created in is current on.
+class DynamicMesh : public Mesh
+{
+public:
+    /// @brief Default amount of buffer regions to cycle through.
+    static constexpr unsigned int DefaultBufferCount = 3;
+
+private:
+    /// @brief Range of vertices which were modified but not yet written to
+    /// a buffer region, as [begin, end).
+    struct DirtyRange
+    {
+        unsigned int begin;
+        unsigned int end;
+    };
+
+    /// @brief Time in nanoseconds to wait for a fence in a single call to
+    /// glClientWaitSync before trying again.
+    static constexpr GLuint64 FenceWaitTimeout = 1000000;
+
+    /// @brief Amount of buffer regions to cycle through.
+    const unsigned int _bufferCount;
+
+    /// @brief Size in bytes of a single buffer region.
+    const GLsizeiptr _regionSize;
+
+    /// @brief Index of the buffer region currently drawn from.
+    unsigned int _currentRegion;
+
+    /// @brief Fences placed after the last draw issued from each buffer
+    /// region. A null fence means no draw is pending on the region.
+    std::vector<GLsync> _fences;
+
+    /// @brief Sorted, non-overlapping ranges of vertices which are yet to be
+    /// written to each buffer region.
+    std::vector<std::vector<DirtyRange>> _dirtyRanges;
+
+    /// @brief Base vertex to use for every primitive when drawing from the
+    /// current buffer region.
+    std::vector<GLint> _baseVertices;
+
+    /// @brief Mark a range of vertices as modified in all buffer regions.
+    ///
+    /// @param begin Index of the first modified vertex.
+    /// @param end Index past the last modified vertex.
+    void _markDirty(unsigned int begin, unsigned int end);
+
+    /// @brief Move on to the next buffer region, wait until the GPU is done
+    /// drawing from it, and write all pending modifications to it.
+    void _advanceRegion();
+
+    /// @brief Block until the GPU is done drawing from a buffer region.
+    ///
+    /// @param region Index of the buffer region to wait for.
+    ///
+    /// @exception If waiting on the fence failed, the function will throw
+    /// a std::runtime_error.
+    void _waitForRegion(unsigned int region);
+
+    /// @brief Write pending vertex modifications to a buffer region and
+    /// flush them.
+    ///
+    /// @param region Index of the buffer region to write to.
+    void _uploadRegion(unsigned int region);
+
+public:
+    /// @param drawMode Draw policy to use when drawing.
+    /// @param vertices Initial vertex data of the mesh.
+    /// @param indices Vertex indices telling how to draw the mesh.
+    /// @param bufferCount Amount of buffer regions to cycle through.
+    ///
+    /// @exception If the buffer count is zero, the constructor will throw
+    /// a std::runtime_error.
+    DynamicMesh(
+        const unsigned int drawMode,
+        std::vector<Vertex> vertices,
+        std::vector<unsigned int> indices,
+        const unsigned int bufferCount = DefaultBufferCount
+    );
+
+    /// @param drawMode Draw policy to use when drawing.
+    /// @param vertices Initial vertex data of the mesh.
+    /// @param indices Vertex indices telling how to draw the mesh.
+    /// @param primitiveSizes Sizes of the different strips contained within indices.
+    /// @param primitiveOffsets Indices at which a primitive should start.
+    /// @param bufferCount Amount of buffer regions to cycle through.
+    ///
+    /// @exception If the buffer count is zero, the constructor will throw
+    /// a std::runtime_error.
+    DynamicMesh(
+        const unsigned int drawMode,
+        const std::vector<Vertex> vertices,
+        const std::vector<unsigned int> indices,
+        const std::vector<unsigned int> primitiveSizes,
+        const std::vector<void*> primitiveOffsets,
+        const unsigned int bufferCount = DefaultBufferCount
+    );
+
+    DynamicMesh(const DynamicMesh& other) = delete;
+    DynamicMesh& operator=(const DynamicMesh& other) = delete;
+
+    ~DynamicMesh();
+
+    /// @brief Replace a single vertex of the mesh.
+    ///
+    /// @param index Index of the vertex to replace.
+    /// @param vertex New value of the vertex.
+    ///
+    /// @exception If the index is out of range, the function will throw a
+    /// std::runtime_error.
+    void setVertex(const unsigned int index, const Vertex& vertex);
+
+    /// @brief Replace a contiguous range of vertices of the mesh.
+    ///
+    /// @param first Index of the first vertex to replace.
+    /// @param vertices New values of the vertices.
+    ///
+    /// @exception If the range reaches past the last vertex of the mesh,
+    /// the function will throw a std::runtime_error.
+    void setVertices(const unsigned int first, const std::vector<Vertex>& vertices);
+
+    /// @brief Get write access to a contiguous range of vertices of the
+    /// mesh, which is marked as modified. Writes made through the returned
+    /// pointer after the next call to draw will not be picked up.
+    ///
+    /// @param first Index of the first vertex to modify.
+    /// @param count Amount of vertices to modify.
+    ///
+    /// @return A pointer to the first vertex of the range.
+    ///
+    /// @exception If the range reaches past the last vertex of the mesh,
+    /// the function will throw a std::runtime_error.
+    Vertex* editVertices(const unsigned int first, const unsigned int count);
+
+    /// @brief Get the amount of buffer regions the mesh cycles through.
+    ///
+    /// @return The amount of buffer regions the mesh cycles through.
+    unsigned int getBufferCount() const;
+
+    ////////////////////////////////////
+    ///                              ///
+    /// Methods overridden from Mesh ///
+    ///                              ///
+    ////////////////////////////////////
+
+    /// @brief Write pending vertex modifications to the GPU if any, and
+    /// issue GPU draw commands.
+    void draw() override;
+
+    /// @brief Dynamic meshes are rewritten in place and never evicted from
+    /// the GPU: this does nothing.
+    ///
+    /// @param evictable Ignored.
+    void setEvictable(const bool evictable) override;
+};
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__CORE__DYNAMIC_MESH_HPP
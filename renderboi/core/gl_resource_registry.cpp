@@ -0,0 +1,351 @@
+#include "gl_resource_registry.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include <glad/gl.h>
+
+#include "gpu_memory.hpp"
+
+namespace Renderboi
+{
+
+GLResourceRegistry::Storage& GLResourceRegistry::_GetStorage()
+{
+    static Storage* storage = new Storage();
+    return *storage;
+}
+
+GLResourceRegistry::Slot& GLResourceRegistry::_GetSlot(const unsigned int index)
+{
+    return _GetStorage().chunks[index / ChunkSize][index % ChunkSize];
+}
+
+GLResourceHandle GLResourceRegistry::Register(const GLResourceType type, const unsigned int name)
+{
+    Storage& storage = _GetStorage();
+    std::unique_lock lock(storage.slotMutex);
+
+    // Reuse a free slot if any, otherwise take a new one
+    unsigned int index = storage.freeListHead;
+    if (index != NoFreeSlot)
+    {
+        storage.freeListHead = _GetSlot(index).nextFree;
+    }
+    else
+    {
+        index = storage.slotCount;
+        const unsigned int chunk = index / ChunkSize;
+        if (chunk >= MaxChunkCount)
+        {
+            throw std::runtime_error("GLResourceRegistry: cannot register resource as registry is full.");
+        }
+
+        if (!storage.chunks[chunk])
+        {
+            storage.chunks[chunk] = std::make_unique<Slot[]>(ChunkSize);
+        }
+        storage.slotCount++;
+    }
+
+    Slot& slot = _GetSlot(index);
+    slot.name = name;
+    slot.type = type;
+    slot.nextFree = NoFreeSlot;
+    slot.tracked = false;
+    slot.bytes = 0;
+    slot.evictable = false;
+    slot.resident.store(true, std::memory_order_relaxed);
+    slot.lastUse.store(GPUMemory::GetFrame(), std::memory_order_relaxed);
+    slot.refCount.store(1, std::memory_order_release);
+
+    return {index, slot.generation.load(std::memory_order_relaxed)};
+}
+
+void GLResourceRegistry::Acquire(const GLResourceHandle handle)
+{
+    _GetSlot(handle.index).refCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool GLResourceRegistry::TryAcquire(const GLResourceHandle handle)
+{
+    if (!Valid(handle)) return false;
+
+    // Only add a reference if the resource is still alive
+    Slot& slot = _GetSlot(handle.index);
+    unsigned int count = slot.refCount.load(std::memory_order_relaxed);
+    do
+    {
+        if (!count) return false;
+    }
+    while (!slot.refCount.compare_exchange_weak(count, count + 1, std::memory_order_acquire, std::memory_order_relaxed));
+
+    // The slot may have been freed and reused in the meantime, in which case
+    // the reference which was just added belongs to another resource
+    if (slot.generation.load(std::memory_order_acquire) != handle.generation)
+    {
+        Release({handle.index, slot.generation.load(std::memory_order_relaxed)});
+        return false;
+    }
+
+    return true;
+}
+
+bool GLResourceRegistry::Release(const GLResourceHandle handle)
+{
+    if (_GetSlot(handle.index).refCount.fetch_sub(1, std::memory_order_acq_rel) != 1)
+    {
+        return false;
+    }
+
+    _FreeSlot(handle.index);
+    return true;
+}
+
+void GLResourceRegistry::_FreeSlot(const unsigned int index)
+{
+    Storage& storage = _GetStorage();
+    Slot& slot = _GetSlot(index);
+
+    {
+        std::unique_lock lock(storage.deletionMutex);
+        storage.pendingDeletions.push_back({slot.type, slot.name});
+    }
+
+    std::unique_lock lock(storage.slotMutex);
+
+    // The memory of the resource is given back once it is deleted, which
+    // is soon enough for accounting purposes
+    if (slot.tracked)
+    {
+        GPUMemory::Untrack(slot.category, slot.bytes);
+        slot.tracked = false;
+        slot.bytes = 0;
+    }
+
+    // Invalidate all handles to the slot, generation 0 being reserved
+    unsigned int generation = slot.generation.load(std::memory_order_relaxed) + 1;
+    if (!generation) generation = 1;
+    slot.generation.store(generation, std::memory_order_release);
+
+    slot.nextFree = storage.freeListHead;
+    storage.freeListHead = index;
+}
+
+bool GLResourceRegistry::Valid(const GLResourceHandle handle)
+{
+    Storage& storage = _GetStorage();
+    if (!handle.generation || handle.index / ChunkSize >= MaxChunkCount || !storage.chunks[handle.index / ChunkSize])
+    {
+        return false;
+    }
+
+    return _GetSlot(handle.index).generation.load(std::memory_order_acquire) == handle.generation;
+}
+
+unsigned int GLResourceRegistry::GetName(const GLResourceHandle handle)
+{
+    if (!Valid(handle)) return 0;
+
+    return _GetSlot(handle.index).name;
+}
+
+unsigned int GLResourceRegistry::GetRefCount(const GLResourceHandle handle)
+{
+    if (!Valid(handle)) return 0;
+
+    return _GetSlot(handle.index).refCount.load(std::memory_order_relaxed);
+}
+
+void GLResourceRegistry::SetSize(const GLResourceHandle handle, const GPUMemoryCategory category, const uint64_t bytes)
+{
+    if (!Valid(handle)) return;
+
+    Storage& storage = _GetStorage();
+    std::unique_lock lock(storage.slotMutex);
+    Slot& slot = _GetSlot(handle.index);
+
+    if (!slot.tracked)
+    {
+        GPUMemory::Track(category, bytes);
+    }
+    else if (slot.category != category)
+    {
+        GPUMemory::Untrack(slot.category, slot.bytes);
+        GPUMemory::Track(category, bytes);
+    }
+    else
+    {
+        GPUMemory::Resize(category, slot.bytes, bytes);
+    }
+
+    slot.tracked = true;
+    slot.category = category;
+    slot.bytes = bytes;
+    slot.resident.store(true, std::memory_order_release);
+}
+
+uint64_t GLResourceRegistry::GetSize(const GLResourceHandle handle)
+{
+    if (!Valid(handle)) return 0;
+
+    std::unique_lock lock(_GetStorage().slotMutex);
+    return _GetSlot(handle.index).bytes;
+}
+
+void GLResourceRegistry::SetEvictable(const GLResourceHandle handle, const bool evictable)
+{
+    if (!Valid(handle)) return;
+
+    std::unique_lock lock(_GetStorage().slotMutex);
+    _GetSlot(handle.index).evictable = evictable;
+}
+
+bool GLResourceRegistry::Touch(const GLResourceHandle handle)
+{
+    Slot& slot = _GetSlot(handle.index);
+    slot.lastUse.store(GPUMemory::GetFrame(), std::memory_order_relaxed);
+
+    return slot.resident.load(std::memory_order_acquire);
+}
+
+uint64_t GLResourceRegistry::EvictLeastRecentlyUsed(const uint64_t bytes, const uint64_t unusedSince)
+{
+    Storage& storage = _GetStorage();
+    std::unique_lock lock(storage.slotMutex);
+
+    // Gather all resources which could be evicted. Slots whose last
+    // reference was released are left alone, as they are on their way to
+    // be deleted anyway.
+    struct Candidate
+    {
+        uint64_t lastUse;
+        unsigned int index;
+    };
+
+    std::vector<Candidate> candidates;
+    for (unsigned int i = 0; i < storage.slotCount; i++)
+    {
+        const Slot& slot = _GetSlot(i);
+        if (!slot.evictable || !slot.tracked || !slot.bytes) continue;
+        if (!slot.resident.load(std::memory_order_relaxed)) continue;
+        if (!slot.refCount.load(std::memory_order_acquire)) continue;
+
+        const uint64_t lastUse = slot.lastUse.load(std::memory_order_relaxed);
+        if (lastUse >= unusedSince) continue;
+
+        candidates.push_back({lastUse, i});
+    }
+
+    std::sort(candidates.begin(), candidates.end(),
+        [](const Candidate& left, const Candidate& right)
+        {
+            return left.lastUse < right.lastUse;
+        }
+    );
+
+    uint64_t freed = 0;
+    for (auto it = candidates.cbegin(); it != candidates.cend() && freed < bytes; it++)
+    {
+        Slot& slot = _GetSlot(it->index);
+        _EvictStorage(slot.type, slot.name);
+
+        GPUMemory::Resize(slot.category, slot.bytes, 0);
+        freed += slot.bytes;
+        slot.bytes = 0;
+        slot.resident.store(false, std::memory_order_release);
+    }
+
+    return freed;
+}
+
+void GLResourceRegistry::_EvictStorage(const GLResourceType type, const unsigned int name)
+{
+    switch (type)
+    {
+        case GLResourceType::Buffer:
+            // Use a binding point which no VAO keeps track of
+            glBindBuffer(GL_COPY_WRITE_BUFFER, name);
+            glBufferData(GL_COPY_WRITE_BUFFER, 0, nullptr, GL_STATIC_DRAW);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+            break;
+        case GLResourceType::Texture:
+        {
+            // Respecify the whole mip chain with empty images
+            GLint width, height;
+            glBindTexture(GL_TEXTURE_2D, name);
+            glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+            glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+
+            for (GLint level = 0, size = std::max(width, height); size > 0; level++, size /= 2)
+            {
+                glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, 0, 0, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+            }
+            glBindTexture(GL_TEXTURE_2D, 0);
+            break;
+        }
+        default:
+            // Other resources have no storage to speak of
+            break;
+    }
+}
+
+void GLResourceRegistry::ProcessPendingDeletions()
+{
+    Storage& storage = _GetStorage();
+
+    std::vector<PendingDeletion> deletions;
+    {
+        std::unique_lock lock(storage.deletionMutex);
+        if (storage.pendingDeletions.empty()) return;
+
+        deletions.swap(storage.pendingDeletions);
+    }
+
+    // Group resources by type so that they can be deleted in batches
+    std::sort(deletions.begin(), deletions.end(),
+        [](const PendingDeletion& left, const PendingDeletion& right)
+        {
+            return left.type < right.type;
+        }
+    );
+
+    std::vector<unsigned int> names;
+    names.reserve(deletions.size());
+    for (auto it = deletions.cbegin(); it != deletions.cend();)
+    {
+        const GLResourceType type = it->type;
+        names.clear();
+        for (; it != deletions.cend() && it->type == type; it++)
+        {
+            names.push_back(it->name);
+        }
+
+        switch (type)
+        {
+            case GLResourceType::VertexArray:
+                glDeleteVertexArrays((GLsizei)names.size(), &names[0]);
+                break;
+            case GLResourceType::Buffer:
+                glDeleteBuffers((GLsizei)names.size(), &names[0]);
+                break;
+            case GLResourceType::Texture:
+                glDeleteTextures((GLsizei)names.size(), &names[0]);
+                break;
+            case GLResourceType::Shader:
+                for (const auto& name : names) glDeleteShader(name);
+                break;
+            case GLResourceType::Program:
+                for (const auto& name : names) glDeleteProgram(name);
+                break;
+            case GLResourceType::Query:
+                glDeleteQueries((GLsizei)names.size(), &names[0]);
+                break;
+        }
+    }
+}
+
+}//namespace Renderboi
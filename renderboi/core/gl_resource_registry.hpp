@@ -0,0 +1,273 @@
+#ifndef RENDERBOI__CORE__GL_RESOURCE_REGISTRY_HPP
+#define RENDERBOI__CORE__GL_RESOURCE_REGISTRY_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "gpu_memory.hpp"
+
+namespace Renderboi
+{
+
+/// @brief Kinds of GPU resources managed by the GLResourceRegistry.
+enum class GLResourceType
+{
+    VertexArray,
+    Buffer,
+    Texture,
+    Shader,
+    Program,
+    Query
+};
+
+/// @brief Generational handle to a GPU resource registered in the
+/// GLResourceRegistry. A handle goes stale as soon as the resource it refers
+/// to is released for the last time, even if its slot gets reused.
+struct GLResourceHandle
+{
+    /// @brief Index of the slot of the resource in the registry.
+    unsigned int index;
+
+    /// @brief Generation of the slot at the time the resource was
+    /// registered. Generation 0 is never used by a live resource.
+    unsigned int generation;
+};
+
+/// @brief Central registry keeping track of how many references exist to
+/// resources on the GPU. Resources are held in dense slots with an intrusive
+/// reference count, so that acquiring and releasing a reference is O(1) and
+/// lock-free, and can be done from any thread. GPU resources whose last
+/// reference is released are not destroyed right away, but queued until
+/// pending deletions are processed on the thread the GL context is current
+/// on. The registry also records the size of resources which their owner
+/// reports, accounted for in GPUMemory, and can evict the storage of those
+/// marked evictable while keeping their name alive.
+class GLResourceRegistry
+{
+public:
+    /// @brief Amount of slots held by a single chunk.
+    static constexpr unsigned int ChunkSize = 1024;
+
+    /// @brief Maximum amount of chunks the registry can allocate.
+    static constexpr unsigned int MaxChunkCount = 1024;
+
+private:
+    /// @brief Index terminating the free slot list.
+    static constexpr unsigned int NoFreeSlot = (unsigned int)(-1);
+
+    /// @brief Bookkeeping data of a registered resource.
+    struct Slot
+    {
+        /// @brief Name of the resource on the GPU.
+        unsigned int name = 0;
+
+        /// @brief Kind of the resource on the GPU.
+        GLResourceType type = GLResourceType::Buffer;
+
+        /// @brief Current generation of the slot, incremented every time
+        /// the slot is freed.
+        std::atomic<unsigned int> generation = 1;
+
+        /// @brief How many references to the resource exist.
+        std::atomic<unsigned int> refCount = 0;
+
+        /// @brief Index of the next free slot, if this one is free.
+        unsigned int nextFree = NoFreeSlot;
+
+        /// @brief Whether the size of the resource is accounted for.
+        bool tracked = false;
+
+        /// @brief Kind of memory the resource occupies, if tracked.
+        GPUMemoryCategory category = GPUMemoryCategory::Textures;
+
+        /// @brief How many bytes the storage of the resource occupies, 0
+        /// while evicted.
+        uint64_t bytes = 0;
+
+        /// @brief Whether the storage of the resource may be evicted.
+        bool evictable = false;
+
+        /// @brief Whether the storage of the resource is on the GPU.
+        std::atomic<bool> resident = true;
+
+        /// @brief Frame during which the resource was last used.
+        std::atomic<uint64_t> lastUse = 0;
+    };
+
+    /// @brief A GPU resource awaiting deletion.
+    struct PendingDeletion
+    {
+        /// @brief Kind of the resource on the GPU.
+        GLResourceType type;
+
+        /// @brief Name of the resource on the GPU.
+        unsigned int name;
+    };
+
+    /// @brief All state of the registry.
+    struct Storage
+    {
+        /// @brief Chunks of slots. Chunks are never reallocated, so that
+        /// slots can be accessed without locking.
+        std::array<std::unique_ptr<Slot[]>, MaxChunkCount> chunks;
+
+        /// @brief Amount of slots which were ever handed out.
+        unsigned int slotCount = 0;
+
+        /// @brief Index of the first free slot.
+        unsigned int freeListHead = NoFreeSlot;
+
+        /// @brief Mutex protecting slot allocation and the free list.
+        std::mutex slotMutex;
+
+        /// @brief Resources awaiting deletion.
+        std::vector<PendingDeletion> pendingDeletions;
+
+        /// @brief Mutex protecting the deletion queue.
+        std::mutex deletionMutex;
+    };
+
+    /// @brief Get the state of the registry. The state is created upon
+    /// first use and is deliberately never destroyed, as resources held by
+    /// other static objects may be released during static destruction.
+    ///
+    /// @return A reference to the state of the registry.
+    static Storage& _GetStorage();
+
+    /// @brief Get the slot at a given index.
+    ///
+    /// @param index Index of the slot to get.
+    ///
+    /// @return A reference to the slot.
+    static Slot& _GetSlot(const unsigned int index);
+
+    /// @brief Queue the resource held in a slot for deletion and put the
+    /// slot back in the free list.
+    ///
+    /// @param index Index of the slot to free.
+    static void _FreeSlot(const unsigned int index);
+
+    /// @brief Release the storage of a resource on the GPU, keeping its name
+    /// alive. Must be called on the thread the GL context is current on.
+    ///
+    /// @param type Kind of the resource on the GPU.
+    /// @param name Name of the resource on the GPU.
+    static void _EvictStorage(const GLResourceType type, const unsigned int name);
+
+public:
+    /// @brief Register a resource on the GPU, with a reference count of 1.
+    ///
+    /// @param type Kind of the resource on the GPU.
+    /// @param name Name of the resource on the GPU.
+    ///
+    /// @return A handle to the registered resource.
+    ///
+    /// @exception If the registry is full, the function will throw a
+    /// std::runtime_error.
+    static GLResourceHandle Register(const GLResourceType type, const unsigned int name);
+
+    /// @brief Add a reference to a resource which the caller already holds
+    /// a reference to.
+    ///
+    /// @param handle Handle to the resource.
+    static void Acquire(const GLResourceHandle handle);
+
+    /// @brief Attempt to add a reference to a resource which the caller does
+    /// not hold a reference to, and which may have been released since the
+    /// handle was obtained.
+    ///
+    /// @param handle Handle to the resource.
+    ///
+    /// @return Whether a reference could be added.
+    static bool TryAcquire(const GLResourceHandle handle);
+
+    /// @brief Remove a reference to a resource. Upon removing the last
+    /// reference, the resource is queued for deletion and the handle goes
+    /// stale.
+    ///
+    /// @param handle Handle to the resource.
+    ///
+    /// @return Whether the last reference to the resource was removed.
+    static bool Release(const GLResourceHandle handle);
+
+    /// @brief Tell whether a handle refers to a live resource.
+    ///
+    /// @param handle Handle to check.
+    ///
+    /// @return Whether the handle refers to a live resource.
+    static bool Valid(const GLResourceHandle handle);
+
+    /// @brief Get the name of a resource on the GPU.
+    ///
+    /// @param handle Handle to the resource.
+    ///
+    /// @return The name of the resource on the GPU, 0 if the handle is 
+    /// stale.
+    static unsigned int GetName(const GLResourceHandle handle);
+
+    /// @brief Get how many references to a resource exist.
+    ///
+    /// @param handle Handle to the resource.
+    ///
+    /// @return How many references to the resource exist, 0 if the handle
+    /// is stale.
+    static unsigned int GetRefCount(const GLResourceHandle handle);
+
+    /// @brief Record how many bytes the storage of a resource occupies, and
+    /// that it is resident. Meant to be called by the owner of the resource
+    /// whenever it (re)allocates its storage.
+    ///
+    /// @param handle Handle to the resource.
+    /// @param category Literal describing the kind of memory the resource
+    /// occupies.
+    /// @param bytes How many bytes the storage of the resource occupies.
+    static void SetSize(const GLResourceHandle handle, const GPUMemoryCategory category, const uint64_t bytes);
+
+    /// @brief Get how many bytes the storage of a resource occupies.
+    ///
+    /// @param handle Handle to the resource.
+    ///
+    /// @return How many bytes the storage of the resource occupies, 0 if
+    /// its size is unknown, if it is evicted or if the handle is stale.
+    static uint64_t GetSize(const GLResourceHandle handle);
+
+    /// @brief Set whether the storage of a resource may be evicted when over
+    /// the GPU memory budget. Its owner must then call Touch() before every
+    /// use, and upload the storage again if it was evicted.
+    ///
+    /// @param handle Handle to the resource.
+    /// @param evictable Whether the storage of the resource may be evicted.
+    static void SetEvictable(const GLResourceHandle handle, const bool evictable);
+
+    /// @brief Record that a resource is used during the current frame.
+    ///
+    /// @param handle Handle to the resource.
+    ///
+    /// @return Whether the storage of the resource is resident. If not, it
+    /// was evicted and must be uploaded again before use.
+    static bool Touch(const GLResourceHandle handle);
+
+    /// @brief Evict the storage of evictable resources which were last used
+    /// before a given frame, least recently used first, until enough bytes
+    /// were freed or no candidate remains. Must be called on the thread the
+    /// GL context is current on.
+    ///
+    /// @param bytes How many bytes to free.
+    /// @param unusedSince Frame during which candidates must not have been
+    /// used, nor since.
+    ///
+    /// @return How many bytes were freed.
+    static uint64_t EvictLeastRecentlyUsed(const uint64_t bytes, const uint64_t unusedSince);
+
+    /// @brief Destroy all resources queued for deletion. Must be called on
+    /// the thread the GL context is current on.
+    static void ProcessPendingDeletions();
+};
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__CORE__GL_RESOURCE_REGISTRY_HPP
@@ -0,0 +1,137 @@
+#include "gpu_memory.hpp"
+
+#include <string>
+#include <unordered_map>
+
+#include "gl_resource_registry.hpp"
+
+namespace Renderboi
+{
+
+std::array<std::atomic<uint64_t>, GPUMemory::CategoryCount> GPUMemory::_bytes = {};
+std::array<std::atomic<uint64_t>, GPUMemory::CategoryCount> GPUMemory::_highWaterMarks = {};
+std::array<std::atomic<uint64_t>, GPUMemory::CategoryCount> GPUMemory::_resourceCounts = {};
+std::atomic<uint64_t> GPUMemory::_totalBytes = 0;
+std::atomic<uint64_t> GPUMemory::_totalHighWaterMark = 0;
+std::atomic<uint64_t> GPUMemory::_budget = 0;
+std::atomic<uint64_t> GPUMemory::_frame = 0;
+std::atomic<uint64_t> GPUMemory::_evictedBytes = 0;
+
+void GPUMemory::_RaiseHighWaterMark(std::atomic<uint64_t>& mark, const uint64_t value)
+{
+    uint64_t current = mark.load(std::memory_order_relaxed);
+    while (current < value && !mark.compare_exchange_weak(current, value, std::memory_order_relaxed));
+}
+
+void GPUMemory::Track(const GPUMemoryCategory category, const uint64_t bytes)
+{
+    _resourceCounts[(std::size_t)category].fetch_add(1, std::memory_order_relaxed);
+    Resize(category, 0, bytes);
+}
+
+void GPUMemory::Untrack(const GPUMemoryCategory category, const uint64_t bytes)
+{
+    Resize(category, bytes, 0);
+    _resourceCounts[(std::size_t)category].fetch_sub(1, std::memory_order_relaxed);
+}
+
+void GPUMemory::Resize(const GPUMemoryCategory category, const uint64_t oldBytes, const uint64_t newBytes)
+{
+    const std::size_t index = (std::size_t)category;
+
+    if (newBytes >= oldBytes)
+    {
+        const uint64_t delta = newBytes - oldBytes;
+        _RaiseHighWaterMark(_highWaterMarks[index], _bytes[index].fetch_add(delta, std::memory_order_relaxed) + delta);
+        _RaiseHighWaterMark(_totalHighWaterMark, _totalBytes.fetch_add(delta, std::memory_order_relaxed) + delta);
+    }
+    else
+    {
+        const uint64_t delta = oldBytes - newBytes;
+        _bytes[index].fetch_sub(delta, std::memory_order_relaxed);
+        _totalBytes.fetch_sub(delta, std::memory_order_relaxed);
+    }
+}
+
+GPUMemory::Usage GPUMemory::GetUsage(const GPUMemoryCategory category)
+{
+    const std::size_t index = (std::size_t)category;
+
+    return {
+        _bytes[index].load(std::memory_order_relaxed),
+        _highWaterMarks[index].load(std::memory_order_relaxed),
+        _resourceCounts[index].load(std::memory_order_relaxed)
+    };
+}
+
+GPUMemory::Usage GPUMemory::GetTotalUsage()
+{
+    uint64_t resourceCount = 0;
+    for (const auto& count : _resourceCounts)
+    {
+        resourceCount += count.load(std::memory_order_relaxed);
+    }
+
+    return {
+        _totalBytes.load(std::memory_order_relaxed),
+        _totalHighWaterMark.load(std::memory_order_relaxed),
+        resourceCount
+    };
+}
+
+void GPUMemory::SetBudget(const uint64_t bytes)
+{
+    _budget.store(bytes, std::memory_order_relaxed);
+}
+
+uint64_t GPUMemory::GetBudget()
+{
+    return _budget.load(std::memory_order_relaxed);
+}
+
+uint64_t GPUMemory::GetEvictedBytes()
+{
+    return _evictedBytes.load(std::memory_order_relaxed);
+}
+
+uint64_t GPUMemory::GetFrame()
+{
+    return _frame.load(std::memory_order_relaxed);
+}
+
+uint64_t GPUMemory::EnforceBudget()
+{
+    const uint64_t frame = _frame.fetch_add(1, std::memory_order_relaxed) + 1;
+
+    const uint64_t budget = _budget.load(std::memory_order_relaxed);
+    const uint64_t total = _totalBytes.load(std::memory_order_relaxed);
+    if (!budget || total <= budget) return 0;
+
+    // Resources used during the last frame are likely to be used during
+    // this one, evicting them would only have them uploaded right back
+    const uint64_t evicted = GLResourceRegistry::EvictLeastRecentlyUsed(total - budget, frame - 1);
+    _evictedBytes.fetch_add(evicted, std::memory_order_relaxed);
+
+    return evicted;
+}
+
+std::string to_string(const GPUMemoryCategory category)
+{
+    static bool runOnce = false;
+    static std::unordered_map<GPUMemoryCategory, std::string> _categoryNames;
+
+    if (!runOnce)
+    {
+        _categoryNames[GPUMemoryCategory::Textures]       = "Textures";
+        _categoryNames[GPUMemoryCategory::Meshes]         = "Meshes";
+        _categoryNames[GPUMemoryCategory::UniformBuffers] = "UniformBuffers";
+
+        runOnce = true;
+    }
+
+    auto it = _categoryNames.find(category);
+    return (it != _categoryNames.end()) ?
+        it->second : "Unknown GPU memory category";
+}
+
+}//namespace Renderboi
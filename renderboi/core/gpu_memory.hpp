@@ -0,0 +1,153 @@
+#ifndef RENDERBOI__CORE__GPU_MEMORY_HPP
+#define RENDERBOI__CORE__GPU_MEMORY_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Renderboi
+{
+
+/// @brief Collection of litterals describing the kinds of GPU memory
+/// accounted for by GPUMemory.
+enum class GPUMemoryCategory
+{
+    Textures,
+    Meshes,
+    UniformBuffers
+};
+
+/// @brief Accounts for the GPU memory occupied by the resources registered
+/// in the GLResourceRegistry whose size is known, per category, along with
+/// high-water marks. An optional budget can be set, which is enforced once
+/// per frame by evicting the storage of evictable resources (streamed
+/// textures, mesh levels of detail) which were not used lately, least
+/// recently used first. Evicted resources are uploaded again by their owner
+/// upon their next use.
+class GPUMemory
+{
+public:
+    /// @brief How many categories there are.
+    static constexpr std::size_t CategoryCount = 3;
+
+    /// @brief Memory usage of a category of resources, or of all of them.
+    struct Usage
+    {
+        /// @brief How many bytes are currently occupied.
+        uint64_t bytes;
+
+        /// @brief Highest amount of bytes ever occupied at once.
+        uint64_t highWaterMark;
+
+        /// @brief How many resources are accounted for, whether their
+        /// storage is resident or evicted.
+        uint64_t resourceCount;
+    };
+
+private:
+    /// @brief Usage of each category, indexed by GPUMemoryCategory.
+    static std::array<std::atomic<uint64_t>, CategoryCount> _bytes;
+
+    /// @brief High-water mark of each category, indexed by
+    /// GPUMemoryCategory.
+    static std::array<std::atomic<uint64_t>, CategoryCount> _highWaterMarks;
+
+    /// @brief Resource count of each category, indexed by
+    /// GPUMemoryCategory.
+    static std::array<std::atomic<uint64_t>, CategoryCount> _resourceCounts;
+
+    /// @brief Usage of all categories.
+    static std::atomic<uint64_t> _totalBytes;
+
+    /// @brief High-water mark of all categories.
+    static std::atomic<uint64_t> _totalHighWaterMark;
+
+    /// @brief Budget (in bytes) to enforce, 0 for none.
+    static std::atomic<uint64_t> _budget;
+
+    /// @brief Index of the current frame, used to date resource usage.
+    static std::atomic<uint64_t> _frame;
+
+    /// @brief How many bytes were evicted overall.
+    static std::atomic<uint64_t> _evictedBytes;
+
+    /// @brief Raise a high-water mark up to a value, if it is lower.
+    ///
+    /// @param mark High-water mark to raise.
+    /// @param value Value to raise the mark to.
+    static void _RaiseHighWaterMark(std::atomic<uint64_t>& mark, const uint64_t value);
+
+public:
+    /// @brief Account for a new resource.
+    ///
+    /// @param category Literal describing the kind of memory the resource
+    /// occupies.
+    /// @param bytes How many bytes the resource occupies.
+    static void Track(const GPUMemoryCategory category, const uint64_t bytes);
+
+    /// @brief Stop accounting for a resource.
+    ///
+    /// @param category Literal describing the kind of memory the resource
+    /// occupied.
+    /// @param bytes How many bytes the resource occupied.
+    static void Untrack(const GPUMemoryCategory category, const uint64_t bytes);
+
+    /// @brief Account for a resource changing size, including it being
+    /// evicted or uploaded again.
+    ///
+    /// @param category Literal describing the kind of memory the resource
+    /// occupies.
+    /// @param oldBytes How many bytes the resource occupied.
+    /// @param newBytes How many bytes the resource now occupies.
+    static void Resize(const GPUMemoryCategory category, const uint64_t oldBytes, const uint64_t newBytes);
+
+    /// @brief Get the memory usage of a category.
+    ///
+    /// @param category Literal describing the category.
+    ///
+    /// @return The memory usage of the category.
+    static Usage GetUsage(const GPUMemoryCategory category);
+
+    /// @brief Get the memory usage of all categories.
+    ///
+    /// @return The memory usage of all categories.
+    static Usage GetTotalUsage();
+
+    /// @brief Set the budget to enforce.
+    ///
+    /// @param bytes How many bytes resources may occupy, 0 for no budget.
+    static void SetBudget(const uint64_t bytes);
+
+    /// @brief Get the budget being enforced.
+    ///
+    /// @return How many bytes resources may occupy, 0 if there is no
+    /// budget.
+    static uint64_t GetBudget();
+
+    /// @brief Get how many bytes were evicted overall.
+    ///
+    /// @return How many bytes were evicted overall.
+    static uint64_t GetEvictedBytes();
+
+    /// @brief Get the index of the current frame, which resource usage is
+    /// dated with.
+    ///
+    /// @return The index of the current frame.
+    static uint64_t GetFrame();
+
+    /// @brief Start a new frame and, if over budget, evict resources which
+    /// were not used during the last frame until back under budget or out
+    /// of candidates. Meant to be called once per frame, before drawing, on
+    /// the thread the GL context is current on.
+    ///
+    /// @return How many bytes were evicted.
+    static uint64_t EnforceBudget();
+};
+
+std::string to_string(const GPUMemoryCategory category);
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__CORE__GPU_MEMORY_HPP
@@ -0,0 +1,100 @@
+#include "gpu_profiler.hpp"
+
+#include <stdexcept>
+
+#include <glad/gl.h>
+
+namespace Renderboi
+{
+
+GpuProfiler::Scope::Scope(GpuProfiler& profiler, const char* name) :
+    _profiler(profiler)
+{
+    _profiler.beginZone(name);
+}
+
+GpuProfiler::Scope::~Scope()
+{
+    _profiler.endZone();
+}
+
+GpuProfiler::GpuProfiler(const std::string& trackName, const unsigned int ringSize) :
+    _track(Profiler::CreateTrack(trackName)),
+    _queries(),
+    _queryHandles(),
+    _pendingZones(ringSize),
+    _head(0),
+    _pendingCount(0),
+    _active(false)
+{
+    if (!ringSize)
+    {
+        throw std::runtime_error("GpuProfiler: cannot measure zones with a ring of 0 queries.");
+    }
+}
+
+GpuProfiler::~GpuProfiler()
+{
+    for (const auto& handle : _queryHandles)
+    {
+        GLResourceRegistry::Release(handle);
+    }
+}
+
+void GpuProfiler::beginZone(const char* name)
+{
+    if (_active || !Profiler::Enabled()) return;
+
+    // Drop the zone rather than wait for a query to free up
+    if (_pendingCount == _pendingZones.size()) return;
+
+    if (_queries.empty())
+    {
+        _queries.resize(_pendingZones.size());
+        glGenQueries((GLsizei)_queries.size(), _queries.data());
+        for (const auto& query : _queries)
+        {
+            _queryHandles.push_back(GLResourceRegistry::Register(GLResourceType::Query, query));
+        }
+    }
+
+    const std::size_t index = (_head + _pendingCount) % _queries.size();
+    _pendingZones[index] = {name, Profiler::Clock::now()};
+    glBeginQuery(GL_TIME_ELAPSED, _queries[index]);
+    _active = true;
+}
+
+void GpuProfiler::endZone()
+{
+    if (!_active) return;
+
+    glEndQuery(GL_TIME_ELAPSED);
+    _pendingCount++;
+    _active = false;
+}
+
+void GpuProfiler::collect()
+{
+    while (_pendingCount)
+    {
+        // Results become available in the order queries were issued
+        GLint available = GL_FALSE;
+        glGetQueryObjectiv(_queries[_head], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) break;
+
+        GLuint64 elapsed = 0;
+        glGetQueryObjectui64v(_queries[_head], GL_QUERY_RESULT, &elapsed);
+
+        const _PendingZone& zone = _pendingZones[_head];
+        _track.record({
+            zone.name,
+            zone.start,
+            std::chrono::duration_cast<Profiler::Clock::duration>(std::chrono::nanoseconds(elapsed))
+        });
+
+        _head = (_head + 1) % _queries.size();
+        _pendingCount--;
+    }
+}
+
+}//namespace Renderboi
@@ -0,0 +1,124 @@
+#ifndef RENDERBOI__CORE__GPU_PROFILER_HPP
+#define RENDERBOI__CORE__GPU_PROFILER_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <renderboi/utilities/profiler.hpp>
+
+#include "gl_resource_registry.hpp"
+
+namespace Renderboi
+{
+
+/// @brief Measures the time the GPU spends executing the commands issued
+/// within zones, using GL_TIME_ELAPSED queries, and records the results to
+/// a profiler track. Queries are taken from a ring and their results are
+/// only read once available, so that measuring never stalls the pipeline;
+/// zones started while all queries of the ring are pending are dropped.
+/// GL_TIME_ELAPSED queries cannot be nested, and neither can zones.
+///
+/// Must only be used from the thread owning the GL context. Query objects
+/// are released through the GLResourceRegistry. Zones are best recorded
+/// with the RB_PROFILE_GPU_ZONE macro, which compiles to nothing unless
+/// RENDERBOI_PROFILING is defined.
+class GpuProfiler
+{
+public:
+    /// @brief Default amount of queries in the ring.
+    static constexpr unsigned int DefaultRingSize = 64;
+
+    /// @brief Records the GPU time spent on the commands issued between its
+    /// construction and its destruction as a zone.
+    class Scope
+    {
+    private:
+        /// @brief Profiler the zone is recorded with.
+        GpuProfiler& _profiler;
+
+    public:
+        /// @param profiler Profiler to record the zone with.
+        /// @param name Name of the zone. Must have static storage duration.
+        Scope(GpuProfiler& profiler, const char* name);
+
+        ~Scope();
+
+        Scope(const Scope& other) = delete;
+        Scope& operator=(const Scope& other) = delete;
+    };
+
+private:
+    /// @brief Zone whose query was issued and whose result was not read
+    /// yet.
+    struct _PendingZone
+    {
+        /// @brief Name of the zone.
+        const char* name;
+
+        /// @brief Point in time at which the zone was started on the CPU,
+        /// used as the start of the zone in the trace.
+        Profiler::Clock::time_point start;
+    };
+
+    /// @brief Track to record results to.
+    Profiler::Track& _track;
+
+    /// @brief Names of the GL query objects of the ring, generated on
+    /// first use.
+    std::vector<unsigned int> _queries;
+
+    /// @brief Handles to the query objects of the ring in the resource
+    /// registry.
+    std::vector<GLResourceHandle> _queryHandles;
+
+    /// @brief Zones matching the queries of the ring.
+    std::vector<_PendingZone> _pendingZones;
+
+    /// @brief Index of the oldest pending query in the ring.
+    std::size_t _head;
+
+    /// @brief How many queries are pending.
+    std::size_t _pendingCount;
+
+    /// @brief Whether a zone is started and its query is active.
+    bool _active;
+
+public:
+    /// @param trackName Name of the track to record results to.
+    /// @param ringSize How many queries may be pending at the same time.
+    ///
+    /// @exception If the ring size is 0, the function will throw a
+    /// std::runtime_error.
+    GpuProfiler(const std::string& trackName = "GPU", const unsigned int ringSize = DefaultRingSize);
+
+    ~GpuProfiler();
+
+    GpuProfiler(const GpuProfiler& other) = delete;
+    GpuProfiler& operator=(const GpuProfiler& other) = delete;
+
+    /// @brief Start a zone. Does nothing if the profiler is disabled, if a
+    /// zone is already started, or if no query is free.
+    ///
+    /// @param name Name of the zone. Must have static storage duration.
+    void beginZone(const char* name);
+
+    /// @brief End the started zone, if any.
+    void endZone();
+
+    /// @brief Record the results of all queries which are available, in
+    /// the order they were issued. Meant to be called once per frame.
+    void collect();
+};
+
+}//namespace Renderboi
+
+#ifdef RENDERBOI_PROFILING
+    /// @brief Record the GPU time spent on the rest of the enclosing scope
+    /// as a zone of the provided name (a string litteral).
+    #define RB_PROFILE_GPU_ZONE(profiler, name) ::Renderboi::GpuProfiler::Scope RB_PROFILE_CONCAT(_rbGpuProfilerScope, __LINE__)(profiler, name)
+#else
+    #define RB_PROFILE_GPU_ZONE(profiler, name) ((void)0)
+#endif
+
+#endif//RENDERBOI__CORE__GPU_PROFILER_HPP
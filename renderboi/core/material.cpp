@@ -4,6 +4,8 @@
 
 #include <renderboi/utilities/to_string.hpp>
 
+#include "render_stats.hpp"
+
 #include <cpptools/exceptions/index_out_of_bounds_error.hpp>
 #include <cpptools/exceptions/unmatched_array_size_error.hpp>
 
@@ -142,6 +144,8 @@ void Material::bindTextures() const
     {
         _diffuseMaps[i].bind(DiffuseMapMaxCount + i);
     }
+
+    RenderStats::Count(RenderCounter::TextureBinds, 2 * _diffuseMaps.size());
 }
 
 }//namespace Renderboi
@@ -0,0 +1,33 @@
+#include "material_registry.hpp"
+
+#include <stdexcept>
+
+#include "materials.hpp"
+
+namespace Renderboi
+{
+
+RegistryStorage<Material> MaterialRegistry::_Materials;
+
+MaterialHandle MaterialRegistry::Register(const Material& material)
+{
+    return {_Materials.add(material)};
+}
+
+MaterialHandle MaterialRegistry::GetDefault()
+{
+    static const MaterialHandle Default = Register(Materials::Default);
+    return Default;
+}
+
+const Material& MaterialRegistry::Get(const MaterialHandle handle)
+{
+    if (handle.index >= _Materials.size())
+    {
+        throw std::runtime_error("MaterialRegistry: handle does not refer to a registered material.");
+    }
+
+    return _Materials[handle.index];
+}
+
+}//namespace Renderboi
@@ -0,0 +1,56 @@
+#ifndef RENDERBOI__CORE__MATERIAL_REGISTRY_HPP
+#define RENDERBOI__CORE__MATERIAL_REGISTRY_HPP
+
+#include "material.hpp"
+#include "registry_storage.hpp"
+
+namespace Renderboi
+{
+
+/// @brief Lightweight, trivially copyable reference to a material held in
+/// the MaterialRegistry.
+struct MaterialHandle
+{
+    /// @brief Index of the material in the registry.
+    unsigned int index;
+};
+
+/// @brief Central storage for materials, allowing them to be referred to by
+/// handle. Registered materials are immutable and are never removed, so
+/// that handles remain valid for the lifetime of the program and accessing
+/// a material involves no copy. Materials should thus be registered once
+/// and referred to by handle from then on.
+class MaterialRegistry
+{
+private:
+    /// @brief Storage for registered materials.
+    static RegistryStorage<Material> _Materials;
+
+public:
+    /// @brief Register a material and get a handle to it.
+    ///
+    /// @param material The material to register.
+    ///
+    /// @return A handle to the registered material.
+    static MaterialHandle Register(const Material& material);
+
+    /// @brief Get a handle to the default material (Materials::Default),
+    /// which is registered upon the first call.
+    ///
+    /// @return A handle to the default material.
+    static MaterialHandle GetDefault();
+
+    /// @brief Get a registered material.
+    ///
+    /// @param handle Handle to the material.
+    ///
+    /// @return A const reference to the registered material.
+    ///
+    /// @exception If the handle does not refer to a registered material,
+    /// the function will throw a std::runtime_error.
+    static const Material& Get(const MaterialHandle handle);
+};
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__CORE__MATERIAL_REGISTRY_HPP
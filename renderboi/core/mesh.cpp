@@ -1,20 +1,40 @@
 #include "mesh.hpp"
 
+#include <atomic>
 #include <memory>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
+#include "gl_resource_registry.hpp"
+#include "gpu_memory.hpp"
 #include "material.hpp"
 #include "materials.hpp"
+#include "render_stats.hpp"
 #include "vertex.hpp"
 
 namespace Renderboi
 {
 
-unsigned int Mesh::_count = 0;
-std::unordered_map<unsigned int, unsigned int> Mesh::_arrayRefCount = std::unordered_map<unsigned int, unsigned int>();
-std::unordered_map<unsigned int, unsigned int> Mesh::_bufferRefCount = std::unordered_map<unsigned int, unsigned int>();
+namespace
+{
+
+/// @brief Send the data of a buffer whose storage was evicted to the GPU
+/// again, and account for it.
+void uploadEvictedBuffer(const GLResourceHandle handle, const unsigned int name, const void* data, const GLsizeiptr size)
+{
+    // Use a binding point which no VAO keeps track of
+    glBindBuffer(GL_COPY_WRITE_BUFFER, name);
+    glBufferData(GL_COPY_WRITE_BUFFER, size, data, GL_STATIC_DRAW);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+    GLResourceRegistry::SetSize(handle, GPUMemoryCategory::Meshes, (uint64_t)size);
+    RenderStats::Count(RenderCounter::BytesUploaded, (uint64_t)size);
+}
+
+}//namespace
+
+std::atomic<unsigned int> Mesh::_count = 0;
 
 Mesh::Mesh(unsigned int drawMode, std::vector<Vertex> vertices, std::vector<unsigned int> indices) :
     Mesh(drawMode, vertices, indices, {(unsigned int)indices.size()}, {nullptr})
@@ -29,6 +49,9 @@ Mesh::Mesh(
     const std::vector<unsigned int> primitiveSizes,
     const std::vector<void*> primitiveOffsets
 ) :
+    _vaoHandle(),
+    _vboHandle(),
+    _eboHandle(),
     _drawMode(drawMode),
     _vertices(vertices),
     _indices(indices),
@@ -37,6 +60,8 @@ Mesh::Mesh(
     _vao(0),
     _vbo(0),
     _ebo(0),
+    _boundingSphereCenter(0.f),
+    _boundingSphereRadius(0.f),
     id(_count++)
 {
     if (primitiveSizes.size() != primitiveOffsets.size())
@@ -44,58 +69,66 @@ Mesh::Mesh(
         throw std::runtime_error("Mesh: sizes of provided arrays of primitive info do not match.");
     }
 
-    // Setup resources on the GPU
-    _setupBuffers();
+    _computeBoundingSphere();
 
-    // Create refcounts to resources if non existing, increase it otherwise
-    if (_arrayRefCount.find(_vao) != _arrayRefCount.end())
-        _arrayRefCount[_vao] = 1;
-    else
-        _arrayRefCount[_vao]++;
-
-    if (_bufferRefCount.find(_vbo) != _bufferRefCount.end())
-        _bufferRefCount[_vbo] = 1;
-    else
-        _bufferRefCount[_vbo]++;
+    // Setup buffers on the GPU, the VAO is set up upon first draw
+    _setupBuffers();
 
-    if (_bufferRefCount.find(_ebo) != _bufferRefCount.end())
-        _bufferRefCount[_ebo] = 1;
-    else
-        _bufferRefCount[_ebo]++;
+    // Register resources, each with a single reference
+    _vboHandle = GLResourceRegistry::Register(GLResourceType::Buffer, _vbo);
+    _eboHandle = GLResourceRegistry::Register(GLResourceType::Buffer, _ebo);
+    GLResourceRegistry::SetSize(_vboHandle, GPUMemoryCategory::Meshes, _vertices.size() * sizeof(Vertex));
+    GLResourceRegistry::SetSize(_eboHandle, GPUMemoryCategory::Meshes, _indices.size() * sizeof(unsigned int));
 }
 
 Mesh::Mesh(const Mesh& other) :
+    _vaoHandle(other._vaoHandle),
+    _vboHandle(other._vboHandle),
+    _eboHandle(other._eboHandle),
+    _drawMode(other._drawMode),
     _vertices(other._vertices),
     _indices(other._indices),
-    _drawMode(other._drawMode),
+    _primitiveSizes(other._primitiveSizes),
+    _primitiveOffsets(other._primitiveOffsets),
     _vao(other._vao),
     _vbo(other._vbo),
     _ebo(other._ebo),
+    _boundingSphereCenter(other._boundingSphereCenter),
+    _boundingSphereRadius(other._boundingSphereRadius),
     id(_count++)
 {
     // Copy everything and update refcounts
-    _arrayRefCount[_vao]++;
-    _bufferRefCount[_vbo]++;
-    _bufferRefCount[_ebo]++;
+    if (_vao) GLResourceRegistry::Acquire(_vaoHandle);
+    GLResourceRegistry::Acquire(_vboHandle);
+    GLResourceRegistry::Acquire(_eboHandle);
 }
 
 Mesh& Mesh::operator=(const Mesh& other)
 {
-    // Free current resources
+    if (this == &other) return *this;
 
+    // Free current resources
     _cleanup();
+
     // Copy everything
     _vertices = other._vertices;
     _indices = other._indices;
+    _primitiveSizes = other._primitiveSizes;
+    _primitiveOffsets = other._primitiveOffsets;
     _drawMode = other._drawMode;
     _vao = other._vao;
     _vbo = other._vbo;
     _ebo = other._ebo;
+    _vaoHandle = other._vaoHandle;
+    _vboHandle = other._vboHandle;
+    _eboHandle = other._eboHandle;
+    _boundingSphereCenter = other._boundingSphereCenter;
+    _boundingSphereRadius = other._boundingSphereRadius;
 
     // Update refcounts
-    _arrayRefCount[_vao]++;
-    _bufferRefCount[_vbo]++;
-    _bufferRefCount[_ebo]++;
+    if (_vao) GLResourceRegistry::Acquire(_vaoHandle);
+    GLResourceRegistry::Acquire(_vboHandle);
+    GLResourceRegistry::Acquire(_eboHandle);
 
     return *this;
 }
@@ -108,43 +141,81 @@ Mesh::~Mesh()
 
 void Mesh::_cleanup()
 {
-    // Update all refcounts and delete resources on the GPU if appropriate
-    unsigned int count = --_arrayRefCount[_vao];
-    if (!count)
-    {
-        glDeleteVertexArrays(1, &_vao);
-    }
-    
-    count = --_bufferRefCount[_vbo];
-    if (!count)
+    // Update all refcounts, resources on the GPU are deleted by the registry
+    // once unused
+    if (_vao) GLResourceRegistry::Release(_vaoHandle);
+    GLResourceRegistry::Release(_vboHandle);
+    GLResourceRegistry::Release(_eboHandle);
+}
+
+void Mesh::_computeBoundingSphere()
+{
+    if (_vertices.empty()) return;
+
+    // Center the sphere on the bounding box of the vertices
+    glm::vec3 min = _vertices[0].position;
+    glm::vec3 max = _vertices[0].position;
+    for (const auto& vertex : _vertices)
     {
-        glDeleteBuffers(1, &_vbo);
+        min = glm::min(min, vertex.position);
+        max = glm::max(max, vertex.position);
     }
-    
-    count = --_bufferRefCount[_ebo];
-    if (!count)
+    _boundingSphereCenter = 0.5f * (min + max);
+
+    float radiusSquared = 0.f;
+    for (const auto& vertex : _vertices)
     {
-        glDeleteBuffers(1, &_ebo);
+        const glm::vec3 offset = vertex.position - _boundingSphereCenter;
+        radiusSquared = glm::max(radiusSquared, glm::dot(offset, offset));
     }
+    _boundingSphereRadius = glm::sqrt(radiusSquared);
 }
 
 void Mesh::_setupBuffers()
 {
-    // Generate arrays and buffers on the GPU
-    glGenVertexArrays(1, &_vao);
+    // Generate buffers on the GPU
     glGenBuffers(1, &_vbo);
     glGenBuffers(1, &_ebo);
-  
-    // Bind VAO
-    glBindVertexArray(_vao);
 
-    // Bind VBO and send vertex data
-    glBindBuffer(GL_ARRAY_BUFFER, _vbo);
-    glBufferData(GL_ARRAY_BUFFER, _vertices.size() * sizeof(Vertex), &_vertices[0], GL_STATIC_DRAW);  
+    // Send vertex and index data through a binding point which no VAO keeps
+    // track of: binding the EBO as an element array buffer would attach it
+    // to whichever VAO was bound last
+    glBindBuffer(GL_COPY_WRITE_BUFFER, _vbo);
+    glBufferData(GL_COPY_WRITE_BUFFER, _vertices.size() * sizeof(Vertex), &_vertices[0], GL_STATIC_DRAW);
+
+    glBindBuffer(GL_COPY_WRITE_BUFFER, _ebo);
+    glBufferData(GL_COPY_WRITE_BUFFER, _indices.size() * sizeof(unsigned int), &_indices[0], GL_STATIC_DRAW);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+}
+
+void Mesh::_restoreEvictedBuffers()
+{
+    if (!GLResourceRegistry::Touch(_vboHandle))
+    {
+        uploadEvictedBuffer(_vboHandle, _vbo, &_vertices[0], _vertices.size() * sizeof(Vertex));
+    }
 
-    // Bind EBO and send index data
+    if (!GLResourceRegistry::Touch(_eboHandle))
+    {
+        uploadEvictedBuffer(_eboHandle, _ebo, &_indices[0], _indices.size() * sizeof(unsigned int));
+    }
+}
+
+void Mesh::_setVertexBufferSize(const uint64_t bytes)
+{
+    GLResourceRegistry::SetSize(_vboHandle, GPUMemoryCategory::Meshes, bytes);
+}
+
+void Mesh::_setupVertexArray()
+{
+    // Generate array on the GPU and register it with a single reference
+    glGenVertexArrays(1, &_vao);
+    _vaoHandle = GLResourceRegistry::Register(GLResourceType::VertexArray, _vao);
+
+    // Bind VAO, then buffers so that the VAO keeps track of them
+    glBindVertexArray(_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, _vbo);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _ebo);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, _indices.size() * sizeof(unsigned int), &_indices[0], GL_STATIC_DRAW);
 
     // Setup vertex attributes:
 
@@ -165,10 +236,23 @@ void Mesh::_setupBuffers()
     glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, texCoord));
 }
 
+void Mesh::_bindVertexArray()
+{
+    if (!_vao)
+    {
+        _setupVertexArray();
+    }
+    else
+    {
+        glBindVertexArray(_vao);
+    }
+}
+
 void Mesh::draw()
 {
     // Draw mesh
-    glBindVertexArray(_vao);
+    _restoreEvictedBuffers();
+    _bindVertexArray();
     glMultiDrawElements(
         _drawMode, 
         (GLsizei*) &(_primitiveSizes[0]), 
@@ -176,6 +260,48 @@ void Mesh::draw()
         (void* const*) &(_primitiveOffsets[0]), 
         (GLsizei) _primitiveSizes.size()
     );
+    RenderStats::Count(RenderCounter::DrawCalls);
+}
+
+void Mesh::setEvictable(const bool evictable)
+{
+    GLResourceRegistry::SetEvictable(_vboHandle, evictable);
+    GLResourceRegistry::SetEvictable(_eboHandle, evictable);
+}
+
+unsigned int Mesh::getDrawMode() const
+{
+    return _drawMode;
+}
+
+const std::vector<Vertex>& Mesh::getVertices() const
+{
+    return _vertices;
+}
+
+const std::vector<unsigned int>& Mesh::getIndices() const
+{
+    return _indices;
+}
+
+const std::vector<unsigned int>& Mesh::getPrimitiveSizes() const
+{
+    return _primitiveSizes;
+}
+
+const std::vector<void*>& Mesh::getPrimitiveOffsets() const
+{
+    return _primitiveOffsets;
+}
+
+glm::vec3 Mesh::getBoundingSphereCenter() const
+{
+    return _boundingSphereCenter;
+}
+
+float Mesh::getBoundingSphereRadius() const
+{
+    return _boundingSphereRadius;
 }
 
 }//namespace Renderboi
@@ -1,12 +1,17 @@
 #ifndef RENDERBOI__CORE__MESH_HPP
 #define RENDERBOI__CORE__MESH_HPP
 
+#include <atomic>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <memory>
 
 #include <glad/gl.h>
 
+#include <glm/glm.hpp>
+
+#include "gl_resource_registry.hpp"
 #include "material.hpp"
 #include "vertex.hpp"
 
@@ -18,20 +23,25 @@ using MeshPtr = std::shared_ptr<Mesh>;
 using MeshWPtr = std::weak_ptr<Mesh>;
 
 /// @brief A mesh holding vertices to be rendered using indexed drawing.
+/// Vertex data is sent to the GPU upon construction, which may thus happen
+/// on any thread whose GL context shares objects with the rendering context
+/// (see UploadService). The VAO, which cannot be shared between contexts, 
+/// is set up upon first draw.
 class Mesh
 {
 private:
     /// @brief Keeps track of how many instances were created (used as a 
     /// unique ID system).
-    static unsigned int _count;
+    static std::atomic<unsigned int> _count;
+
+    /// @brief Handle to the VAO in the GPU resource registry.
+    GLResourceHandle _vaoHandle;
 
-    /// @brief Map storing how many mesh instances are referencing a VAO 
-    /// resource on the GPU (VAO ID => reference count).
-    static std::unordered_map<unsigned int, unsigned int> _arrayRefCount;
+    /// @brief Handle to the VBO in the GPU resource registry.
+    GLResourceHandle _vboHandle;
 
-    /// @brief Map storing how many mesh instances are referencing a VBO 
-    /// resource on the GPU (VBO ID => reference count).
-    static std::unordered_map<unsigned int, unsigned int> _bufferRefCount;
+    /// @brief Handle to the EBO in the GPU resource registry.
+    GLResourceHandle _eboHandle;
 
     /// @brief Free resources before instance destruction.
     void _cleanup();
@@ -39,6 +49,16 @@ private:
     /// @brief Send vertex data to the GPU.
     void _setupBuffers();
 
+    /// @brief Send vertex data to the GPU again if it was evicted, and
+    /// record that the mesh is being used.
+    void _restoreEvictedBuffers();
+
+    /// @brief Create the VAO and set up vertex attributes in it.
+    void _setupVertexArray();
+
+    /// @brief Compute a sphere enclosing all vertices of the mesh.
+    void _computeBoundingSphere();
+
 protected:
     /// @brief Draw policy to use when drawing.
     unsigned int _drawMode;
@@ -64,6 +84,23 @@ protected:
     /// @brief Handle to the EBO on the GPU.
     unsigned int _ebo;
 
+    /// @brief Center of a sphere enclosing all vertices of the mesh, in 
+    /// object space.
+    glm::vec3 _boundingSphereCenter;
+
+    /// @brief Radius of a sphere enclosing all vertices of the mesh, in 
+    /// object space.
+    float _boundingSphereRadius;
+
+    /// @brief Bind the VAO of the mesh, setting it up first if needed.
+    void _bindVertexArray();
+
+    /// @brief Record how many bytes the vertex buffer occupies on the GPU,
+    /// for derived classes which reallocate it.
+    ///
+    /// @param bytes How many bytes the vertex buffer occupies.
+    void _setVertexBufferSize(const uint64_t bytes);
+
 public:
     Mesh(const Mesh& other);
 
@@ -85,12 +122,58 @@ public:
         const std::vector<void*> primitiveOffsets
     );
 
-    ~Mesh();
+    virtual ~Mesh();
 
     Mesh& operator=(const Mesh& other);
 
     /// @brief Issue GPU draw commands.
-    void draw();
+    virtual void draw();
+
+    /// @brief Set whether the vertex data of the mesh may be evicted from
+    /// the GPU when over the GPU memory budget, to be sent again the next
+    /// time the mesh is drawn. Meant for meshes which are not drawn every
+    /// frame, such as coarse levels of detail. Applies to all copies of the
+    /// mesh.
+    ///
+    /// @param evictable Whether the vertex data of the mesh may be evicted.
+    virtual void setEvictable(const bool evictable);
+
+    /// @brief Get the draw policy used when drawing the mesh.
+    ///
+    /// @return The draw policy used when drawing the mesh.
+    unsigned int getDrawMode() const;
+
+    /// @brief Get the vertices the mesh is made of.
+    ///
+    /// @return A reference to the array of vertices of the mesh.
+    const std::vector<Vertex>& getVertices() const;
+
+    /// @brief Get the vertex indices telling how to draw the mesh.
+    ///
+    /// @return A reference to the array of indices of the mesh.
+    const std::vector<unsigned int>& getIndices() const;
+
+    /// @brief Get the sizes of the different strips contained within 
+    /// indices.
+    ///
+    /// @return A reference to the array of primitive sizes of the mesh.
+    const std::vector<unsigned int>& getPrimitiveSizes() const;
+
+    /// @brief Get the byte offsets at which primitives start within indices.
+    ///
+    /// @return A reference to the array of primitive offsets of the mesh.
+    const std::vector<void*>& getPrimitiveOffsets() const;
+
+    /// @brief Get the center of a sphere enclosing all vertices of the mesh.
+    ///
+    /// @return The center of the bounding sphere, in object space.
+    glm::vec3 getBoundingSphereCenter() const;
+
+    /// @brief Get the radius of a sphere enclosing all vertices of the mesh.
+    ///
+    /// @return The radius of the bounding sphere, in object space. May be
+    /// infinite if the vertices of the mesh are not known to stay in place.
+    float getBoundingSphereRadius() const;
 
     /// @brief ID of the Mesh instance.
     const unsigned int id;
@@ -0,0 +1,131 @@
+#ifndef RENDERBOI__CORE__REGISTRY_STORAGE_HPP
+#define RENDERBOI__CORE__REGISTRY_STORAGE_HPP
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace Renderboi
+{
+
+/// @brief Append-only container handing out stable indices to the elements
+/// it holds. Elements are laid out in fixed-size chunks which are never
+/// reallocated, so that references to them remain valid for the lifetime of
+/// the container. Appending is thread-safe; reading an element whose index
+/// was obtained from a completed append requires no locking.
+///
+/// @tparam T Type of the elements to store.
+template<typename T>
+class RegistryStorage
+{
+public:
+    /// @brief Amount of elements held by a single chunk.
+    static constexpr unsigned int ChunkSize = 256;
+
+    /// @brief Maximum amount of chunks the container can allocate.
+    static constexpr unsigned int MaxChunkCount = 1024;
+
+private:
+    RegistryStorage(const RegistryStorage<T>& other) = delete;
+    RegistryStorage<T>& operator=(const RegistryStorage<T>& other) = delete;
+
+    /// @brief Chunks holding the elements. Each chunk has its capacity
+    /// reserved upon allocation, so that its elements never move.
+    std::array<std::unique_ptr<std::vector<T>>, MaxChunkCount> _chunks;
+
+    /// @brief Amount of elements in the container.
+    std::atomic<unsigned int> _size;
+
+    /// @brief Mutex used to serialize appends.
+    std::mutex _mutex;
+
+public:
+    RegistryStorage();
+
+    /// @brief Append an element to the container.
+    ///
+    /// @param element The element to append.
+    ///
+    /// @return The index of the appended element.
+    ///
+    /// @exception If the container is full, the function will throw a
+    /// std::runtime_error.
+    unsigned int add(const T& element);
+
+    /// @brief Get the element at a given index. No bounds checking is done.
+    ///
+    /// @param index Index of the element to get.
+    ///
+    /// @return A reference to the element.
+    T& operator[](const unsigned int index);
+
+    /// @brief Get the element at a given index. No bounds checking is done.
+    ///
+    /// @param index Index of the element to get.
+    ///
+    /// @return A const reference to the element.
+    const T& operator[](const unsigned int index) const;
+
+    /// @brief Get the amount of elements in the container.
+    ///
+    /// @return The amount of elements in the container.
+    unsigned int size() const;
+};
+
+template<typename T>
+RegistryStorage<T>::RegistryStorage() :
+    _chunks(),
+    _size(0),
+    _mutex()
+{
+
+}
+
+template<typename T>
+unsigned int RegistryStorage<T>::add(const T& element)
+{
+    std::unique_lock lock(_mutex);
+
+    const unsigned int index = _size.load(std::memory_order_relaxed);
+    const unsigned int chunk = index / ChunkSize;
+    if (chunk >= MaxChunkCount)
+    {
+        throw std::runtime_error("RegistryStorage: cannot add element as storage is full.");
+    }
+
+    if (!_chunks[chunk])
+    {
+        _chunks[chunk] = std::make_unique<std::vector<T>>();
+        _chunks[chunk]->reserve(ChunkSize);
+    }
+    _chunks[chunk]->push_back(element);
+
+    // Publish the element only once it is fully constructed
+    _size.store(index + 1, std::memory_order_release);
+    return index;
+}
+
+template<typename T>
+T& RegistryStorage<T>::operator[](const unsigned int index)
+{
+    return (*_chunks[index / ChunkSize])[index % ChunkSize];
+}
+
+template<typename T>
+const T& RegistryStorage<T>::operator[](const unsigned int index) const
+{
+    return (*_chunks[index / ChunkSize])[index % ChunkSize];
+}
+
+template<typename T>
+unsigned int RegistryStorage<T>::size() const
+{
+    return _size.load(std::memory_order_acquire);
+}
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__CORE__REGISTRY_STORAGE_HPP
@@ -0,0 +1,242 @@
+#include "render_stats.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Renderboi
+{
+
+std::array<std::atomic<uint64_t>, RenderStats::CounterCount> RenderStats::_counters = {};
+std::mutex RenderStats::_historyMutex = std::mutex();
+std::vector<RenderStats::Frame> RenderStats::_history = std::vector<RenderStats::Frame>();
+uint64_t RenderStats::_frameIndex = 0;
+RenderStats::Clock::time_point RenderStats::_lastFrameEnd = RenderStats::Clock::time_point();
+
+void RenderStats::Count(const RenderCounter counter, const uint64_t amount)
+{
+    _counters[(std::size_t)counter].fetch_add(amount, std::memory_order_relaxed);
+}
+
+void RenderStats::EndFrame()
+{
+    const Clock::time_point now = Clock::now();
+
+    Frame frame;
+    for (std::size_t i = 0; i < CounterCount; i++)
+    {
+        frame.counters[i] = _counters[i].exchange(0, std::memory_order_relaxed);
+    }
+
+    std::lock_guard lock(_historyMutex);
+    frame.index = _frameIndex++;
+    frame.frameTime = (_lastFrameEnd == Clock::time_point()) ? 0.0 :
+        std::chrono::duration<double, std::milli>(now - _lastFrameEnd).count();
+    _lastFrameEnd = now;
+
+    if (_history.size() < HistorySize)
+    {
+        _history.push_back(frame);
+    }
+    else
+    {
+        _history[frame.index % HistorySize] = frame;
+    }
+}
+
+void RenderStats::Reset()
+{
+    std::lock_guard lock(_historyMutex);
+    for (auto& counter : _counters)
+    {
+        counter.store(0, std::memory_order_relaxed);
+    }
+
+    _history.clear();
+    _frameIndex = 0;
+    _lastFrameEnd = Clock::time_point();
+}
+
+RenderStats::Frame RenderStats::GetLastFrame()
+{
+    std::lock_guard lock(_historyMutex);
+    if (_history.empty()) return Frame();
+
+    return _history[(_frameIndex - 1) % HistorySize];
+}
+
+std::vector<RenderStats::Frame> RenderStats::GetHistory()
+{
+    std::lock_guard lock(_historyMutex);
+    return _OrderedHistory();
+}
+
+RenderStats::Summary RenderStats::Summarize(const RenderCounter counter)
+{
+    std::vector<double> values;
+    {
+        std::lock_guard lock(_historyMutex);
+        values.reserve(_history.size());
+        for (const auto& frame : _history)
+        {
+            values.push_back((double)frame.counters[(std::size_t)counter]);
+        }
+    }
+
+    return _Summarize(values);
+}
+
+RenderStats::Summary RenderStats::SummarizeFrameTime()
+{
+    std::vector<double> values;
+    {
+        std::lock_guard lock(_historyMutex);
+        values.reserve(_history.size());
+        for (const auto& frame : _history)
+        {
+            values.push_back(frame.frameTime);
+        }
+    }
+
+    return _Summarize(values);
+}
+
+void RenderStats::Export(const std::filesystem::path& path)
+{
+    std::ofstream stream(path);
+    if (!stream)
+    {
+        throw std::runtime_error("RenderStats: could not open \"" + path.string() + "\" for writing.");
+    }
+
+    const std::vector<Frame> frames = GetHistory();
+    stream << std::fixed << std::setprecision(3);
+
+    if (path.extension() == ".csv")
+    {
+        stream << "Frame,FrameTime";
+        for (std::size_t i = 0; i < CounterCount; i++)
+        {
+            stream << ',' << to_string((RenderCounter)i);
+        }
+        stream << '\n';
+
+        for (const auto& frame : frames)
+        {
+            stream << frame.index << ',' << frame.frameTime;
+            for (const auto& value : frame.counters)
+            {
+                stream << ',' << value;
+            }
+            stream << '\n';
+        }
+    }
+    else
+    {
+        const auto writeSummary = [&stream](const std::string& name, const Summary& summary)
+        {
+            stream << "\"" << name << "\":{"
+                   << "\"mean\":" << summary.mean
+                   << ",\"median\":" << summary.median
+                   << ",\"p95\":" << summary.p95
+                   << ",\"p99\":" << summary.p99
+                   << ",\"max\":" << summary.max << "}";
+        };
+
+        stream << "{\"summary\":{\n";
+        writeSummary("FrameTime", SummarizeFrameTime());
+        for (std::size_t i = 0; i < CounterCount; i++)
+        {
+            stream << ",\n";
+            writeSummary(to_string((RenderCounter)i), Summarize((RenderCounter)i));
+        }
+        stream << "\n},\"frames\":[";
+
+        bool first = true;
+        for (const auto& frame : frames)
+        {
+            stream << (first ? "\n" : ",\n");
+            stream << "{\"Frame\":" << frame.index << ",\"FrameTime\":" << frame.frameTime;
+            for (std::size_t i = 0; i < CounterCount; i++)
+            {
+                stream << ",\"" << to_string((RenderCounter)i) << "\":" << frame.counters[i];
+            }
+            stream << "}";
+            first = false;
+        }
+        stream << "\n]}\n";
+    }
+
+    if (!stream)
+    {
+        throw std::runtime_error("RenderStats: failed to write \"" + path.string() + "\".");
+    }
+}
+
+RenderStats::Summary RenderStats::_Summarize(std::vector<double>& values)
+{
+    if (values.empty()) return Summary();
+
+    std::sort(values.begin(), values.end());
+
+    // Nearest-rank percentiles
+    const auto percentile = [&values](const double p)
+    {
+        const std::size_t rank = (std::size_t)std::ceil(p * (double)values.size());
+        return values[std::max<std::size_t>(rank, 1) - 1];
+    };
+
+    double sum = 0.0;
+    for (const double value : values) sum += value;
+
+    return {
+        sum / (double)values.size(),
+        percentile(0.5),
+        percentile(0.95),
+        percentile(0.99),
+        values.back()
+    };
+}
+
+std::vector<RenderStats::Frame> RenderStats::_OrderedHistory()
+{
+    if (_history.size() < HistorySize) return _history;
+
+    // The ring is full: the oldest frame is the one to be overwritten next
+    std::vector<Frame> frames;
+    frames.reserve(HistorySize);
+    const std::size_t oldest = _frameIndex % HistorySize;
+    frames.insert(frames.end(), _history.begin() + oldest, _history.end());
+    frames.insert(frames.end(), _history.begin(), _history.begin() + oldest);
+    return frames;
+}
+
+std::string to_string(const RenderCounter counter)
+{
+    static bool runOnce = false;
+    static std::unordered_map<RenderCounter, std::string> _counterNames;
+
+    if (!runOnce)
+    {
+        _counterNames[RenderCounter::DrawCalls]       = "DrawCalls";
+        _counterNames[RenderCounter::ProgramSwitches] = "ProgramSwitches";
+        _counterNames[RenderCounter::TextureBinds]    = "TextureBinds";
+        _counterNames[RenderCounter::UboUploads]      = "UboUploads";
+        _counterNames[RenderCounter::BytesUploaded]   = "BytesUploaded";
+        _counterNames[RenderCounter::DrawnObjects]    = "DrawnObjects";
+        _counterNames[RenderCounter::CulledObjects]   = "CulledObjects";
+
+        runOnce = true;
+    }
+
+    auto it = _counterNames.find(counter);
+    return (it != _counterNames.end()) ?
+        it->second : "Unknown render counter";
+}
+
+}//namespace Renderboi
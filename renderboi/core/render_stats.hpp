@@ -0,0 +1,153 @@
+#ifndef RENDERBOI__CORE__RENDER_STATS_HPP
+#define RENDERBOI__CORE__RENDER_STATS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Renderboi
+{
+
+/// @brief Collection of litterals describing the quantities counted by
+/// RenderStats over a frame.
+enum class RenderCounter
+{
+    DrawCalls,
+    ProgramSwitches,
+    TextureBinds,
+    UboUploads,
+    BytesUploaded,
+    DrawnObjects,
+    CulledObjects
+};
+
+/// @brief Counts what rendering frames costs (draw calls, state changes,
+/// uploads, culled objects), frame by frame. Counters may be incremented
+/// from any thread; the counts of a frame are closed with EndFrame() and
+/// kept in a rolling history of the last HistorySize frames, over which
+/// averages and percentiles are computed. The history can be exported as
+/// CSV or JSON.
+class RenderStats
+{
+public:
+    /// @brief How many counters there are.
+    static constexpr std::size_t CounterCount = 7;
+
+    /// @brief How many frames are kept in the history.
+    static constexpr std::size_t HistorySize = 1024;
+
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief Counts of a single frame.
+    struct Frame
+    {
+        /// @brief Index of the frame since the statistics were last reset.
+        uint64_t index;
+
+        /// @brief Time (in milliseconds) elapsed since the previous frame
+        /// ended. 0 for the first frame.
+        double frameTime;
+
+        /// @brief Value of each counter, indexed by RenderCounter.
+        std::array<uint64_t, CounterCount> counters;
+    };
+
+    /// @brief Summary of the values of a quantity over the history.
+    struct Summary
+    {
+        double mean;
+        double median;
+        double p95;
+        double p99;
+        double max;
+    };
+
+private:
+    /// @brief Counts of the frame in progress.
+    static std::array<std::atomic<uint64_t>, CounterCount> _counters;
+
+    /// @brief Guards the history and frame timing.
+    static std::mutex _historyMutex;
+
+    /// @brief Counts of the last frames, used as a ring.
+    static std::vector<Frame> _history;
+
+    /// @brief Index of the next frame to be closed.
+    static uint64_t _frameIndex;
+
+    /// @brief Point in time at which the last frame was closed.
+    static Clock::time_point _lastFrameEnd;
+
+    /// @brief Summarize values, sorting them along the way.
+    ///
+    /// @param values Values to summarize.
+    ///
+    /// @return A summary of the values.
+    static Summary _Summarize(std::vector<double>& values);
+
+    /// @brief Get the frames of the history in chronological order. Must be
+    /// called with the history mutex locked.
+    ///
+    /// @return The frames of the history, oldest first.
+    static std::vector<Frame> _OrderedHistory();
+
+public:
+    /// @brief Add to a counter of the frame in progress.
+    ///
+    /// @param counter Literal describing which counter to add to.
+    /// @param amount Amount to add.
+    static void Count(const RenderCounter counter, const uint64_t amount = 1);
+
+    /// @brief Close the frame in progress and move its counts to the
+    /// history. Meant to be called once per frame, after buffers are
+    /// swapped.
+    static void EndFrame();
+
+    /// @brief Discard the history and the counts of the frame in progress.
+    static void Reset();
+
+    /// @brief Get the counts of the last closed frame.
+    ///
+    /// @return The counts of the last closed frame, all zero if no frame
+    /// was closed.
+    static Frame GetLastFrame();
+
+    /// @brief Get the frames of the history in chronological order.
+    ///
+    /// @return The frames of the history, oldest first.
+    static std::vector<Frame> GetHistory();
+
+    /// @brief Summarize the values of a counter over the history.
+    ///
+    /// @param counter Literal describing which counter to summarize.
+    ///
+    /// @return A summary of the values of the counter.
+    static Summary Summarize(const RenderCounter counter);
+
+    /// @brief Summarize frame times over the history.
+    ///
+    /// @return A summary of frame times.
+    static Summary SummarizeFrameTime();
+
+    /// @brief Write the history to a file, as CSV (one row per frame) if
+    /// the file has a .csv extension, or as JSON (summaries and frames)
+    /// otherwise.
+    ///
+    /// @param path Path to the file to write.
+    ///
+    /// @exception If the file cannot be written, the function will throw a
+    /// std::runtime_error.
+    static void Export(const std::filesystem::path& path);
+};
+
+std::string to_string(const RenderCounter counter);
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__CORE__RENDER_STATS_HPP
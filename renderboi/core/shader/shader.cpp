@@ -5,44 +5,47 @@
 
 #include <glad/gl.h>
 
+#include "../gl_resource_registry.hpp"
+
 namespace Renderboi
 {
 
-std::unordered_map<unsigned int, unsigned int> Shader::_locationRefCounts = std::unordered_map<unsigned int, unsigned int>();
-
 Shader::Shader(unsigned int location, ShaderStage stage, const std::vector<ShaderFeature> supportedFeatures) :
     _location(location),
     _stage(stage),
-    _supportedFeatures(supportedFeatures)
+    _supportedFeatures(supportedFeatures),
+    _handle()
 {
     if (!location)
     {
         throw std::runtime_error("Shader: cannot create object wrapping no resource on the GPU (location == 0).");
     }
 
-    auto it = _locationRefCounts.find(location);
-    if (it == _locationRefCounts.end()) _locationRefCounts[location] = 0;
-
-    _locationRefCounts[location]++;
+    _handle = GLResourceRegistry::Register(GLResourceType::Shader, location);
 }
 
 Shader::Shader(const Shader& other) :
     _location(other._location),
     _stage(other._stage),
-    _supportedFeatures(other._supportedFeatures)
+    _supportedFeatures(other._supportedFeatures),
+    _handle(other._handle)
 {
-    _locationRefCounts[_location]++;
+    GLResourceRegistry::Acquire(_handle);
 }
 
 Shader& Shader::operator=(const Shader& other)
 {
+    if (this == &other) return *this;
+
     // Let go of content currently in place
     _cleanup();
 
     // Copy the location, program key, increase refcount
     _location = other._location;
     _stage = other._stage;
-    _locationRefCounts[_location]++;
+    _supportedFeatures = other._supportedFeatures;
+    _handle = other._handle;
+    GLResourceRegistry::Acquire(_handle);
 
     return *this;
 }
@@ -55,13 +58,9 @@ Shader::~Shader()
 
 void Shader::_cleanup()
 {
-    // Decrease the ref count
-    unsigned int count = --_locationRefCounts[_location];
-    // If refcount is zero, destroy resource on the GPU
-    if (!count)
-    {
-        glDeleteShader(_location);
-    };
+    // Decrease the ref count, the resource on the GPU is deleted by the 
+    // registry once unused
+    GLResourceRegistry::Release(_handle);
 }
 
 unsigned int Shader::location() const
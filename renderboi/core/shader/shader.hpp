@@ -1,11 +1,11 @@
 #ifndef RENDERBOI__CORE__SHADER__SHADER_HPP
 #define RENDERBOI__CORE__SHADER__SHADER_HPP
 
-#include <unordered_map>
 #include <vector>
 
 #include "shader_feature.hpp"
 #include "shader_stage.hpp"
+#include "../gl_resource_registry.hpp"
 
 namespace Renderboi
 {
@@ -35,9 +35,8 @@ class Shader
         /// program supports.
         std::vector<ShaderFeature> _supportedFeatures;
 
-        /// @brief Structure mapping how many shader instances are referencing a
-        /// shader resource on the GPU.
-        static std::unordered_map<unsigned int, unsigned int> _locationRefCounts;
+        /// @brief Handle to the shader in the GPU resource registry.
+        GLResourceHandle _handle;
 
         /// @brief Free resources upon destroying an instance.
         void _cleanup();
@@ -16,6 +16,7 @@
 
 #include <glad/gl.h>
 
+#include <renderboi/utilities/profiler.hpp>
 #include <renderboi/utilities/to_string.hpp>
 #include <renderboi/utilities/resource_locator.hpp>
 
@@ -39,6 +40,8 @@ ShaderProgram ShaderBuilder::MinimalShaderProgram()
 
 ShaderProgram ShaderBuilder::BuildShaderProgramFromConfig(const ShaderConfig& config, const bool dumpSource)
 {
+    RB_PROFILE_ZONE("ShaderBuilder::BuildShaderProgramFromConfig");
+
     const std::vector<ShaderFeature>& Features = config.getRequestedFeatures();
     std::unordered_set<ShaderStage> requestedStages;
 
@@ -73,6 +76,8 @@ ShaderProgram ShaderBuilder::BuildShaderProgramFromConfig(const ShaderConfig& co
 
 ShaderProgram ShaderBuilder::LinkShaders(const std::vector<Shader>& shaders)
 {
+    RB_PROFILE_ZONE("ShaderBuilder::LinkShaders");
+
     std::unordered_set<ShaderStage> presentStages;
     std::vector<unsigned int> locations;
 
@@ -191,6 +196,8 @@ Shader ShaderBuilder::BuildShaderStageFromText(
     const std::vector<ShaderFeature>& supportedFeatures,
     const bool dumpSource)
 {
+    RB_PROFILE_ZONE("ShaderBuilder::BuildShaderStageFromText");
+
     // In case the shader makes use of #include directives, process them
     _ProcessIncludeDirectives(text);
 
@@ -1,6 +1,7 @@
 #include "shader_program.hpp"
 
 #include <algorithm>
+#include <mutex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -11,6 +12,7 @@
 #include <renderboi/utilities/to_string.hpp>
 
 #include "shader_feature.hpp"
+#include "../gl_resource_registry.hpp"
 
 namespace Renderboi
 {
@@ -18,41 +20,42 @@ namespace Renderboi
 std::unordered_map<unsigned int, std::unordered_map<std::string, unsigned int>>
 ShaderProgram::_uniformLocations = std::unordered_map<unsigned int, std::unordered_map<std::string, unsigned int>>();
 
-std::unordered_map<unsigned int, unsigned int>
-ShaderProgram::_locationRefCounts = std::unordered_map<unsigned int, unsigned int>();
+std::mutex ShaderProgram::_uniformLocationMutex;
 
 ShaderProgram::ShaderProgram(const unsigned int location, const std::vector<ShaderFeature> supportedFeatures) :
     _location(location),
-    _supportedFeatures(supportedFeatures)
+    _supportedFeatures(supportedFeatures),
+    _handle()
 {
     if (!location)
     {
         throw std::runtime_error("ShaderProgram: cannot create object wrapping no resource on the GPU (location == 0).");
     }
 
-    auto it = _locationRefCounts.find(location);
-    if (it == _locationRefCounts.end()) _locationRefCounts[location] = 0;
-
-    _locationRefCounts[location]++;
+    _handle = GLResourceRegistry::Register(GLResourceType::Program, location);
 }
 
-ShaderProgram::ShaderProgram(const ShaderProgram& other)
+ShaderProgram::ShaderProgram(const ShaderProgram& other) :
+    _location(other._location),
+    _supportedFeatures(other._supportedFeatures),
+    _handle(other._handle)
 {
-    // Copy the location, program key, increase refcount
-    _location = other._location;
-    _supportedFeatures = other._supportedFeatures;
-    _locationRefCounts[_location]++;
+    // Increase refcount
+    GLResourceRegistry::Acquire(_handle);
 }
 
 ShaderProgram& ShaderProgram::operator=(const ShaderProgram& other)
 {
+    if (this == &other) return *this;
+
     // Let go of content currently in place
     _cleanup();
 
     // Copy the location, program key, increase refcount
     _location = other._location;
     _supportedFeatures = other._supportedFeatures;
-    _locationRefCounts[_location]++;
+    _handle = other._handle;
+    GLResourceRegistry::Acquire(_handle);
 
     return *this;
 }
@@ -65,14 +68,14 @@ ShaderProgram::~ShaderProgram()
 
 void ShaderProgram::_cleanup()
 {
-    // Decrease the ref count
-    unsigned int count = --_locationRefCounts[_location];
-    // If refcount is zero, destroy resource on the GPU
-    if (!count)
+    // Decrease the ref count, the resource on the GPU is deleted by the 
+    // registry once unused. Its location cannot be handed out again before
+    // then, so cached uniform locations can safely be dropped right away.
+    if (GLResourceRegistry::Release(_handle))
     {
+        std::unique_lock lock(_uniformLocationMutex);
         _uniformLocations.erase(_location);
-        glDeleteProgram(_location);
-    };
+    }
 }
 
 unsigned int ShaderProgram::location() const
@@ -87,6 +90,8 @@ void ShaderProgram::use() const
 
 unsigned int ShaderProgram::getUniformLocation(const std::string& name) const
 {
+    std::unique_lock lock(_uniformLocationMutex);
+
     // First find the program ID in the location hash map
     auto it = _uniformLocations.find(_location);
     if (it != _uniformLocations.end())
@@ -208,6 +213,57 @@ void ShaderProgram::setMaterial(const std::string& name, const Material& value)
     setUint(name + ".specularMapCount", count);
 }
 
+ShaderProgram::MaterialUniformLocations ShaderProgram::getMaterialUniformLocations(const std::string& name) const
+{
+    MaterialUniformLocations locations;
+    locations.ambient = getUniformLocation(name + ".ambient");
+    locations.diffuse = getUniformLocation(name + ".diffuse");
+    locations.specular = getUniformLocation(name + ".specular");
+    locations.shininess = getUniformLocation(name + ".shininess");
+    locations.diffuseMapCount = getUniformLocation(name + ".diffuseMapCount");
+    locations.specularMapCount = getUniformLocation(name + ".specularMapCount");
+
+    // Sampler array elements may legitimately be inactive, query them 
+    // directly so as not to print warnings about them
+    for (unsigned int i = 0; i < Material::DiffuseMapMaxCount; i++)
+    {
+        const std::string samplerName = name + ".diffuseMaps[" + std::to_string(i) + "]";
+        locations.diffuseMaps[i] = glGetUniformLocation(_location, samplerName.c_str());
+    }
+
+    for (unsigned int i = 0; i < Material::SpecularMapMaxCount; i++)
+    {
+        const std::string samplerName = name + ".specularMaps[" + std::to_string(i) + "]";
+        locations.specularMaps[i] = glGetUniformLocation(_location, samplerName.c_str());
+    }
+
+    return locations;
+}
+
+void ShaderProgram::setMaterial(const MaterialUniformLocations& locations, const Material& value)
+{
+    glProgramUniform3fv(_location, locations.ambient, 1, glm::value_ptr(value.ambient));
+    glProgramUniform3fv(_location, locations.diffuse, 1, glm::value_ptr(value.diffuse));
+    glProgramUniform3fv(_location, locations.specular, 1, glm::value_ptr(value.specular));
+    glProgramUniform1f(_location, locations.shininess, value.shininess);
+
+    unsigned int count = value.getDiffuseMapCount();
+    // Diffuse maps are bound in texture units 0 through 7
+    for (unsigned int i = 0; i < count; i++)
+    {
+        glProgramUniform1i(_location, locations.diffuseMaps[i], (int)i);
+    }
+    glProgramUniform1ui(_location, locations.diffuseMapCount, count);
+
+    count = value.getSpecularMapCount();
+    // Specular maps are bound in texture units 8 through 15
+    for (unsigned int i = 0; i < count; i++)
+    {
+        glProgramUniform1i(_location, locations.specularMaps[i], Material::SpecularMapMaxCount + (int)i);
+    }
+    glProgramUniform1ui(_location, locations.specularMapCount, count);
+}
+
 const std::vector<ShaderFeature>& ShaderProgram::getSupportedFeatures() const
 {
     return _supportedFeatures;
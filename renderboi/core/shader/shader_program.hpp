@@ -6,11 +6,13 @@
 
 #include <fstream>
 #include <iostream>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <unordered_map>
 
 #include "shader_feature.hpp"
+#include "../gl_resource_registry.hpp"
 #include "../material.hpp"
 
 namespace Renderboi
@@ -23,6 +25,21 @@ class ShaderProgram
 {
 friend ShaderBuilder;
 
+public:
+    /// @brief Locations of all uniforms making up a material struct in a
+    /// shader program. A location of -1 means the uniform is not active.
+    struct MaterialUniformLocations
+    {
+        int ambient;
+        int diffuse;
+        int specular;
+        int shininess;
+        int diffuseMaps[Material::DiffuseMapMaxCount];
+        int diffuseMapCount;
+        int specularMaps[Material::SpecularMapMaxCount];
+        int specularMapCount;
+    };
+
 private:
     /// @param location Location of the shader program resource on the GPU.
     /// @param supportedFeatures Array of literals describing features which
@@ -36,13 +53,15 @@ private:
     /// program supports.
     std::vector<ShaderFeature> _supportedFeatures;
 
+    /// @brief Handle to the program in the GPU resource registry.
+    GLResourceHandle _handle;
+
     /// @brief Structure mapping uniform locations against their name, and
     /// then against the location of the program they belong to.
     static std::unordered_map<unsigned int, std::unordered_map<std::string, unsigned int>> _uniformLocations;
 
-    /// @brief Structure mapping how many shader instances are referencing a
-    /// shader resource on the GPU.
-    static std::unordered_map<unsigned int, unsigned int> _locationRefCounts;
+    /// @brief Mutex protecting the uniform location map.
+    static std::mutex _uniformLocationMutex;
 
     /// @brief Free resources upon destroying an instance.
     void _cleanup();
@@ -128,6 +147,23 @@ public:
     /// @param name The name of the uniform whose value to set.
     /// @param value The value to set the uniform at.
     void setMaterial(const std::string& name, const Material& value);
+
+    /// @brief Get the locations of all uniforms making up a named material
+    /// struct in the program, so that it can later be set without any name
+    /// lookups.
+    ///
+    /// @param name The name of the material uniform to locate.
+    ///
+    /// @return A struct filled with the locations of the uniforms.
+    MaterialUniformLocations getMaterialUniformLocations(const std::string& name) const;
+
+    /// @brief Set the value of a material uniform in the program, using
+    /// previously retrieved uniform locations.
+    ///
+    /// @param locations The locations of the uniforms making up the 
+    /// material struct.
+    /// @param value The value to set the uniform at.
+    void setMaterial(const MaterialUniformLocations& locations, const Material& value);
     
     /// @brief Get the features which this shader program supports.
     ///
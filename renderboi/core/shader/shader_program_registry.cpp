@@ -0,0 +1,62 @@
+#include "shader_program_registry.hpp"
+
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "shader_feature.hpp"
+
+namespace Renderboi
+{
+
+RegistryStorage<ShaderProgramRegistry::Entry> ShaderProgramRegistry::_Entries;
+
+std::unordered_map<unsigned int, ShaderProgramHandle>
+ShaderProgramRegistry::_LocationsToHandles = std::unordered_map<unsigned int, ShaderProgramHandle>();
+
+std::mutex ShaderProgramRegistry::_Mutex;
+
+ShaderProgramHandle ShaderProgramRegistry::Register(const ShaderProgram& program)
+{
+    std::unique_lock lock(_Mutex);
+
+    auto it = _LocationsToHandles.find(program.location());
+    if (it != _LocationsToHandles.end())
+    {
+        return it->second;
+    }
+
+    // Resolve material uniforms once and for all
+    ShaderProgram::MaterialUniformLocations locations = {};
+    if (program.supports(ShaderFeature::FragmentMeshMaterial))
+    {
+        locations = program.getMaterialUniformLocations(MaterialUniformName);
+    }
+
+    const ShaderProgramHandle handle = {_Entries.add({program, locations})};
+    _LocationsToHandles[program.location()] = handle;
+
+    return handle;
+}
+
+ShaderProgram& ShaderProgramRegistry::Get(const ShaderProgramHandle handle)
+{
+    return _GetEntry(handle).program;
+}
+
+const ShaderProgram::MaterialUniformLocations& ShaderProgramRegistry::GetMaterialUniformLocations(const ShaderProgramHandle handle)
+{
+    return _GetEntry(handle).materialLocations;
+}
+
+ShaderProgramRegistry::Entry& ShaderProgramRegistry::_GetEntry(const ShaderProgramHandle handle)
+{
+    if (handle.index >= _Entries.size())
+    {
+        throw std::runtime_error("ShaderProgramRegistry: handle does not refer to a registered shader program.");
+    }
+
+    return _Entries[handle.index];
+}
+
+}//namespace Renderboi
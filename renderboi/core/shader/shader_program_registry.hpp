@@ -0,0 +1,98 @@
+#ifndef RENDERBOI__CORE__SHADER__SHADER_PROGRAM_REGISTRY_HPP
+#define RENDERBOI__CORE__SHADER__SHADER_PROGRAM_REGISTRY_HPP
+
+#include <mutex>
+#include <unordered_map>
+
+#include "shader_program.hpp"
+#include "../registry_storage.hpp"
+
+namespace Renderboi
+{
+
+/// @brief Lightweight, trivially copyable reference to a shader program
+/// held in the ShaderProgramRegistry.
+struct ShaderProgramHandle
+{
+    /// @brief Index of the shader program in the registry.
+    unsigned int index;
+};
+
+/// @brief Central storage for shader programs, allowing them to be referred
+/// to by handle. Registered programs are never removed, so that handles
+/// remain valid for the lifetime of the program and accessing a shader
+/// program involves no copy. Registering the same GPU program several times
+/// yields the same handle.
+class ShaderProgramRegistry
+{
+private:
+    /// @brief Struct packing together a registered shader program and data
+    /// resolved upon registration.
+    struct Entry
+    {
+        /// @brief The registered shader program.
+        ShaderProgram program;
+
+        /// @brief Locations of the uniforms making up the material struct
+        /// of the program, if it supports ShaderFeature::FragmentMeshMaterial.
+        ShaderProgram::MaterialUniformLocations materialLocations;
+    };
+
+    /// @brief Storage for registered shader programs.
+    static RegistryStorage<Entry> _Entries;
+
+    /// @brief Structure mapping handles to registered programs against the
+    /// location of the program on the GPU.
+    static std::unordered_map<unsigned int, ShaderProgramHandle> _LocationsToHandles;
+
+    /// @brief Mutex used to serialize registrations.
+    static std::mutex _Mutex;
+
+    /// @brief Get the entry a handle refers to.
+    ///
+    /// @param handle Handle to the shader program.
+    ///
+    /// @return A reference to the registry entry.
+    ///
+    /// @exception If the handle does not refer to a registered shader
+    /// program, the function will throw a std::runtime_error.
+    static Entry& _GetEntry(const ShaderProgramHandle handle);
+
+public:
+    /// @brief Name of the material uniform whose locations are resolved
+    /// upon registration.
+    static constexpr char MaterialUniformName[] = "material";
+
+    /// @brief Register a shader program and get a handle to it.
+    ///
+    /// @param program The shader program to register.
+    ///
+    /// @return A handle to the registered shader program.
+    static ShaderProgramHandle Register(const ShaderProgram& program);
+
+    /// @brief Get a registered shader program.
+    ///
+    /// @param handle Handle to the shader program.
+    ///
+    /// @return A reference to the registered shader program.
+    ///
+    /// @exception If the handle does not refer to a registered shader
+    /// program, the function will throw a std::runtime_error.
+    static ShaderProgram& Get(const ShaderProgramHandle handle);
+
+    /// @brief Get the locations of the uniforms making up the material
+    /// struct of a registered shader program. Only meaningful if the
+    /// program supports ShaderFeature::FragmentMeshMaterial.
+    ///
+    /// @param handle Handle to the shader program.
+    ///
+    /// @return A const reference to the locations of the uniforms.
+    ///
+    /// @exception If the handle does not refer to a registered shader
+    /// program, the function will throw a std::runtime_error.
+    static const ShaderProgram::MaterialUniformLocations& GetMaterialUniformLocations(const ShaderProgramHandle handle);
+};
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__CORE__SHADER__SHADER_PROGRAM_REGISTRY_HPP
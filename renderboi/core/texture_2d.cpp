@@ -1,12 +1,19 @@
 #include "texture_2d.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
 #include <stdexcept>
 
 #include <glad/gl.h>
 #include <stb_image/stb_image.hpp>
 
+#include "gl_resource_registry.hpp"
+#include "gpu_memory.hpp"
 #include "pixel_space.hpp"
+#include "render_stats.hpp"
 
+#include <renderboi/utilities/profiler.hpp>
 #include <renderboi/utilities/to_string.hpp>
 #include <renderboi/utilities/resource_locator.hpp>
 
@@ -18,48 +25,89 @@ namespace Renderboi
 using ReLoc = ResourceLocator;
 using ReType = ResourceType;
 
-std::unordered_map<unsigned int, unsigned int> Texture2D::_locationRefCounts = std::unordered_map<unsigned int, unsigned int>();
-std::unordered_map<std::string , unsigned int> Texture2D::_pathsToIds  = std::unordered_map<std::string, unsigned int>();
+std::unordered_map<std::string, GLResourceHandle> Texture2D::_pathsToHandles = std::unordered_map<std::string, GLResourceHandle>();
+std::unordered_set<std::string> Texture2D::_pendingPaths = std::unordered_set<std::string>();
+std::mutex Texture2D::_pathsMutex;
+std::condition_variable Texture2D::_pathsCondition;
 
 Texture2D::Texture2D(const std::string& filename, const PixelSpace space) :
-    _path(filename)
+    _location(0),
+    _handle(),
+    _path(filename),
+    _space(space)
 {
-    auto it = _pathsToIds.find(filename);
-    // If the image is already handled by a Texture2D instance...
-    if (it != _pathsToIds.end())
+    std::unique_lock lock(_pathsMutex);
+
+    // If the image is being loaded by another thread, wait for it to be done
+    _pathsCondition.wait(lock, [&filename]() { return _pendingPaths.find(filename) == _pendingPaths.end(); });
+
+    auto it = _pathsToHandles.find(filename);
+    // If the image is already handled by a live Texture2D instance...
+    if (it != _pathsToHandles.end() && GLResourceRegistry::TryAcquire(it->second))
     {
-        // Just copy the location and increase the refcount
-        _location = it->second;
-        _locationRefCounts[_location]++;
+        // Just copy the handle, the refcount was increased already
+        _handle = it->second;
+        _location = GLResourceRegistry::GetName(_handle);
+        return;
     }
-    // If the image is not being handled by a Texture2D instance...
-    else
+
+    // Otherwise, load the image without holding the lock, so that other
+    // images can be loaded concurrently
+    _pendingPaths.insert(filename);
+    lock.unlock();
+
+    uint64_t bytes;
+    try
     {
-        // Load the image
-        _location = _LoadTextureFromFile(ReLoc::locate(ReType::Texture, filename), space);
-        // Map the new texture location to image filename and set a refcount
-        _pathsToIds[filename] = _location;
-        _locationRefCounts[_location] = 1;
+        _location = _LoadTextureFromFile(ReLoc::locate(ReType::Texture, filename), space, bytes);
     }
+    catch (...)
+    {
+        // Let waiting threads attempt the load themselves
+        lock.lock();
+        _pendingPaths.erase(filename);
+        lock.unlock();
+        _pathsCondition.notify_all();
+        throw;
+    }
+
+    // Register the new texture. It can be loaded again from the image at
+    // any time, and may thus be evicted when over the GPU memory budget.
+    _handle = GLResourceRegistry::Register(GLResourceType::Texture, _location);
+    GLResourceRegistry::SetSize(_handle, GPUMemoryCategory::Textures, bytes);
+    GLResourceRegistry::SetEvictable(_handle, true);
+
+    // Publish the handle under the image filename
+    lock.lock();
+    _pathsToHandles[filename] = _handle;
+    _pendingPaths.erase(filename);
+    lock.unlock();
+    _pathsCondition.notify_all();
 }
 
 Texture2D::Texture2D(const Texture2D& other) :
     _location(other._location),
-    _path(other._path)
+    _handle(other._handle),
+    _path(other._path),
+    _space(other._space)
 {
     // The same texture is being handled by one more resource: increase the refcount
-    _locationRefCounts[_location]++;
+    GLResourceRegistry::Acquire(_handle);
 }
 
 Texture2D& Texture2D::operator=(const Texture2D& other)
 {
+    if (this == &other) return *this;
+
     // Let go of the content currently in place
     _cleanup();
 
     // Copy the filename, location, and increase the ref count
     _location = other._location;
+    _handle = other._handle;
     _path = other._path;
-    _locationRefCounts[_location]++;
+    _space = other._space;
+    GLResourceRegistry::Acquire(_handle);
 
     return *this;
 }
@@ -72,65 +120,87 @@ Texture2D::~Texture2D()
 
 void Texture2D::_cleanup()
 {
-    // Decrease the ref count
-    unsigned int count = --_locationRefCounts[_location];
-    // If the resource is not used anymore...
-    if (!count)
-    {
-        // Remove ID map
-        _pathsToIds.erase(_path);
-        // Free the resource on the GPU
-        glDeleteTextures(1, &_location);
-    };
+    // Decrease the ref count, the resource on the GPU is deleted by the 
+    // registry once unused. The path map entry goes stale and gets replaced
+    // whenever the image is loaded again.
+    GLResourceRegistry::Release(_handle);
 }
 
-unsigned int Texture2D::_LoadTextureFromFile(const std::string& filename, const PixelSpace space)
+unsigned int Texture2D::_LoadTextureFromFile(const std::string& filename, const PixelSpace space, uint64_t& bytes)
 {
+    RB_PROFILE_ZONE("Texture2D::_LoadTextureFromFile");
+
     // Create a texture resource on the GPU
     unsigned int location;
     glGenTextures(1, &location);
 
+    bytes = _UploadImage(location, filename, space);
+
+    // Set texture wrapping and filtering options
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    return location;
+}
+
+uint64_t Texture2D::_UploadImage(const unsigned int location, const std::string& filename, const PixelSpace space)
+{
     // Load the image from disk
     int width, height, nChannels;
     unsigned char *data = stbi_load(filename.c_str(), &width, &height, &nChannels, 0);
 
-    if (data)
-    {
-        GLenum format = GL_RGB;
-        if (nChannels == 1)
-            format = GL_RED;
-        else if (nChannels == 4)
-            format = GL_RGBA;
-
-        GLenum internalFormat = GL_RGB;
-        if (space == PixelSpace::sRGB)
-        {
-            internalFormat = GL_SRGB;
-            if (format == GL_RGBA)
-                internalFormat = GL_SRGB_ALPHA;
-        }
-
-        // Send the texture to the GPU
-        glBindTexture(GL_TEXTURE_2D, location);
-        glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, GL_UNSIGNED_BYTE, data);
-        glGenerateMipmap(GL_TEXTURE_2D);
-
-        // Set texture wrapping and filtering options
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-        stbi_image_free(data);
-    }
-    else
+    if (!data)
     {
         stbi_image_free(data);
         std::string s = "Texture2D: failed to load image located at \"" + filename + "\".";
         throw std::runtime_error(s.c_str());
     }
 
-    return location;
+    GLenum format = GL_RGB;
+    if (nChannels == 1)
+        format = GL_RED;
+    else if (nChannels == 4)
+        format = GL_RGBA;
+
+    GLenum internalFormat = GL_RGB;
+    if (space == PixelSpace::sRGB)
+    {
+        internalFormat = GL_SRGB;
+        if (format == GL_RGBA)
+            internalFormat = GL_SRGB_ALPHA;
+    }
+
+    // Send the texture to the GPU
+    glBindTexture(GL_TEXTURE_2D, location);
+    glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, GL_UNSIGNED_BYTE, data);
+    glGenerateMipmap(GL_TEXTURE_2D);
+
+    stbi_image_free(data);
+
+    // Account for the whole mip chain, RGB texels being padded to four
+    // bytes by most drivers
+    const uint64_t texelSize = (nChannels == 3) ? 4 : (uint64_t)nChannels;
+    uint64_t bytes = 0;
+    for (uint64_t w = (uint64_t)width, h = (uint64_t)height; ; w = std::max<uint64_t>(w / 2, 1), h = std::max<uint64_t>(h / 2, 1))
+    {
+        bytes += w * h * texelSize;
+        if (w == 1 && h == 1) break;
+    }
+
+    return bytes;
+}
+
+void Texture2D::_restoreIfEvicted() const
+{
+    if (GLResourceRegistry::Touch(_handle)) return;
+
+    RB_PROFILE_ZONE("Texture2D::_restoreIfEvicted");
+
+    const uint64_t bytes = _UploadImage(_location, ReLoc::locate(ReType::Texture, _path), _space);
+    GLResourceRegistry::SetSize(_handle, GPUMemoryCategory::Textures, bytes);
+    RenderStats::Count(RenderCounter::BytesUploaded, bytes);
 }
 
 unsigned int Texture2D::location() const
@@ -140,6 +210,7 @@ unsigned int Texture2D::location() const
 
 void Texture2D::bind() const
 {
+    _restoreIfEvicted();
     glBindTexture(GL_TEXTURE_2D, _location);
 }
 
@@ -153,6 +224,7 @@ void Texture2D::bind(unsigned int unit) const
     }
 
     glActiveTexture(realUnit);
+    _restoreIfEvicted();
     glBindTexture(GL_TEXTURE_2D, _location);
 }
 
@@ -1,11 +1,16 @@
 #ifndef RENDERBOI__CORE__TEXTURE_2D_HPP
 #define RENDERBOI__CORE__TEXTURE_2D_HPP
 
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 #include <glad/gl.h>
 
+#include "gl_resource_registry.hpp"
 #include "pixel_space.hpp"
 
 namespace Renderboi
@@ -15,30 +20,66 @@ namespace Renderboi
 class Texture2D
 {
 private:
-    /// @brief Structure mapping GPU texture locations against the path of 
-    /// the image they were constructed from.
-    static std::unordered_map<std::string , unsigned int> _pathsToIds;
+    /// @brief Structure mapping handles to GPU textures against the path of
+    /// the image they were constructed from. Handles may be stale.
+    static std::unordered_map<std::string, GLResourceHandle> _pathsToHandles;
 
-    /// @brief Structure mapping how many Texture2D instances are handling 
-    /// a texture resource on the GPU.
-    static std::unordered_map<unsigned int, unsigned int> _locationRefCounts;
+    /// @brief Paths of the images being loaded by some thread, which other
+    /// threads wanting the same image wait on rather than loading it again.
+    static std::unordered_set<std::string> _pendingPaths;
+
+    /// @brief Mutex protecting the path map and the pending paths. Not held
+    /// while images are being loaded.
+    static std::mutex _pathsMutex;
+
+    /// @brief Notified whenever an image is done loading.
+    static std::condition_variable _pathsCondition;
 
     /// @brief The location of the texture resource on the GPU.
     unsigned int _location;
+
+    /// @brief Handle to the texture in the GPU resource registry.
+    GLResourceHandle _handle;
     
     /// @brief The path of the image from which the texture was generated.
     std::string _path;
 
+    /// @brief Space the pixels of the texture are in.
+    PixelSpace _space;
+
     /// @brief Process an image file and make a texture out of its content
     /// on the GPU.
     ///
     /// @param path Local path to the image file.
+    /// @param space Literal describing which space the texture pixels are
+    /// in.
+    /// @param bytes Will receive how many bytes the texture occupies on the
+    /// GPU, mip chain included.
     ///
     /// @return The GPU location of the generated texture.
     ///
     /// @exception If the image could not be read, the function throws an
     /// std::runtime_error.
-    static unsigned int _LoadTextureFromFile(const std::string& filename, const PixelSpace space);
+    static unsigned int _LoadTextureFromFile(const std::string& filename, const PixelSpace space, uint64_t& bytes);
+
+    /// @brief Process an image file and send its content to an existing
+    /// texture on the GPU, generating its mip chain.
+    ///
+    /// @param location GPU location of the texture to fill.
+    /// @param path Local path to the image file.
+    /// @param space Literal describing which space the texture pixels are
+    /// in.
+    ///
+    /// @return How many bytes the texture occupies on the GPU, mip chain
+    /// included.
+    ///
+    /// @exception If the image could not be read, the function throws an
+    /// std::runtime_error.
+    static uint64_t _UploadImage(const unsigned int location, const std::string& filename, const PixelSpace space);
+
+    /// @brief Load the texture from its image again if it was evicted from
+    /// the GPU, and record that it is being used.
+    void _restoreIfEvicted() const;
 
     /// @brief Free resources upon instance destruction.
     void _cleanup();
@@ -396,6 +396,15 @@ Transform Transform::compoundFrom(const Transform& other) const
     return Transform(newPosition, newRotation, newScale);
 }
 
+Transform Transform::interpolateTowards(const Transform& other, const float factor) const
+{
+    return Transform(
+        glm::mix(_position, other._position, factor),
+        glm::slerp(_rotation, other._rotation, factor),
+        glm::mix(_scale, other._scale, factor)
+    );
+}
+
 void Transform::_updateLocalVectors() const
 {
     // Transform world basis vectors according to rotation
@@ -243,6 +243,17 @@ class Transform : public BasisProvider
         /// @return The resulting transform.
         Transform compoundFrom(const Transform& other) const;
 
+        /// @brief Compute the transform lying in between [*this] and 
+        /// [other]: positions and scales are interpolated linearly, while
+        /// rotations are interpolated spherically.
+        ///
+        /// @param other The transform towards which to interpolate.
+        /// @param factor How far to interpolate towards [other], 0 
+        /// yielding [*this] and 1 yielding [other].
+        ///
+        /// @return The resulting transform.
+        Transform interpolateTowards(const Transform& other, const float factor) const;
+
         /// @brief Get the matrix which applies the parameters of the transform
         /// to any point which it multiplies.
         ///
@@ -3,33 +3,58 @@
 #include <glad/gl.h>
 #include <glm/gtc/type_ptr.hpp>
 
+#include "../gl_resource_registry.hpp"
+#include "../gpu_memory.hpp"
+#include "../render_stats.hpp"
+
 namespace Renderboi
 {
 
+namespace
+{
+
+/// @brief Send data to the uniform buffer currently bound, and count the
+/// upload in the render statistics.
+void uploadUniformData(const GLintptr offset, const GLsizeiptr size, const void* data)
+{
+    glBufferSubData(GL_UNIFORM_BUFFER, offset, size, data);
+    RenderStats::Count(RenderCounter::UboUploads);
+    RenderStats::Count(RenderCounter::BytesUploaded, (uint64_t)size);
+}
+
+}//namespace
+
 LightUBO::LightUBO()
 {
     // Generate the buffer and allocate space
     glGenBuffers(1, &_location);
     glBindBuffer(GL_UNIFORM_BUFFER, _location);
     glBufferData(GL_UNIFORM_BUFFER, Size, NULL, GL_STATIC_DRAW);
+    _handle = GLResourceRegistry::Register(GLResourceType::Buffer, _location);
+    GLResourceRegistry::SetSize(_handle, GPUMemoryCategory::UniformBuffers, Size);
 
     // Bind to binding point
     glBindBufferBase(GL_UNIFORM_BUFFER, BindingPoint, _location); 
 }
 
+LightUBO::~LightUBO()
+{
+    GLResourceRegistry::Release(_handle);
+}
+
 void LightUBO::setPoint(const unsigned int index, const PointLight& point, const glm::vec3& position)
 {
     unsigned int offset = PointLightOffset + (index * PointLightSize);
 
     // Send the point light data to the appropriate memory location on the GPU
     glBindBuffer(GL_UNIFORM_BUFFER, _location);
-    glBufferSubData(GL_UNIFORM_BUFFER, offset +  0, sizeof(glm::vec3), glm::value_ptr(position));
-    glBufferSubData(GL_UNIFORM_BUFFER, offset + 16, sizeof(glm::vec3), glm::value_ptr(point.ambient));
-    glBufferSubData(GL_UNIFORM_BUFFER, offset + 32, sizeof(glm::vec3), glm::value_ptr(point.diffuse));
-    glBufferSubData(GL_UNIFORM_BUFFER, offset + 48, sizeof(glm::vec3), glm::value_ptr(point.specular));
-    glBufferSubData(GL_UNIFORM_BUFFER, offset + 64, sizeof(float), &point.constant);
-    glBufferSubData(GL_UNIFORM_BUFFER, offset + 68, sizeof(float), &point.linear);
-    glBufferSubData(GL_UNIFORM_BUFFER, offset + 72, sizeof(float), &point.quadratic);
+    uploadUniformData(offset +  0, sizeof(glm::vec3), glm::value_ptr(position));
+    uploadUniformData(offset + 16, sizeof(glm::vec3), glm::value_ptr(point.ambient));
+    uploadUniformData(offset + 32, sizeof(glm::vec3), glm::value_ptr(point.diffuse));
+    uploadUniformData(offset + 48, sizeof(glm::vec3), glm::value_ptr(point.specular));
+    uploadUniformData(offset + 64, sizeof(float), &point.constant);
+    uploadUniformData(offset + 68, sizeof(float), &point.linear);
+    uploadUniformData(offset + 72, sizeof(float), &point.quadratic);
 }
 
 void LightUBO::setPointCount(const unsigned int count)
@@ -37,7 +62,7 @@ void LightUBO::setPointCount(const unsigned int count)
     unsigned int offset = LightCountsOffset;
 
     glBindBuffer(GL_UNIFORM_BUFFER, _location);
-    glBufferSubData(GL_UNIFORM_BUFFER, offset, sizeof(unsigned int), &count);
+    uploadUniformData(offset, sizeof(unsigned int), &count);
 }
 
 void LightUBO::setSpot(const unsigned int index, const SpotLight& spot, const glm::vec3& position)
@@ -46,16 +71,16 @@ void LightUBO::setSpot(const unsigned int index, const SpotLight& spot, const gl
 
     // Send the spot light data to the appropriate memory location on the GPU
     glBindBuffer(GL_UNIFORM_BUFFER, _location);
-    glBufferSubData(GL_UNIFORM_BUFFER, offset +  0, sizeof(glm::vec3), glm::value_ptr(position));
-    glBufferSubData(GL_UNIFORM_BUFFER, offset + 16, sizeof(glm::vec3), glm::value_ptr(spot.direction));
-    glBufferSubData(GL_UNIFORM_BUFFER, offset + 32, sizeof(glm::vec3), glm::value_ptr(spot.ambient));
-    glBufferSubData(GL_UNIFORM_BUFFER, offset + 48, sizeof(glm::vec3), glm::value_ptr(spot.diffuse));
-    glBufferSubData(GL_UNIFORM_BUFFER, offset + 64, sizeof(glm::vec3), glm::value_ptr(spot.specular));
-    glBufferSubData(GL_UNIFORM_BUFFER, offset + 80, sizeof(float), &spot.constant);
-    glBufferSubData(GL_UNIFORM_BUFFER, offset + 84, sizeof(float), &spot.linear);
-    glBufferSubData(GL_UNIFORM_BUFFER, offset + 88, sizeof(float), &spot.quadratic);
-    glBufferSubData(GL_UNIFORM_BUFFER, offset + 92, sizeof(float), &spot.innerCutoff);
-    glBufferSubData(GL_UNIFORM_BUFFER, offset + 96, sizeof(float), &spot.outerCutoff);
+    uploadUniformData(offset +  0, sizeof(glm::vec3), glm::value_ptr(position));
+    uploadUniformData(offset + 16, sizeof(glm::vec3), glm::value_ptr(spot.direction));
+    uploadUniformData(offset + 32, sizeof(glm::vec3), glm::value_ptr(spot.ambient));
+    uploadUniformData(offset + 48, sizeof(glm::vec3), glm::value_ptr(spot.diffuse));
+    uploadUniformData(offset + 64, sizeof(glm::vec3), glm::value_ptr(spot.specular));
+    uploadUniformData(offset + 80, sizeof(float), &spot.constant);
+    uploadUniformData(offset + 84, sizeof(float), &spot.linear);
+    uploadUniformData(offset + 88, sizeof(float), &spot.quadratic);
+    uploadUniformData(offset + 92, sizeof(float), &spot.innerCutoff);
+    uploadUniformData(offset + 96, sizeof(float), &spot.outerCutoff);
 }
 
 void LightUBO::setSpotCount(const unsigned int count)
@@ -63,7 +88,7 @@ void LightUBO::setSpotCount(const unsigned int count)
     unsigned int offset = LightCountsOffset + 4;
 
     glBindBuffer(GL_UNIFORM_BUFFER, _location);
-    glBufferSubData(GL_UNIFORM_BUFFER, offset, sizeof(unsigned int), &count);
+    uploadUniformData(offset, sizeof(unsigned int), &count);
 }
 
 void LightUBO::setDirectional(const unsigned int index, const DirectionalLight& direct)
@@ -72,10 +97,10 @@ void LightUBO::setDirectional(const unsigned int index, const DirectionalLight&
 
     // Send the directional light data to the appropriate memory location on the GPU
     glBindBuffer(GL_UNIFORM_BUFFER, _location);
-    glBufferSubData(GL_UNIFORM_BUFFER, offset +  0, sizeof(glm::vec3), glm::value_ptr(direct.direction));
-    glBufferSubData(GL_UNIFORM_BUFFER, offset + 16, sizeof(glm::vec3), glm::value_ptr(direct.ambient));
-    glBufferSubData(GL_UNIFORM_BUFFER, offset + 32, sizeof(glm::vec3), glm::value_ptr(direct.diffuse));
-    glBufferSubData(GL_UNIFORM_BUFFER, offset + 48, sizeof(glm::vec3), glm::value_ptr(direct.specular));
+    uploadUniformData(offset +  0, sizeof(glm::vec3), glm::value_ptr(direct.direction));
+    uploadUniformData(offset + 16, sizeof(glm::vec3), glm::value_ptr(direct.ambient));
+    uploadUniformData(offset + 32, sizeof(glm::vec3), glm::value_ptr(direct.diffuse));
+    uploadUniformData(offset + 48, sizeof(glm::vec3), glm::value_ptr(direct.specular));
 }
 
 void LightUBO::setDirectionalCount(const unsigned int count)
@@ -83,7 +108,7 @@ void LightUBO::setDirectionalCount(const unsigned int count)
     unsigned int offset = LightCountsOffset + 8;
 
     glBindBuffer(GL_UNIFORM_BUFFER, _location);
-    glBufferSubData(GL_UNIFORM_BUFFER, offset, sizeof(unsigned int), &count);
+    uploadUniformData(offset, sizeof(unsigned int), &count);
 }
 
 }//namespace Renderboi
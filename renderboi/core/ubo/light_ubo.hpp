@@ -3,6 +3,8 @@
 
 #include <glm/glm.hpp>
 
+#include "../gl_resource_registry.hpp"
+
 #include "../lights/point_light.hpp"
 #include "../lights/directional_light.hpp"
 #include "../lights/spot_light.hpp"
@@ -30,6 +32,9 @@ private:
     /// @brief The location (binding point) of the UBO on the GPU.
     unsigned int _location;
 
+    /// @brief Handle to the UBO in the resource registry.
+    GLResourceHandle _handle;
+
 public:
     /// @brief The maximum count of spot lights in the UBO. 
     static constexpr unsigned int SpotLightMaxCount         = 64;
@@ -69,6 +74,12 @@ public:
 
     LightUBO();
 
+    LightUBO(const LightUBO& other) = delete;
+
+    ~LightUBO();
+
+    LightUBO& operator=(const LightUBO& other) = delete;
+
     /// @brief Set a point light in the UBO.
     ///
     /// @param index The index of the point light to set in the UBO.
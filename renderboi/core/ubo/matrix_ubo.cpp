@@ -3,46 +3,71 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <glad/gl.h>
 
+#include "../gl_resource_registry.hpp"
+#include "../gpu_memory.hpp"
+#include "../render_stats.hpp"
+
 namespace Renderboi
 {
 
+namespace
+{
+
+/// @brief Send data to the uniform buffer currently bound, and count the
+/// upload in the render statistics.
+void uploadUniformData(const GLintptr offset, const GLsizeiptr size, const void* data)
+{
+    glBufferSubData(GL_UNIFORM_BUFFER, offset, size, data);
+    RenderStats::Count(RenderCounter::UboUploads);
+    RenderStats::Count(RenderCounter::BytesUploaded, (uint64_t)size);
+}
+
+}//namespace
+
 MatrixUBO::MatrixUBO()
 {
     // Generate the buffer and allocate space
     glGenBuffers(1, &_location);
     glBindBuffer(GL_UNIFORM_BUFFER, _location);
     glBufferData(GL_UNIFORM_BUFFER, Size, NULL, GL_STATIC_DRAW);
+    _handle = GLResourceRegistry::Register(GLResourceType::Buffer, _location);
+    GLResourceRegistry::SetSize(_handle, GPUMemoryCategory::UniformBuffers, Size);
 
     // Bind to binding point
     glBindBufferBase(GL_UNIFORM_BUFFER, BindingPoint, _location); 
 }
 
+MatrixUBO::~MatrixUBO()
+{
+    GLResourceRegistry::Release(_handle);
+}
+
 void MatrixUBO::setModel(const glm::mat4& model)
 {
     // Send the matrix on the GPU memory, with an appropriate offset
     glBindBuffer(GL_UNIFORM_BUFFER, _location);
-    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(glm::mat4), glm::value_ptr(model));
+    uploadUniformData(0, sizeof(glm::mat4), glm::value_ptr(model));
 }
 
 void MatrixUBO::setView(const glm::mat4& view)
 {
     // Send the matrix on the GPU memory, with an appropriate offset
     glBindBuffer(GL_UNIFORM_BUFFER, _location);
-    glBufferSubData(GL_UNIFORM_BUFFER, 64, sizeof(glm::mat4), glm::value_ptr(view));
+    uploadUniformData(64, sizeof(glm::mat4), glm::value_ptr(view));
 }
 
 void MatrixUBO::setProjection(const glm::mat4& projection)
 {
     // Send the matrix on the GPU memory, with an appropriate offset
     glBindBuffer(GL_UNIFORM_BUFFER, _location);
-    glBufferSubData(GL_UNIFORM_BUFFER, 128, sizeof(glm::mat4), glm::value_ptr(projection));
+    uploadUniformData(128, sizeof(glm::mat4), glm::value_ptr(projection));
 }
 
 void MatrixUBO::setNormal(const glm::mat4& normal)
 {
     // Send the matrix on the GPU memory, with an appropriate offset
     glBindBuffer(GL_UNIFORM_BUFFER, _location);
-    glBufferSubData(GL_UNIFORM_BUFFER, 192, 3*sizeof(glm::vec4), glm::value_ptr(normal));
+    uploadUniformData(192, 3*sizeof(glm::vec4), glm::value_ptr(normal));
 }
 
 }//namespace Renderboi
@@ -3,6 +3,8 @@
 
 #include <glm/glm.hpp>
 
+#include "../gl_resource_registry.hpp"
+
 /* UNIFORM BLOCK LAYOUT
  * ====================
  *
@@ -26,6 +28,9 @@ private:
     /// @brief The location (binding point) of the UBO on the GPU.
     unsigned int _location;
 
+    /// @brief Handle to the UBO in the resource registry.
+    GLResourceHandle _handle;
+
 public:
     /// @brief The total size, in bytes, of the UBO in the GPU memory.
     static constexpr unsigned int Size         = 240;
@@ -35,6 +40,12 @@ public:
     
     MatrixUBO();
 
+    MatrixUBO(const MatrixUBO& other) = delete;
+
+    ~MatrixUBO();
+
+    MatrixUBO& operator=(const MatrixUBO& other) = delete;
+
     /// @brief Set the model matrix in the UBO.
     ///
     /// @param model The model matrix to set in the UBO.
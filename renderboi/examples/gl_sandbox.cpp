@@ -1,9 +1,22 @@
 #include "gl_sandbox.hpp"
 
+#include <cstdint>
+#include <exception>
+#include <thread>
+
 #include <glad/gl.h>
 
+#include <renderboi/window/buffered_input_processor.hpp>
+
+#include <renderboi/core/gl_resource_registry.hpp>
+#include <renderboi/core/render_stats.hpp>
+
 #include <renderboi/utilities/gl_utilities.hpp>
 
+#include <renderboi/toolbox/frame_pipeline.hpp>
+#include <renderboi/toolbox/frame_scheduler.hpp>
+#include <renderboi/toolbox/scene/scene_renderer.hpp>
+
 namespace Renderboi
 {
 
@@ -36,7 +49,183 @@ void GLSandbox::_initContext()
 
 void GLSandbox::_terminateContext()
 {
+    // Resources released by the sandbox can only be freed while the context
+    // is still current
+    GLResourceRegistry::ProcessPendingDeletions();
     _window->releaseContext();
 }
 
+std::unique_ptr<FrameRecorder> GLSandbox::_makeFrameRecorder() const
+{
+    if (!_parameters.batchFrameCount) return nullptr;
+
+    int width, height;
+    _window->getFramebufferSize(width, height);
+
+    return std::make_unique<FrameRecorder>(
+        _parameters.batchOutputPath,
+        _parameters.batchOutputFormat,
+        width,
+        height,
+        _parameters.batchFrameRate
+    );
+}
+
+InputRecorderPtr GLSandbox::_makeInputRecorder() const
+{
+    if (_parameters.inputRecordPath.empty()) return nullptr;
+
+    return std::make_shared<InputRecorder>(_parameters.inputRecordPath);
+}
+
+std::unique_ptr<InputReplayer> GLSandbox::_makeInputReplayer(const InputSplitterPtr splitter, const GamepadPtr gamepad) const
+{
+    if (_parameters.inputReplayPath.empty()) return nullptr;
+
+    return std::make_unique<InputReplayer>(
+        _parameters.inputReplayPath,
+        std::static_pointer_cast<InputProcessor>(splitter),
+        std::static_pointer_cast<GamepadInputProcessor>(splitter),
+        _window,
+        gamepad
+    );
+}
+
+unsigned int GLSandbox::_runPipelinedLoop(const ScenePtr scene, const InputSplitterPtr splitter, const FrameCallback& onFrameRendered)
+{
+    // Buffer input so that it is processed on the simulation thread rather than the polling thread
+    BufferedInputProcessorPtr bufferedInput = std::make_shared<BufferedInputProcessor>(
+        std::static_pointer_cast<InputProcessor>(splitter)
+    );
+
+    // Record input as it is processed, if requested
+    InputRecorderPtr inputRecorder = _makeInputRecorder();
+    if (inputRecorder)
+    {
+        splitter->registerInputProcessor(inputRecorder);
+    }
+
+    // When replaying input, live input is ignored so that the replay is
+    // not disturbed
+    std::unique_ptr<InputReplayer> inputReplayer = _makeInputReplayer(splitter);
+
+    // Register the buffered input processor to the window
+    if (!inputReplayer)
+    {
+        _window->registerInputProcessor(std::static_pointer_cast<InputProcessor>(bufferedInput));
+    }
+
+    SceneRenderer sceneRenderer(scene->getJobSystem());
+    FrameScheduler frameScheduler;
+    frameScheduler.applySwapInterval(_window);
+    FramePipeline framePipeline;
+
+    // In batch mode, frames are recorded one simulation step apart, as fast
+    // as they can be rendered
+    std::unique_ptr<FrameRecorder> recorder = _makeFrameRecorder();
+    const bool batchMode = (bool)recorder;
+    const float batchTimestep = 1.f / _parameters.batchFrameRate;
+
+    // Simulate frame N+1 on a separate thread while this thread renders
+    // frame N. Errors are rethrown on this thread once both are stopped.
+    std::exception_ptr simulationError = nullptr;
+    std::thread simulationThread([&]()
+    {
+        unsigned int publishedFrames = 0;
+
+        // Index of the next simulation step, which recorded and replayed
+        // input is tagged with
+        uint32_t step = 0;
+
+        try
+        {
+            while (!_window->exitSignaled())
+            {
+                if (batchMode && publishedFrames == _parameters.batchFrameCount) break;
+                if (inputReplayer && inputReplayer->finished()) break;
+                if (!batchMode) frameScheduler.waitForNextFrame();
+
+                // Process input captured since the last frame
+                if (inputRecorder) inputRecorder->setStep(step);
+                bufferedInput->processPendingEvents();
+
+                if (batchMode)
+                {
+                    if (inputReplayer) inputReplayer->replayStep(step);
+                    scene->triggerUpdate(batchTimestep);
+                    step++;
+                    sceneRenderer.captureSnapshot(scene, framePipeline.getWriteSnapshot());
+                }
+                else
+                {
+                    // Update scene in fixed steps and capture it in between the last two
+                    while (frameScheduler.stepSimulation())
+                    {
+                        if (inputReplayer) inputReplayer->replayStep(step);
+                        scene->triggerUpdate(frameScheduler.getFixedTimestep());
+                        step++;
+                    }
+                    sceneRenderer.captureSnapshot(scene, framePipeline.getWriteSnapshot(), frameScheduler.getInterpolationFactor());
+                }
+                if (!framePipeline.publish()) break;
+                publishedFrames++;
+            }
+        }
+        catch (...)
+        {
+            simulationError = std::current_exception();
+        }
+        framePipeline.close();
+    });
+
+    unsigned int renderedFrames = 0;
+
+    glClearColor(0.0f, 0.0f, 0.1f, 1.0f);
+    glEnable(GL_DEPTH_TEST);
+    try
+    {
+        while (const FrameSnapshot* snapshot = framePipeline.acquire())
+        {
+            // Process awaiting render events
+            _eventManager->processPendingEvents();
+
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            sceneRenderer.renderSnapshot(*snapshot);
+            framePipeline.release();
+            if (recorder) recorder->capture();
+            _window->swapBuffers();
+            RenderStats::EndFrame();
+
+            renderedFrames++;
+            if (onFrameRendered) onFrameRendered(renderedFrames);
+        }
+    }
+    catch (...)
+    {
+        // Stop the simulation thread before letting the error through
+        framePipeline.close();
+        simulationThread.join();
+        throw;
+    }
+    simulationThread.join();
+
+    if (simulationError)
+    {
+        std::rethrow_exception(simulationError);
+    }
+
+    if (inputRecorder)
+    {
+        inputRecorder->finish();
+    }
+
+    if (recorder || inputReplayer)
+    {
+        if (recorder) recorder->finish();
+        _window->signalExit();
+    }
+
+    return renderedFrames;
+}
+
 }
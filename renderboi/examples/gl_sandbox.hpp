@@ -1,9 +1,16 @@
 #ifndef RENDERBOI__EXAMPLES__GL_SANDBOX_HPP
 #define RENDERBOI__EXAMPLES__GL_SANDBOX_HPP
 
+#include <functional>
 #include <memory>
 #include <string>
 
+#include <renderboi/toolbox/frame_recorder.hpp>
+#include <renderboi/toolbox/input_recorder.hpp>
+#include <renderboi/toolbox/input_replayer.hpp>
+#include <renderboi/toolbox/input_splitter.hpp>
+#include <renderboi/toolbox/scene/scene.hpp>
+
 #include <renderboi/window/gl_window.hpp>
 #include <renderboi/window/gl_context_client.hpp>
 
@@ -48,6 +55,54 @@ class GLSandbox : public Window::GLContextClient,
 		/// @brief Release the OpenGL context of the sandbox.
 		virtual void _terminateContext();
 
+		/// @brief Create a recorder for the frames of the sandbox, as per
+		/// the batch parameters. The context must be current.
+		///
+		/// @return A pointer to the frame recorder, or nullptr if the
+		/// sandbox is not running in batch mode.
+		std::unique_ptr<FrameRecorder> _makeFrameRecorder() const;
+
+		/// @brief Create a recorder for the input of the sandbox, as per the
+		/// input parameters.
+		///
+		/// @return A pointer to the input recorder, or nullptr if input is
+		/// not to be recorded.
+		InputRecorderPtr _makeInputRecorder() const;
+
+		/// @brief Create a replayer for the input log named in the input
+		/// parameters.
+		///
+		/// @param splitter Input splitter into which to inject events.
+		/// @param gamepad Gamepad on behalf of which to inject gamepad
+		/// events. May be null.
+		///
+		/// @return A pointer to the input replayer, or nullptr if no input
+		/// is to be replayed.
+		std::unique_ptr<InputReplayer> _makeInputReplayer(const InputSplitterPtr splitter, const GamepadPtr gamepad = nullptr) const;
+
+		/// @brief Callback invoked on the render thread after each frame
+		/// was presented, with the amount of frames rendered so far.
+		using FrameCallback = std::function<void(unsigned int)>;
+
+		/// @brief Run a scene until the window is signaled to exit, or until
+		/// the batch or the input replay is over. The scene is simulated on
+		/// a separate thread while this thread renders the previous frame.
+		/// Input from the window is buffered into the splitter, recorded
+		/// and replayed as per the input parameters. The context must be
+		/// current.
+		///
+		/// @param scene Scene to simulate and render, with the job system
+		/// of which it is rendered.
+		/// @param splitter Input splitter to which window input is fed.
+		/// @param onFrameRendered Callback to invoke after each frame. May
+		/// be empty.
+		///
+		/// @return How many frames were rendered.
+		///
+		/// @exception Any error raised by either thread is let through once
+		/// both threads are stopped.
+		unsigned int _runPipelinedLoop(const ScenePtr scene, const InputSplitterPtr splitter, const FrameCallback& onFrameRendered = nullptr);
+
 		/// @brief Structure packing the parameters according to which the 
 		/// sandbox should run.
 		GLSandboxParameters _parameters;
@@ -1,14 +1,81 @@
 #ifndef RENDERBOI__EXAMPLES__GL_SANDBOX_PARAMETERS_HPP
 #define RENDERBOI__EXAMPLES__GL_SANDBOX_PARAMETERS_HPP
 
+#include <filesystem>
+
 #include <renderboi/window/gl_window.hpp>
 
+#include <renderboi/toolbox/frame_recorder.hpp>
+
 namespace Renderboi
 {
+    /// @brief Shape and load of the scene populated by StressSandbox.
+    struct StressSandboxParameters
+    {
+        /// @brief How many objects (each with a mesh) to populate the scene
+        /// with.
+        unsigned int objectCount = 10000;
+
+        /// @brief How many of the objects carry a point light.
+        unsigned int lightCount = 16;
+
+        /// @brief How many of the objects carry a script of their own.
+        unsigned int scriptCount = 1000;
+
+        /// @brief How many levels the object hierarchies have. 1 makes all
+        /// objects roots.
+        unsigned int depth = 4;
+
+        /// @brief How many children each object of a hierarchy has, save
+        /// for those on its last level.
+        unsigned int branching = 4;
+
+        /// @brief Fraction (between 0 and 1) of the objects whose transform
+        /// is animated every frame.
+        float animatedFraction = 0.1f;
+    };
+
     struct GLSandboxParameters
     {
         bool debug;
+
+        /// @brief Hidden window sharing its context with the main window,
+        /// to upload resources from. May be null.
+        Window::GLWindowPtr uploadWindow;
+
+        /// @brief How many frames to render and record before exiting, at a
+        /// fixed timestep and as fast as possible. 0 runs the sandbox
+        /// interactively.
+        unsigned int batchFrameCount = 0;
+
+        /// @brief Rate (in Hz) at which frames are simulated and recorded
+        /// in batch mode.
+        unsigned int batchFrameRate = 60;
+
+        /// @brief Path to the directory or file to record frames to in
+        /// batch mode.
+        std::filesystem::path batchOutputPath;
+
+        /// @brief Format to record frames in in batch mode.
+        FrameRecorder::OutputFormat batchOutputFormat = FrameRecorder::OutputFormat::PngSequence;
+
+        /// @brief Path to the file to record input to, tagged with the
+        /// simulation steps it was processed at. Empty if input is not to
+        /// be recorded.
+        std::filesystem::path inputRecordPath;
+
+        /// @brief Path to an input log to replay instead of processing live
+        /// input. The sandbox exits once all of it was replayed. Empty if
+        /// no input is to be replayed.
+        std::filesystem::path inputReplayPath;
+
+        /// @brief Path to the file render statistics are dumped to when
+        /// requested through the window manager.
+        std::filesystem::path renderStatsPath = "render_stats.json";
+
+        /// @brief Parameters of the scene populated by StressSandbox.
+        StressSandboxParameters stress;
     };
 }
 
-#endif//RENDERBOI__EXAMPLES__GL_SANDBOX_PARAMETERS_HPP
\ No newline at end of file
+#endif//RENDERBOI__EXAMPLES__GL_SANDBOX_PARAMETERS_HPP
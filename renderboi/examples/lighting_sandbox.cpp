@@ -12,11 +12,14 @@
 #include <renderboi/window/window_factory.hpp>
 
 #include <renderboi/core/mesh.hpp>
+#include <renderboi/core/material_registry.hpp>
 #include <renderboi/core/materials.hpp>
 #include <renderboi/core/lights/point_light.hpp>
 #include <renderboi/core/frame_of_reference.hpp>
 #include <renderboi/core/shader/shader_builder.hpp>
 
+#include <renderboi/utilities/job_system.hpp>
+
 #include <renderboi/toolbox/common_macros.hpp>
 #include <renderboi/toolbox/factory.hpp>
 #include <renderboi/toolbox/input_splitter.hpp>
@@ -25,7 +28,6 @@
 #include <renderboi/toolbox/controls/controlled_entity_manager.hpp>
 #include <renderboi/toolbox/mesh_generators/mesh_type.hpp>
 #include <renderboi/toolbox/scene/scene.hpp>
-#include <renderboi/toolbox/scene/scene_renderer.hpp>
 #include <renderboi/toolbox/scene/scene_object.hpp>
 #include <renderboi/toolbox/scene/component_type.hpp>
 #include <renderboi/toolbox/scene/components/all_components.hpp>
@@ -67,19 +69,21 @@ void LightingSandbox::run()
     lightConfig.addFeature(ShaderFeature::FragmentBlinnPhong);
     ShaderProgram lightingShader = ShaderBuilder::BuildShaderProgramFromConfig(lightConfig);
 
+    JobSystemPtr jobSystem = std::make_shared<JobSystem>();
     ScenePtr scene = Factory::MakeScene();
+    scene->setJobSystem(jobSystem);
 
     // BIG TORUS
-    SceneObjectPtr bigTorusObj = Factory::MakeSceneObjectWithMesh<MeshType::Torus>("Big torus", {2.f, 0.5f, 72, 48}, Materials::Emerald, lightingShader);
+    SceneObjectPtr bigTorusObj = Factory::MakeSceneObjectWithMesh<MeshType::Torus>("Big torus", {2.f, 0.5f, 72, 48}, MaterialRegistry::Register(Materials::Emerald), lightingShader);
 
     // SMALL TORUS
-    SceneObjectPtr smallTorusObj = Factory::MakeSceneObjectWithMesh<MeshType::Torus>("Small torus", {0.75f, 0.25f, 64, 32}, Materials::Gold, lightingShader);
+    SceneObjectPtr smallTorusObj = Factory::MakeSceneObjectWithMesh<MeshType::Torus>("Small torus", {0.75f, 0.25f, 64, 32}, MaterialRegistry::Register(Materials::Gold), lightingShader);
     
     // AXES
     SceneObjectPtr axesObj = Factory::MakeSceneObjectWithMesh<MeshType::Axes>("Axes", {3.f});
     
     // CUBE
-    SceneObjectPtr cubeObj = Factory::MakeSceneObjectWithMesh<MeshType::Cube>("Light cube", {0.3f, {0.f, 0.f, 0.f}, false}, Materials::Default, lightingShader);
+    SceneObjectPtr cubeObj = Factory::MakeSceneObjectWithMesh<MeshType::Cube>("Light cube", {0.3f, {0.f, 0.f, 0.f}, false}, MaterialRegistry::GetDefault(), lightingShader);
     std::shared_ptr<PointLight> light = std::make_shared<PointLight>(LightBaseRange);
     cubeObj->addComponent<LightComponent>(light);
 
@@ -114,28 +118,21 @@ void LightingSandbox::run()
     cameraObj->addComponent<ScriptComponent>(std::static_pointer_cast<Script>(keyboardScriptManager.getEntity()));
 
     // Window script
-    ControlledEntityManager<BasicWindowManager> windowManager;
+    ControlledEntityManager<BasicWindowManager> windowManager(_parameters.renderStatsPath);
 
     // Instantiate an input logger
     InputLoggerPtr logger = std::make_shared<InputLogger>();
 
     // Register the scene and the control translator to the splitter
     InputSplitterPtr splitter = std::make_shared<InputSplitter>();
-    splitter->registerInputProcessor(std::static_pointer_cast<InputProcessor>(logger));
-    splitter->registerInputProcessor(std::static_pointer_cast<InputProcessor>(cameraManager));
-    splitter->registerInputProcessor(std::static_pointer_cast<InputProcessor>(cameraAspectRatioManager));
-    splitter->registerInputProcessor(std::static_pointer_cast<InputProcessor>(rotationScript));
-    splitter->registerInputProcessor(std::static_pointer_cast<InputProcessor>(keyboardScriptManager.getEventTranslator()));
-    splitter->registerInputProcessor(std::static_pointer_cast<InputProcessor>(windowManager.getEntity()));
-    splitter->registerInputProcessor(std::static_pointer_cast<InputProcessor>(windowManager.getEventTranslator()));
+    splitter->registerInputProcessor(logger);
+    splitter->registerInputProcessor(cameraManager);
+    splitter->registerInputProcessor(cameraAspectRatioManager);
+    splitter->registerInputProcessor(rotationScript);
+    splitter->registerInputProcessor(keyboardScriptManager.getEventTranslator());
+    splitter->registerInputProcessor(windowManager.getEntity());
+    splitter->registerInputProcessor(windowManager.getEventTranslator());
     
-    // Register the splitter to the window
-    _window->registerInputProcessor(std::static_pointer_cast<InputProcessor>(splitter));
-
-
-    // Register the splitter to the window
-    _window->registerInputProcessor(std::static_pointer_cast<InputProcessor>(splitter));
-
     const glm::vec3 X = Transform::X;
     const glm::vec3 Y = Transform::Y;
     const glm::vec3 Z = Transform::Z;
@@ -150,22 +147,7 @@ void LightingSandbox::run()
     cameraObj->transform.setPosition<Ref::World>(StartingCameraPosition);
     cameraObj->transform.rotateBy<Ref::Parent>(glm::radians(180.f), Y);
 
-    SceneRenderer sceneRenderer;
-
-    glClearColor(0.0f, 0.0f, 0.1f, 1.0f);
-    glEnable(GL_DEPTH_TEST);
-    while (!_window->exitSignaled())
-    {
-        // Process awaiting render events
-        _eventManager->processPendingEvents();
-
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
-        // Update and draw scene
-        scene->triggerUpdate();
-        sceneRenderer.renderScene(scene);
-        _window->swapBuffers();
-    }
+    _runPipelinedLoop(scene, splitter);
 
     Factory::DestroyScene(scene);
     
@@ -1,18 +1,30 @@
 #include "shadow_sandbox.hpp"
 
+#include <cstdint>
+#include <memory>
 #include <string>
 
 #include <renderboi/core/camera.hpp>
 #include <renderboi/core/frame_of_reference.hpp>
 #include <renderboi/core/material.hpp>
-#include <renderboi/core/materials.hpp>
+#include <renderboi/core/material_registry.hpp>
 #include <renderboi/core/pixel_space.hpp>
+#include <renderboi/core/render_stats.hpp>
 #include <renderboi/core/texture_2d.hpp>
 #include <renderboi/core/lights/point_light.hpp>
 #include <renderboi/core/shader/shader.hpp>
 
+#include <renderboi/utilities/job_system.hpp>
+
+#include <renderboi/window/buffered_input_processor.hpp>
+
 #include <renderboi/toolbox/factory.hpp>
+#include <renderboi/toolbox/frame_recorder.hpp>
+#include <renderboi/toolbox/frame_scheduler.hpp>
+#include <renderboi/toolbox/input_recorder.hpp>
+#include <renderboi/toolbox/input_replayer.hpp>
 #include <renderboi/toolbox/input_splitter.hpp>
+#include <renderboi/toolbox/upload_service.hpp>
 #include <renderboi/toolbox/controls/controlled_entity_manager.hpp>
 #include <renderboi/toolbox/mesh_generators/mesh_type.hpp>
 #include <renderboi/toolbox/mesh_generators/plane_generator.hpp>
@@ -73,6 +85,26 @@ void ShadowSandbox::run()
 {
     GLSandbox::_initContext();
 
+    // Start loading textures on the upload thread, if there is one, while
+    // shaders are built on this thread
+    std::unique_ptr<UploadService> uploadService;
+    UploadService::PendingResourcePtr<Texture2D> floorTexUpload;
+    UploadService::PendingResourcePtr<Texture2D> wallTexUpload;
+    if (_parameters.uploadWindow)
+    {
+        uploadService = std::make_unique<UploadService>(_parameters.uploadWindow);
+        floorTexUpload = uploadService->make<Texture2D>(std::string("wood.png"), PixelSpace::sRGB);
+        wallTexUpload = uploadService->make<Texture2D>(std::string("wall.jpg"), PixelSpace::sRGB);
+    }
+
+    const auto getTexture = [&uploadService](const UploadService::PendingResourcePtr<Texture2D>& pending, const std::string& filename)
+    {
+        if (!pending) return Texture2D(filename, PixelSpace::sRGB);
+
+        uploadService->wait(pending->upload);
+        return *(pending->resource);
+    };
+
     ////////////////////////////
     ///                      ///
     ///   Generate shaders   ///
@@ -103,7 +135,9 @@ void ShadowSandbox::run()
     ///                                       ///
     /////////////////////////////////////////////
 
+    JobSystemPtr jobSystem = std::make_shared<JobSystem>();
     ScenePtr scene = Factory::MakeScene();
+    scene->setJobSystem(jobSystem);
 
     PlaneGenerator::Parameters planeParameters = {
         PlaneTileSize,      // tileSizeX
@@ -127,9 +161,10 @@ void ShadowSandbox::run()
         glm::vec3(0.3203125f, 0.254296875f, 0.180859375f),
         128.f
     );
-    Texture2D floorTex = Texture2D("wood.png", PixelSpace::sRGB);
+    Texture2D floorTex = getTexture(floorTexUpload, "wood.png");
     floorMaterial.pushDiffuseMap(floorTex);
-    SceneObjectPtr floorObj = Factory::MakeSceneObjectWithMesh<MeshType::Plane>("Floor", planeParameters, floorMaterial, blinnPhongShader);
+    const MaterialHandle floorMaterialHandle = MaterialRegistry::Register(floorMaterial);
+    SceneObjectPtr floorObj = Factory::MakeSceneObjectWithMesh<MeshType::Plane>("Floor", planeParameters, floorMaterialHandle, blinnPhongShader);
 
     // WALLS
     Material wallMaterial = Material(
@@ -138,14 +173,15 @@ void ShadowSandbox::run()
         glm::vec3(0.25f, 0.15f, 0.15f), 
         2.f
     );
-    Texture2D wallTex = Texture2D("wall.jpg", PixelSpace::sRGB);
+    Texture2D wallTex = getTexture(wallTexUpload, "wall.jpg");
     wallMaterial.pushDiffuseMap(wallTex);
+    const MaterialHandle wallMaterialHandle = MaterialRegistry::Register(wallMaterial);
 
     // XY wall
-    SceneObjectPtr xyWallObj = Factory::MakeSceneObjectWithMesh<MeshType::Plane>("XY wall", planeParameters, wallMaterial, blinnPhongShader);
+    SceneObjectPtr xyWallObj = Factory::MakeSceneObjectWithMesh<MeshType::Plane>("XY wall", planeParameters, wallMaterialHandle, blinnPhongShader);
 
     // YZ wall
-    SceneObjectPtr yzWallObj = Factory::MakeSceneObjectWithMesh<MeshType::Plane>("YZ wall", planeParameters, wallMaterial, blinnPhongShader);
+    SceneObjectPtr yzWallObj = Factory::MakeSceneObjectWithMesh<MeshType::Plane>("YZ wall", planeParameters, wallMaterialHandle, blinnPhongShader);
 
     TorusGenerator::Parameters torusParameters = {
         4.f,    // toroidalRadius
@@ -155,10 +191,10 @@ void ShadowSandbox::run()
     };
 
     // TORUS
-    SceneObjectPtr torusObj = Factory::MakeSceneObjectWithMesh<MeshType::Torus>("Torus", torusParameters, Materials::Default, blinnPhongShader);
+    SceneObjectPtr torusObj = Factory::MakeSceneObjectWithMesh<MeshType::Torus>("Torus", torusParameters, MaterialRegistry::GetDefault(), blinnPhongShader);
 
     // LIGHT
-    SceneObjectPtr lightObj = Factory::MakeSceneObjectWithMesh<MeshType::Cube>("Light cube", {0.3f, {0.f, 0.f, 0.f}, false}, Materials::Default, fullLightShader);
+    SceneObjectPtr lightObj = Factory::MakeSceneObjectWithMesh<MeshType::Cube>("Light cube", {0.3f, {0.f, 0.f, 0.f}, false}, MaterialRegistry::GetDefault(), fullLightShader);
     std::shared_ptr<PointLight> light = std::make_shared<PointLight>(LightBaseRange);
     lightObj->addComponent<LightComponent>(light);
 
@@ -233,7 +269,7 @@ void ShadowSandbox::run()
     scene->registerScript(std::static_pointer_cast<Script>(gamepadCameraManager));
 
     // Window script
-    ControlledEntityManager<BasicWindowManager> windowManager;
+    ControlledEntityManager<BasicWindowManager> windowManager(_parameters.renderStatsPath);
 
     // Instantiate an input logger
     InputLoggerPtr logger = std::make_shared<InputLogger>();
@@ -242,46 +278,114 @@ void ShadowSandbox::run()
 
     // Register all input processors to the splitter
     InputSplitterPtr splitter = std::make_shared<InputSplitter>();
-    splitter->registerInputProcessor(std::static_pointer_cast<InputProcessor>(cameraManager));
-    splitter->registerInputProcessor(std::static_pointer_cast<InputProcessor>(cameraAspectRatioManager));
-    splitter->registerInputProcessor(std::static_pointer_cast<InputProcessor>(sandboxScript));
-    splitter->registerInputProcessor(std::static_pointer_cast<InputProcessor>(keyboardMovementScriptManager.getEventTranslator()));
-    splitter->registerInputProcessor(std::static_pointer_cast<InputProcessor>(windowManager.getEntity()));
-    splitter->registerInputProcessor(std::static_pointer_cast<InputProcessor>(windowManager.getEventTranslator()));
+    splitter->registerInputProcessor(cameraManager);
+    splitter->registerInputProcessor(cameraAspectRatioManager);
+    splitter->registerInputProcessor(sandboxScript);
+    splitter->registerInputProcessor(keyboardMovementScriptManager.getEventTranslator());
+    splitter->registerInputProcessor(windowManager.getEntity());
+    splitter->registerInputProcessor(windowManager.getEventTranslator());
 
     // Register all gamepad input processors to the splitter
-    splitter->registerGamepadInputProcessor(std::static_pointer_cast<GamepadInputProcessor>(gamepadMovementScript));
-    splitter->registerGamepadInputProcessor(std::static_pointer_cast<GamepadInputProcessor>(gamepadCameraManager));
+    splitter->registerGamepadInputProcessor(gamepadMovementScript);
+    splitter->registerGamepadInputProcessor(gamepadCameraManager);
 
     // Register the logger as both a classic input processor and a gamepad input processor
-    splitter->registerInputProcessor(std::static_pointer_cast<InputProcessor>(logger));
-    splitter->registerGamepadInputProcessor(std::static_pointer_cast<GamepadInputProcessor>(logger));
+    splitter->registerInputProcessor(logger);
+    splitter->registerGamepadInputProcessor(logger);
     
-    // Register the splitter to the window and the gamepad
-    _window->registerInputProcessor(std::static_pointer_cast<InputProcessor>(splitter));
-    if (_gamepadPresent)
+    // Buffer input so that it is processed on this thread rather than the polling thread
+    BufferedInputProcessorPtr bufferedInput = std::make_shared<BufferedInputProcessor>(
+        std::static_pointer_cast<InputProcessor>(splitter),
+        std::static_pointer_cast<GamepadInputProcessor>(splitter)
+    );
+
+    // Record input as it is processed, if requested
+    InputRecorderPtr inputRecorder = _makeInputRecorder();
+    if (inputRecorder)
     {
-        _gamepad->registerInputProcessor(std::static_pointer_cast<GamepadInputProcessor>(splitter));
+        splitter->registerInputProcessor(inputRecorder);
+        splitter->registerGamepadInputProcessor(inputRecorder);
+    }
+
+    // When replaying input, live input is ignored so that the replay is
+    // not disturbed
+    std::unique_ptr<InputReplayer> inputReplayer = _makeInputReplayer(splitter, _gamepad);
+
+    // Register the buffered input processor to the window and the gamepad
+    if (!inputReplayer)
+    {
+        _window->registerInputProcessor(std::static_pointer_cast<InputProcessor>(bufferedInput));
+        if (_gamepadPresent)
+        {
+            _gamepad->registerInputProcessor(std::static_pointer_cast<GamepadInputProcessor>(bufferedInput));
+        }
     }
 
     glClearColor(0.0f, 0.0f, 0.1f, 1.0f);
     glEnable(GL_DEPTH_TEST);
     glEnable(GL_STENCIL_TEST);
 
-    SceneRenderer sceneRenderer;
+    SceneRenderer sceneRenderer(jobSystem);
+    FrameScheduler frameScheduler;
+    frameScheduler.applySwapInterval(_window);
+
+    // In batch mode, frames are recorded one simulation step apart, as fast
+    // as they can be rendered
+    std::unique_ptr<FrameRecorder> recorder = _makeFrameRecorder();
+    const float batchTimestep = 1.f / _parameters.batchFrameRate;
+
+    // Index of the next simulation step, which recorded and replayed input
+    // is tagged with
+    uint32_t step = 0;
 
     while (!_window->exitSignaled())
     {
+        if (recorder && recorder->getCapturedFrameCount() == _parameters.batchFrameCount) break;
+        if (inputReplayer && inputReplayer->finished()) break;
+        if (!recorder) frameScheduler.waitForNextFrame();
+
         // Process awaiting render events
         _eventManager->processPendingEvents();
 
+        // Process input captured since the last frame
+        if (inputRecorder) inputRecorder->setStep(step);
+        bufferedInput->processPendingEvents();
+
         // Do a single render pass
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT); 
 
-        // Update and draw scene
-        scene->triggerUpdate();
-        sceneRenderer.renderScene(scene);
+        if (recorder)
+        {
+            if (inputReplayer) inputReplayer->replayStep(step);
+            scene->triggerUpdate(batchTimestep);
+            step++;
+            sceneRenderer.renderScene(scene);
+            recorder->capture();
+        }
+        else
+        {
+            // Update scene in fixed steps and draw it in between the last two
+            while (frameScheduler.stepSimulation())
+            {
+                if (inputReplayer) inputReplayer->replayStep(step);
+                scene->triggerUpdate(frameScheduler.getFixedTimestep());
+                step++;
+            }
+            sceneRenderer.renderScene(scene, frameScheduler.getInterpolationFactor());
+        }
         _window->swapBuffers();
+        RenderStats::EndFrame();
+    }
+
+    if (inputRecorder)
+    {
+        inputRecorder->finish();
+    }
+
+    if (recorder || inputReplayer)
+    {
+        if (recorder) recorder->finish();
+        _window->signalExit();
     }
 
     splitter->detachAllInputProcessors();
@@ -0,0 +1,335 @@
+#include "stress_sandbox.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
+
+#include <renderboi/window/gl_window.hpp>
+
+#include <renderboi/core/gpu_memory.hpp>
+#include <renderboi/core/material_registry.hpp>
+#include <renderboi/core/materials.hpp>
+#include <renderboi/core/mesh.hpp>
+#include <renderboi/core/render_stats.hpp>
+#include <renderboi/core/frame_of_reference.hpp>
+#include <renderboi/core/lights/point_light.hpp>
+#include <renderboi/core/shader/shader_builder.hpp>
+#include <renderboi/core/shader/shader_program_registry.hpp>
+#include <renderboi/core/ubo/light_ubo.hpp>
+
+#include <renderboi/utilities/job_system.hpp>
+
+#include <renderboi/toolbox/factory.hpp>
+#include <renderboi/toolbox/input_splitter.hpp>
+#include <renderboi/toolbox/controls/controlled_entity_manager.hpp>
+#include <renderboi/toolbox/mesh_generators/mesh_type.hpp>
+#include <renderboi/toolbox/scene/scene.hpp>
+#include <renderboi/toolbox/scene/scene_object.hpp>
+#include <renderboi/toolbox/scene/components/all_components.hpp>
+#include <renderboi/toolbox/runnables/mouse_camera_manager.hpp>
+#include <renderboi/toolbox/runnables/keyboard_movement_script.hpp>
+#include <renderboi/toolbox/runnables/basic_window_manager.hpp>
+#include <renderboi/toolbox/runnables/camera_aspect_ratio_manager.hpp>
+
+namespace Renderboi
+{
+
+using Ref = FrameOfReference;
+
+namespace
+{
+
+/// @brief Get how many objects a hierarchy of the given shape holds.
+unsigned int hierarchySize(const unsigned int depth, const unsigned int branching, const unsigned int max)
+{
+    uint64_t size = 0;
+    uint64_t levelSize = 1;
+    for (unsigned int level = 0; level < depth && size < max; level++)
+    {
+        size += levelSize;
+        levelSize *= branching;
+    }
+
+    return (unsigned int)std::min<uint64_t>(size, max);
+}
+
+/// @brief Pick evenly spread objects out of an array.
+std::vector<SceneObjectPtr> spread(const std::vector<SceneObjectPtr>& objects, const std::size_t count)
+{
+    std::vector<SceneObjectPtr> result;
+    if (count == 0) return result;
+
+    result.reserve(count);
+    const double step = (double)objects.size() / (double)count;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        result.push_back(objects[(std::size_t)(i * step)]);
+    }
+
+    return result;
+}
+
+}//namespace
+
+StressSandbox::StressSandbox(const GLWindowPtr window, const GLSandboxParameters params) :
+    GLSandbox(window, params)
+{
+    StressSandboxParameters& stress = _parameters.stress;
+
+    stress.objectCount = std::max(stress.objectCount, 1u);
+    stress.depth = std::max(stress.depth, 1u);
+    stress.branching = std::max(stress.branching, 1u);
+    stress.lightCount = std::min(stress.lightCount, stress.objectCount);
+    stress.scriptCount = std::min(stress.scriptCount, stress.objectCount);
+    stress.animatedFraction = std::clamp(stress.animatedFraction, 0.f, 1.f);
+
+    if (stress.lightCount > LightUBO::PointLightMaxCount)
+    {
+        std::cerr << "StressSandbox: at most " << LightUBO::PointLightMaxCount << " point lights are supported, "
+                  << stress.lightCount << " were requested." << std::endl;
+        stress.lightCount = LightUBO::PointLightMaxCount;
+    }
+}
+
+void StressSandbox::setUp()
+{
+    // Update window title
+    _title = _window->getTitle();
+    _window->setTitle(_title + " - Stress (" + std::to_string(_parameters.stress.objectCount) + " objects)");
+
+    // Remove cursor from window
+    namespace InputMode = Window::Input::Mode;
+    _window->setInputMode(InputMode::Target::Cursor, InputMode::Value::DisabledCursor);
+}
+
+void StressSandbox::run()
+{
+    GLSandbox::_initContext();
+
+    const StressSandboxParameters& stress = _parameters.stress;
+
+    ShaderConfig lightConfig;
+    lightConfig.addFeature(ShaderFeature::VertexMVP);
+    lightConfig.addFeature(ShaderFeature::FragmentMeshMaterial);
+    lightConfig.addFeature(ShaderFeature::FragmentBlinnPhong);
+    const ShaderProgramHandle lightingShader = ShaderProgramRegistry::Register(ShaderBuilder::BuildShaderProgramFromConfig(lightConfig));
+
+    JobSystemPtr jobSystem = std::make_shared<JobSystem>();
+    ScenePtr scene = Factory::MakeScene();
+    scene->setJobSystem(jobSystem);
+
+    // All objects share a handful of meshes and materials, so that the load
+    // lies in the amount of objects rather than in the amount of resources
+    const std::vector<MeshPtr> meshes = {
+        Factory::MakeMesh<MeshType::Cube>({1.f, {0.f, 0.f, 0.f}, false}),
+        Factory::MakeMesh<MeshType::Torus>({1.f, 0.3f, 24, 12}),
+        Factory::MakeMesh<MeshType::Tetrahedron>({1.f})
+    };
+    const std::vector<MaterialHandle> materials = {
+        MaterialRegistry::Register(Materials::Emerald),
+        MaterialRegistry::Register(Materials::Gold),
+        MaterialRegistry::Register(Materials::Ruby),
+        MaterialRegistry::Register(Materials::Silver)
+    };
+
+    ////////////////////////////////////
+    ///                              ///
+    ///   Populate object hierarchy  ///
+    ///                              ///
+    ////////////////////////////////////
+
+    // Objects are laid out in identical hierarchies, filled level by level:
+    // within a hierarchy, the parent of the object at index k is the one at
+    // index (k - 1) / branching
+    const unsigned int treeSize = hierarchySize(stress.depth, stress.branching, stress.objectCount);
+    const unsigned int treeCount = (stress.objectCount + treeSize - 1) / treeSize;
+    const unsigned int gridSide = (unsigned int)std::ceil(std::sqrt((float)treeCount));
+
+    std::vector<SceneObjectPtr> objects;
+    objects.reserve(stress.objectCount);
+
+    for (unsigned int i = 0; i < stress.objectCount; i++)
+    {
+        SceneObjectPtr object = Factory::MakeSceneObject();
+        object->addComponent<MeshComponent>(meshes[i % meshes.size()], materials[i % materials.size()], lightingShader);
+
+        const unsigned int tree = i / treeSize;
+        const unsigned int k = i % treeSize;
+        if (k == 0)
+        {
+            scene->registerObject(object);
+
+            const glm::vec2 cell = {(float)(tree % gridSide), (float)(tree / gridSide)};
+            const glm::vec2 position = (cell - (float)gridSide / 2.f) * RootSpacing;
+            object->transform.setPosition<Ref::Parent>({position.x, 0.f, position.y});
+        }
+        else
+        {
+            const unsigned int parentIndex = tree * treeSize + (k - 1) / stress.branching;
+            scene->registerObject(object, objects[parentIndex]->id);
+
+            // Children are spread on a circle around their parent, and
+            // shrink from one level to the next
+            const float angle = glm::two_pi<float>() * (float)((k - 1) % stress.branching) / (float)stress.branching;
+            object->transform.setPosition<Ref::Parent>(ChildDistance * glm::vec3(std::cos(angle), 0.f, std::sin(angle)));
+            object->transform.scaleBy(glm::vec3(ChildScale));
+        }
+
+        objects.push_back(object);
+    }
+
+    // Lights
+    const std::vector<SceneObjectPtr> litObjects = spread(objects, stress.lightCount);
+    for (const SceneObjectPtr& object : litObjects)
+    {
+        object->addComponent<LightComponent>(std::make_shared<PointLight>(LightRange));
+    }
+
+    // Per-object scripts, which declare their accesses and may thus be
+    // updated concurrently
+    const std::vector<SceneObjectPtr> scriptedObjects = spread(objects, stress.scriptCount);
+    for (const SceneObjectPtr& object : scriptedObjects)
+    {
+        object->addComponent<ScriptComponent>(std::make_shared<StressObjectScript>());
+    }
+
+    // Animation of a fraction of the objects
+    const std::size_t animatedCount = (std::size_t)std::round(stress.animatedFraction * (float)objects.size());
+    std::shared_ptr<StressAnimationScript> animationScript = std::make_shared<StressAnimationScript>(spread(objects, animatedCount));
+    scene->registerScript(std::static_pointer_cast<Script>(animationScript));
+
+    std::cout << "StressSandbox: " << objects.size() << " objects in " << treeCount << " hierarchies of up to "
+              << treeSize << " objects (depth " << stress.depth << ", branching " << stress.branching << "), "
+              << litObjects.size() << " lights, " << scriptedObjects.size() << " scripts, "
+              << animatedCount << " animated transforms." << std::endl;
+
+    // CAMERA
+    SceneObjectPtr cameraObj = Factory::MakeSceneObject("Camera");
+    CameraPtr camera = std::make_shared<Camera>(CameraParams);
+    cameraObj->addComponent<CameraComponent>(camera);
+    scene->registerObject(cameraObj);
+
+    // Look at the whole grid of hierarchies from one of its corners
+    const float gridExtent = std::max(gridSide * RootSpacing, RootSpacing) / 2.f;
+    cameraObj->transform.setPosition<Ref::World>({gridExtent, gridExtent, gridExtent});
+    cameraObj->transform.rotateBy<Ref::Parent>(glm::radians(180.f), Transform::Y);
+
+    // Link camera to MouseCameraManager
+    std::shared_ptr<MouseCameraManager> cameraManager = std::make_shared<MouseCameraManager>(camera);
+
+    // Link camera to CameraAspectRatioManager
+    std::shared_ptr<CameraAspectRatioManager> cameraAspectRatioManager = std::make_shared<CameraAspectRatioManager>(camera);
+
+    // Add script component to camera: KeyboardMovementScript, fast enough to
+    // get around large scenes
+    ControlledEntityManager<KeyboardMovementScript> keyboardScriptManager(std::static_pointer_cast<BasisProvider>(camera), gridExtent / 4.f);
+    cameraObj->addComponent<ScriptComponent>(std::static_pointer_cast<Script>(keyboardScriptManager.getEntity()));
+
+    // Window script
+    ControlledEntityManager<BasicWindowManager> windowManager(_parameters.renderStatsPath);
+
+    // Register the camera managers and the control translators to the splitter
+    InputSplitterPtr splitter = std::make_shared<InputSplitter>();
+    splitter->registerInputProcessor(cameraManager);
+    splitter->registerInputProcessor(cameraAspectRatioManager);
+    splitter->registerInputProcessor(keyboardScriptManager.getEventTranslator());
+    splitter->registerInputProcessor(windowManager.getEntity());
+    splitter->registerInputProcessor(windowManager.getEventTranslator());
+
+    // Frame times are only relevant to the frames of this scene
+    RenderStats::Reset();
+    const unsigned int renderedFrames = _runPipelinedLoop(scene, splitter, [this](const unsigned int frame)
+    {
+        if (frame % ReportInterval == 0)
+        {
+            _reportFrameTimes("StressSandbox: frame " + std::to_string(frame));
+        }
+    });
+
+    _reportFrameTimes("StressSandbox: last " + std::to_string(std::min<std::size_t>(renderedFrames, RenderStats::HistorySize)) + " frames");
+
+    Factory::DestroyScene(scene);
+
+    GLSandbox::_terminateContext();
+}
+
+void StressSandbox::tearDown()
+{
+    // Reset everything back to how it was
+    namespace InputMode = Window::Input::Mode;
+    _window->setInputMode(InputMode::Target::Cursor, InputMode::Value::NormalCursor);
+    _window->detachInputProcessor();
+    _window->setTitle(_title);
+}
+
+void StressSandbox::_reportFrameTimes(const std::string& header) const
+{
+    const RenderStats::Summary frameTime = RenderStats::SummarizeFrameTime();
+    const RenderStats::Summary drawCalls = RenderStats::Summarize(RenderCounter::DrawCalls);
+    const GPUMemory::Usage memory = GPUMemory::GetTotalUsage();
+
+    constexpr double MiB = 1024. * 1024.;
+    const uint64_t budget = GPUMemory::GetBudget();
+
+    std::cout << header << ": frame time (ms) mean " << frameTime.mean
+              << ", median " << frameTime.median
+              << ", p95 " << frameTime.p95
+              << ", p99 " << frameTime.p99
+              << ", max " << frameTime.max
+              << " (" << drawCalls.mean << " draw calls per frame)\n"
+              << header << ": GPU memory (MiB) " << memory.bytes / MiB
+              << ", high-water mark " << memory.highWaterMark / MiB
+              << ", evicted " << GPUMemory::GetEvictedBytes() / MiB;
+    if (budget)
+    {
+        std::cout << " (budget " << budget / MiB << ")";
+    }
+    std::cout << std::endl;
+}
+
+StressAnimationScript::StressAnimationScript(std::vector<SceneObjectPtr> objects) :
+    _objects(std::move(objects))
+{
+
+}
+
+void StressAnimationScript::update(float timeElapsed)
+{
+    const float angle = glm::radians(RotationSpeed * timeElapsed);
+    for (const SceneObjectPtr& object : _objects)
+    {
+        object->transform.rotateBy<Ref::Parent>(angle, RotationAxis);
+    }
+}
+
+StressAnimationScript* StressAnimationScript::clone() const
+{
+    return new StressAnimationScript(_objects);
+}
+
+void StressObjectScript::update(float timeElapsed)
+{
+    _sceneObject->transform.rotateBy<Ref::Self>(glm::radians(RotationSpeed * timeElapsed), RotationAxis);
+}
+
+Script::DataAccess StressObjectScript::getDataAccess() const
+{
+    DataAccess access;
+    access.write(_sceneObject.get());
+    return access;
+}
+
+StressObjectScript* StressObjectScript::clone() const
+{
+    return new StressObjectScript();
+}
+
+}//namespace Renderboi
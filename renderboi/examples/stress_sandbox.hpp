@@ -0,0 +1,160 @@
+#ifndef RENDERBOI__EXAMPLES__STRESS_SANDBOX_HPP
+#define RENDERBOI__EXAMPLES__STRESS_SANDBOX_HPP
+
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "gl_sandbox.hpp"
+#include "gl_sandbox_parameters.hpp"
+
+#include <renderboi/core/camera.hpp>
+
+#include <renderboi/window/gl_window.hpp>
+
+#include <renderboi/toolbox/script.hpp>
+#include <renderboi/toolbox/scene/scene_object.hpp>
+
+namespace Renderboi
+{
+
+/// @brief Load test populating a scene with a configurable amount of
+/// meshes, lights and scripts, laid out in hierarchies of configurable
+/// depth and branching, a fraction of which are animated every frame.
+/// Frame time and GPU memory statistics are printed periodically and when
+/// the sandbox exits.
+class StressSandbox : public GLSandbox
+{
+    private:
+        /// @brief Used to temporarily store the original title of the window.
+        std::string _title;
+
+        /// @brief Print a summary of the frame times of the last frames, and
+        /// of the GPU memory usage.
+        ///
+        /// @param header Text to print before the summary.
+        void _reportFrameTimes(const std::string& header) const;
+
+    public:
+        static constexpr Camera::CameraParameters CameraParams = {-45.f, -40.f, 1.f};
+
+        /// @brief Distance between the roots of two hierarchies.
+        static constexpr float RootSpacing = 8.f;
+
+        /// @brief Distance between an object and its children, in the space
+        /// of the object.
+        static constexpr float ChildDistance = 3.f;
+
+        /// @brief Scale of an object relative to its parent.
+        static constexpr float ChildScale = 0.5f;
+
+        /// @brief Range of the point lights of the scene.
+        static constexpr float LightRange = 20.f;
+
+        /// @brief How many frames pass between two frame time reports.
+        static constexpr unsigned int ReportInterval = 600;
+
+		/// @param window Pointer to the window on which the sandbox should run.
+        /// @param params Strcture packing the parameters according to which the
+        /// sandbox should run.
+        StressSandbox(const GLWindowPtr window, const GLSandboxParameters params);
+
+        /////////////////////////////////////////
+        ///                                   ///
+        /// Methods overridden from GLSandbox ///
+        ///                                   ///
+        /////////////////////////////////////////
+
+		/// @brief Set up the window prior to running the example. Will be
+		/// called from the main thread.
+		///
+		/// @param window Pointer to the window to initialize.
+		virtual void setUp() override;
+
+        /// @brief Run something in the provided GL window. To be executed by
+		/// a separate thread.
+		///
+		/// @param window Pointer to the window to run stuff in.
+		virtual void run() override;
+
+		/// @brief Restore the window back to how it was before the example ran.
+		/// The contents of this function should be the opposite from those in
+		/// setUp(). Will be called from the main thread once run() has returned.
+		///
+		/// @param window Pointer to the window to detach from.
+		virtual void tearDown() override;
+};
+
+// Animate the fraction of the objects of the StressSandbox which should move
+// every frame
+class StressAnimationScript : public Script
+{
+    private:
+        /// @brief Pointers to the objects to animate.
+        std::vector<SceneObjectPtr> _objects;
+
+    public:
+        static constexpr glm::vec3 RotationAxis = {0.f, 1.f, 0.f};
+        static constexpr float RotationSpeed = 30.f;
+
+        /// @param objects Pointers to the objects to animate.
+        StressAnimationScript(std::vector<SceneObjectPtr> objects);
+
+        //////////////////////////////////////
+        ///                                ///
+        /// Methods overridden from Script ///
+        ///                                ///
+        //////////////////////////////////////
+
+        /// @brief Make the script run and do its things.
+        ///
+        /// @param timeElapsed How much time passed (in seconds) since the last
+        /// update.
+        void update(float timeElapsed) override;
+
+        /// @brief Get a raw pointer to a new script instance cloned
+        /// from this one. Ownership and responsibility for the allocated
+        /// resources are fully transferred to the caller.
+        ///
+        /// @return A raw pointer to the script instance cloned from this one.
+        StressAnimationScript* clone() const override;
+};
+
+// Spin the object of the StressSandbox it is attached to, independently from
+// the other scripts of the scene
+class StressObjectScript : public Script
+{
+    public:
+        static constexpr glm::vec3 RotationAxis = {0.f, 1.f, 0.f};
+        static constexpr float RotationSpeed = 90.f;
+
+        //////////////////////////////////////
+        ///                                ///
+        /// Methods overridden from Script ///
+        ///                                ///
+        //////////////////////////////////////
+
+        /// @brief Make the script run and do its things.
+        ///
+        /// @param timeElapsed How much time passed (in seconds) since the last
+        /// update.
+        void update(float timeElapsed) override;
+
+        /// @brief Declare which data the script accesses when it is updated:
+        /// it only writes to the object it is attached to.
+        ///
+        /// @return The data access of the script.
+        DataAccess getDataAccess() const override;
+
+        /// @brief Get a raw pointer to a new script instance cloned
+        /// from this one. Ownership and responsibility for the allocated
+        /// resources are fully transferred to the caller.
+        ///
+        /// @return A raw pointer to the script instance cloned from this one.
+        StressObjectScript* clone() const override;
+};
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__EXAMPLES__STRESS_SANDBOX_HPP
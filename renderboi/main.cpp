@@ -1,3 +1,4 @@
+#include <cstdint>
 #include <stdexcept>
 #include <filesystem>
 #include <iostream>
@@ -11,15 +12,19 @@
 #include <renderboi/window/enums.hpp>
 #include <renderboi/window/window_factory.hpp>
 #include <renderboi/window/window_backend.hpp>
-#include <renderboi/window/glfw3/glfw3_utilities.hpp>
 
 #include <renderboi/examples/gl_sandbox.hpp>
 #include <renderboi/examples/gl_sandbox_parameters.hpp>
 #include <renderboi/examples/gl_sandbox_runner.hpp>
 #include <renderboi/examples/lighting_sandbox.hpp>
 #include <renderboi/examples/shadow_sandbox.hpp>
+#include <renderboi/examples/stress_sandbox.hpp>
+
+#include <renderboi/core/gpu_memory.hpp>
+#include <renderboi/core/render_stats.hpp>
 
 #include <renderboi/utilities/gl_utilities.hpp>
+#include <renderboi/utilities/profiler.hpp>
 #include <renderboi/utilities/resource_locator.hpp>
 
 #include "project_env.hpp"
@@ -82,6 +87,9 @@ int main(int argc, char** argv)
 		return EXIT_FAILURE;
 	}
 
+	// In batch mode, frames are recorded rather than shown
+	const bool batchMode = rbParams.batchFrameCount > 0;
+
 	// RAII-friendly scope :)
 	{
 		// Init window, GL context and GL pointers
@@ -100,11 +108,11 @@ int main(int argc, char** argv)
 			true,								// autoMinimize
 			true,								// decorated
 			false,								// transparentFramebuffer
-			true,								// visible
+			!batchMode,							// visible
 			false,								// maximized
 			false,								// alwaysOnTop
-			true,								// focused
-			true,								// focusOnShow
+			!batchMode,							// focused
+			!batchMode,							// focusOnShow
 			true,								// scaleToMonitor
 			true								// debug
 		};
@@ -123,29 +131,114 @@ int main(int argc, char** argv)
 			return EXIT_FAILURE; 
 		}
 
+		// Hidden window sharing the context of the main one, for resources
+		// to be uploaded from another thread
+		rbw::GLWindowPtr uploadWindow;
+		rbw::WindowCreationParameters uploadWindowParams = windowParams;
+		uploadWindowParams.title = "RenderBoi (upload)";
+		uploadWindowParams.shareContext = window;
+		uploadWindowParams.visible = false;
+		uploadWindowParams.focused = false;
+		uploadWindowParams.focusOnShow = false;
+
+		try
+		{
+			uploadWindow = AppWindowFactory::MakeWindow(uploadWindowParams);
+		}
+		catch(const std::exception& e)
+		{
+			std::cerr 	<< "Exception thrown during upload window creation:\n"
+						<< e.what() << '\n'
+						<< "Resources will be uploaded from the main thread." << std::endl;
+		}
+
 		rb::glIgnoreDebugMessagesOfType(GL_DEBUG_TYPE_PERFORMANCE_ARB);
 
 		const rb::GLSandboxParameters sbParams = {
-			.debug = true
+			.debug = true,
+			.uploadWindow = uploadWindow,
+			.batchFrameCount = rbParams.batchFrameCount,
+			.batchFrameRate = rbParams.batchFrameRate,
+			.batchOutputPath = rbParams.batchOutputPath,
+			.batchOutputFormat = rbParams.batchOutputFormat,
+			.inputRecordPath = rbParams.inputRecordPath,
+			.inputReplayPath = rbParams.inputReplayPath,
+			.renderStatsPath = rbParams.renderStatsPath,
+			.stress = rbParams.stress
 		};
 
-		// Run examples
+		rb::Profiler::SetEnabled(!rbParams.profileOutputPath.empty());
+		rb::GPUMemory::SetBudget((uint64_t)rbParams.gpuMemoryBudget * 1024 * 1024);
+
+		if (rbParams.gamepadSamplingThread)
+		{
+			if (window->getGamepadManager()->supportsSamplingThread())
+			{
+				window->startGamepadSamplingThread();
+			}
+			else
+			{
+				std::cerr << "The window backend does not support sampling gamepads on a dedicated thread, "
+						  << "they will be sampled on the main thread." << std::endl;
+			}
+		}
+
+		// Run the selected example
 
-		if (false)
+		if (rbParams.example == RenderboiExample::Lighting)
 		{
 			rb::GLSandboxRunner<rb::LightingSandbox> lightingSandbox =
 			rb::GLSandboxRunner<rb::LightingSandbox>(window, sbParams);
 
 			lightingSandbox.run();
 		}
-
+		else if (rbParams.example == RenderboiExample::Shadow)
 		{
 			rb::GLSandboxRunner<rb::ShadowSandbox> shadowSandbox =
 			rb::GLSandboxRunner<rb::ShadowSandbox>(window, sbParams);
 
 			shadowSandbox.run();
 		}
+		else if (rbParams.example == RenderboiExample::Stress)
+		{
+			rb::GLSandboxRunner<rb::StressSandbox> stressSandbox =
+			rb::GLSandboxRunner<rb::StressSandbox>(window, sbParams);
+
+			stressSandbox.run();
+		}
+
+		window->stopGamepadSamplingThread();
+
+		if (!rbParams.profileOutputPath.empty())
+		{
+			try
+			{
+				rb::Profiler::ExportChromeTrace(rbParams.profileOutputPath);
+			}
+			catch(const std::exception& e)
+			{
+				std::cerr 	<< "Exception thrown during profile export:\n"
+							<< e.what() << std::endl;
+			}
+		}
 
+		if (rbParams.renderStatsOnExit)
+		{
+			try
+			{
+				rb::RenderStats::Export(rbParams.renderStatsPath);
+			}
+			catch(const std::exception& e)
+			{
+				std::cerr 	<< "Exception thrown during render statistics export:\n"
+							<< e.what() << std::endl;
+			}
+		}
+
+		if (uploadWindow)
+		{
+			AppWindowFactory::DestroyWindow(uploadWindow);
+		}
 		AppWindowFactory::DestroyWindow(window);
 	}
 
@@ -2,6 +2,7 @@
 
 #include <filesystem>
 #include <iostream>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -20,15 +21,74 @@
 namespace rb = Renderboi;
 namespace fs = std::filesystem;
 
+namespace
+{
+
+bool parseCount(const char* arg, unsigned int& dest, const bool allowZero = false)
+{
+    try
+    {
+        size_t end;
+        const unsigned long value = std::stoul(arg, &end);
+        if (arg[end] != '\0' || (value == 0 && !allowZero)) return false;
+
+        dest = (unsigned int)value;
+        return true;
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+}
+
+bool parseFraction(const char* arg, float& dest)
+{
+    try
+    {
+        size_t end;
+        const float value = std::stof(arg, &end);
+        if (arg[end] != '\0' || value < 0.f || value > 1.f) return false;
+
+        dest = value;
+        return true;
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+}
+
+}//namespace
+
 bool processArguments(const int argc, char* const* argv, RenderboiParameters& dest)
 {
+    using OutputFormat = rb::FrameRecorder::OutputFormat;
+
     static option cliOptions[] = {
-        {"assets", required_argument, nullptr, 'a'}
+        {"assets",         required_argument, nullptr, 'a'},
+        {"frames",         required_argument, nullptr, 'n'},
+        {"rate",           required_argument, nullptr, 'r'},
+        {"output",         required_argument, nullptr, 'o'},
+        {"format",         required_argument, nullptr, 'f'},
+        {"record",         required_argument, nullptr, 'R'},
+        {"replay",         required_argument, nullptr, 'P'},
+        {"profile",        required_argument, nullptr, 'p'},
+        {"stats",          required_argument, nullptr, 's'},
+        {"budget",         required_argument, nullptr, 'M'},
+        {"gamepad-thread", no_argument,       nullptr, 'G'},
+        {"example",        required_argument, nullptr, 'e'},
+        {"objects",        required_argument, nullptr, 'N'},
+        {"lights",         required_argument, nullptr, 'L'},
+        {"scripts",        required_argument, nullptr, 'S'},
+        {"depth",          required_argument, nullptr, 'D'},
+        {"branching",      required_argument, nullptr, 'B'},
+        {"animated",       required_argument, nullptr, 'A'},
+        {nullptr,          0,                 nullptr, 0}
     };
 
     int opt;
     int index;
-    while ((opt = getopt_long(argc, argv, "a:", cliOptions, &index)) != -1)
+    while ((opt = getopt_long(argc, argv, "a:n:r:o:f:R:P:p:s:M:Ge:N:L:S:D:B:A:", cliOptions, &index)) != -1)
     {
         switch (opt)
         {
@@ -36,18 +96,149 @@ bool processArguments(const int argc, char* const* argv, RenderboiParameters& de
             dest.assetsPath = fs::current_path() / fs::path(optarg);
             break;
 
-        default:
+        case 'n':
+            if (!parseCount(optarg, dest.batchFrameCount)) return false;
+            break;
+
+        case 'r':
+            if (!parseCount(optarg, dest.batchFrameRate)) return false;
+            break;
+
+        case 'o':
+            dest.batchOutputPath = fs::current_path() / fs::path(optarg);
+            break;
+
+        case 'f':
+            if (std::string(optarg) == "png")
+            {
+                dest.batchOutputFormat = OutputFormat::PngSequence;
+            }
+            else if (std::string(optarg) == "y4m")
+            {
+                dest.batchOutputFormat = OutputFormat::Y4M;
+            }
+            else
+            {
+                return false;
+            }
+            break;
+
+        case 'R':
+            dest.inputRecordPath = fs::current_path() / fs::path(optarg);
+            break;
+
+        case 'P':
+            dest.inputReplayPath = fs::current_path() / fs::path(optarg);
+            break;
+
+        case 'p':
+            dest.profileOutputPath = fs::current_path() / fs::path(optarg);
+            break;
+
+        case 's':
+            dest.renderStatsPath = fs::current_path() / fs::path(optarg);
+            dest.renderStatsOnExit = true;
+            break;
+
+        case 'e':
+            if (std::string(optarg) == "lighting")
+            {
+                dest.example = RenderboiExample::Lighting;
+            }
+            else if (std::string(optarg) == "shadow")
+            {
+                dest.example = RenderboiExample::Shadow;
+            }
+            else if (std::string(optarg) == "stress")
+            {
+                dest.example = RenderboiExample::Stress;
+            }
+            else
+            {
+                return false;
+            }
+            break;
+
+        case 'M':
+            if (!parseCount(optarg, dest.gpuMemoryBudget)) return false;
+            break;
+
+        case 'G':
+            dest.gamepadSamplingThread = true;
+            break;
+
+        case 'N':
+            if (!parseCount(optarg, dest.stress.objectCount)) return false;
+            break;
+
+        case 'L':
+            if (!parseCount(optarg, dest.stress.lightCount, true)) return false;
+            break;
+
+        case 'S':
+            if (!parseCount(optarg, dest.stress.scriptCount, true)) return false;
+            break;
+
+        case 'D':
+            if (!parseCount(optarg, dest.stress.depth)) return false;
+            break;
+
+        case 'B':
+            if (!parseCount(optarg, dest.stress.branching)) return false;
+            break;
+
+        case 'A':
+            if (!parseFraction(optarg, dest.stress.animatedFraction)) return false;
             break;
+
+        default:
+            return false;
         }
     }
 
+    // Input cannot be recorded and replayed at once
+    if (!dest.inputRecordPath.empty() && !dest.inputReplayPath.empty()) return false;
+
+    if (dest.batchOutputPath.empty())
+    {
+        dest.batchOutputPath = fs::current_path() /
+            ((dest.batchOutputFormat == OutputFormat::Y4M) ? "frames.y4m" : "frames");
+    }
+
+    if (dest.renderStatsPath.empty())
+    {
+        dest.renderStatsPath = fs::current_path() / "render_stats.json";
+    }
+
     return optind >= argc;
 }
 
 void printHelp()
 {
     std::cout   << PROJECT_NAME << " demo executable, v" << PROJECT_VERSION << "\n"
-                << "Usage: " << PROJECT_NAME << " [(-a|--assets) <path>]\n"
+                << "Usage: " << PROJECT_NAME << " [(-a|--assets) <path>] [(-e|--example) lighting|shadow|stress] [(-n|--frames) <count> [(-r|--rate) <fps>] [(-o|--output) <out>] [(-f|--format) png|y4m]] [(-R|--record) <log> | (-P|--replay) <log>] [(-p|--profile) <trace>] [(-s|--stats) <stats>] [(-M|--budget) <MiB>] [-G|--gamepad-thread]\n"
+                << "       [(-N|--objects) <n>] [(-L|--lights) <n>] [(-S|--scripts) <n>] [(-D|--depth) <n>] [(-B|--branching) <n>] [(-A|--animated) <fraction>]\n"
+                << "\n"
+                << "<path>: path to the directory where assets/ is located.\n"
+                << "<count>: render <count> frames at a fixed timestep and record them, then exit (batch mode).\n"
+                << "<fps>: frames per simulated second in batch mode (default: 60).\n"
+                << "<out>: directory (png) or file (y4m) to record frames to (default: frames/ or frames.y4m).\n"
+                << "<log>: file to record input to, or to replay input from instead of live input, then exit.\n"
+                << "<trace>: file to export profiled zones to, in the Chrome trace event format.\n"
+                << "<stats>: file to dump render statistics to at exit, as CSV if it ends in .csv, JSON otherwise.\n"
+                << "<MiB>: GPU memory budget, over which unused streamed textures and mesh levels of detail are evicted (default: none).\n"
+                << "\n"
+                << "Stress example (load test, prints frame time statistics):\n"
+                << "--objects: objects to populate the scene with, each with a mesh (default: 10000).\n"
+                << "--lights: objects carrying a point light, at most 64 (default: 16).\n"
+                << "--scripts: objects carrying a script of their own (default: 1000).\n"
+                << "--depth: levels of each object hierarchy, 1 making all objects roots (default: 4).\n"
+                << "--branching: children of each object of a hierarchy (default: 4).\n"
+                << "--animated: fraction of the objects whose transform is animated every frame (default: 0.1).\n"
                 << "\n"
-                << "<path>: path to the directory where assets/ is located." << std::endl;
+                << "Batch mode is best run with the headless EGL window backend.\n"
+                << "Gamepads are sampled on a dedicated thread with --gamepad-thread if the window backend supports it (GLFW3 does not), on the main thread otherwise.\n"
+                << "Replayed input reproduces the recorded session step for step, regardless of frame rate.\n"
+                << "Profiled zones are only recorded in debug builds, or when built with RENDERBOI_PROFILING.\n"
+                << "Render statistics of the last frames can also be dumped at any time with F12 (default: render_stats.json)." << std::endl;
 }
@@ -3,9 +3,68 @@
 
 #include <filesystem>
 
+#include <renderboi/examples/gl_sandbox_parameters.hpp>
+
+#include <renderboi/toolbox/frame_recorder.hpp>
+
+/// @brief Collection of litterals describing the sandboxes the demo
+/// executable can run.
+enum class RenderboiExample
+{
+    Lighting,
+    Shadow,
+    Stress
+};
+
 struct RenderboiParameters
 {
     std::filesystem::path assetsPath;
+
+    /// @brief Which sandbox to run.
+    RenderboiExample example = RenderboiExample::Shadow;
+
+    /// @brief Parameters of the scene populated by the stress sandbox.
+    Renderboi::StressSandboxParameters stress;
+
+    /// @brief How many frames to render and record in batch mode. 0 runs
+    /// the examples interactively.
+    unsigned int batchFrameCount = 0;
+
+    /// @brief Rate (in Hz) at which frames are simulated and recorded in
+    /// batch mode.
+    unsigned int batchFrameRate = 60;
+
+    /// @brief Path to record frames to in batch mode. Left empty, a default
+    /// path depending on the output format is used.
+    std::filesystem::path batchOutputPath;
+
+    /// @brief Format to record frames in in batch mode.
+    Renderboi::FrameRecorder::OutputFormat batchOutputFormat = Renderboi::FrameRecorder::OutputFormat::PngSequence;
+
+    /// @brief Path to record input to. Left empty, input is not recorded.
+    std::filesystem::path inputRecordPath;
+
+    /// @brief Path to an input log to replay instead of live input. Left
+    /// empty, live input is processed.
+    std::filesystem::path inputReplayPath;
+
+    /// @brief Path to export profiled zones to, in the Chrome trace event
+    /// format. Left empty, zones are not recorded.
+    std::filesystem::path profileOutputPath;
+
+    /// @brief Path to dump render statistics to, on request (F12) or at
+    /// exit. Left empty, a default path is used.
+    std::filesystem::path renderStatsPath;
+
+    /// @brief Whether to dump render statistics at exit.
+    bool renderStatsOnExit = false;
+
+    /// @brief GPU memory budget (in MiB) to enforce. 0 enforces no budget.
+    unsigned int gpuMemoryBudget = 0;
+
+    /// @brief Whether to sample gamepads on a dedicated thread, if the window
+    /// backend supports it.
+    bool gamepadSamplingThread = false;
 };
 
-#endif//RENDERBOI__RENDERBOI_PARAMETERS_HPP
\ No newline at end of file
+#endif//RENDERBOI__RENDERBOI_PARAMETERS_HPP
@@ -0,0 +1,140 @@
+#ifndef RENDERBOI__TOOLBOX__CONTROLS__CONTROL_BINDING_TABLE_HPP
+#define RENDERBOI__TOOLBOX__CONTROLS__CONTROL_BINDING_TABLE_HPP
+
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <renderboi/window/enums.hpp>
+
+#include "control.hpp"
+
+namespace Renderboi
+{
+
+/// @brief Immutable snapshot of control bindings, compiled into a dense
+/// table indexed by key and mouse button codes. The actions bound to all
+/// controls are stored contiguously, and those bound to a single control
+/// are found with two indexed loads, without traversing any tree.
+///
+/// @tparam T Class representing the action to which a control can be bound.
+template<typename T>
+class ControlBindingTable
+{
+private:
+    /// @brief How many slots of the table are taken by keys.
+    static constexpr unsigned int KeySlotCount = (unsigned int)Window::Input::Key::Menu + 1;
+
+    /// @brief How many slots of the table are taken by mouse buttons.
+    static constexpr unsigned int MouseButtonSlotCount = (unsigned int)Window::Input::MouseButton::Last + 1;
+
+    /// @brief How many slots the table has.
+    static constexpr unsigned int SlotCount = KeySlotCount + MouseButtonSlotCount;
+
+    /// @brief Value returned by _SlotOf for controls which have no slot.
+    static constexpr unsigned int NoSlot = SlotCount;
+
+    /// @brief Offsets at which the actions bound to each slot start in the
+    /// action array. The actions of a slot end where those of the next slot
+    /// start, hence the extra offset at the end.
+    std::vector<unsigned int> _offsets;
+
+    /// @brief Actions bound to all slots, sorted by slot.
+    std::vector<T> _actions;
+
+    /// @brief Get the slot of the table corresponding to a control.
+    ///
+    /// @param control Structure of litterals describing the control whose
+    /// slot to get.
+    ///
+    /// @return The slot of the control, or NoSlot if the control is not
+    /// tabulated.
+    static unsigned int _SlotOf(const Control& control);
+
+public:
+    /// @param bindings Array of controls paired with the action they are
+    /// bound to. Controls which are neither keys nor mouse buttons are
+    /// ignored.
+    ControlBindingTable(const std::vector<std::pair<Control, T>>& bindings = {});
+
+    /// @brief Get the actions bound to a control.
+    ///
+    /// @param control Structure of litterals describing the control whose
+    /// bound actions to get.
+    ///
+    /// @return A view over the actions bound to the control, in the order
+    /// they were provided at construction. Valid as long as the table is.
+    std::span<const T> getActions(const Control& control) const;
+
+    /// @brief Get how many bindings the table holds.
+    ///
+    /// @return How many bindings the table holds.
+    std::size_t size() const;
+};
+
+template<typename T>
+ControlBindingTable<T>::ControlBindingTable(const std::vector<std::pair<Control, T>>& bindings) :
+    _offsets(SlotCount + 1, 0),
+    _actions()
+{
+    // Count the actions of each slot, then turn counts into offsets
+    for (const auto& [control, action] : bindings)
+    {
+        const unsigned int slot = _SlotOf(control);
+        if (slot != NoSlot) _offsets[slot + 1]++;
+    }
+
+    for (unsigned int i = 0; i < SlotCount; i++)
+    {
+        _offsets[i + 1] += _offsets[i];
+    }
+
+    // Place actions at the next free position of their slot
+    std::vector<unsigned int> positions(_offsets.begin(), _offsets.end() - 1);
+    _actions.resize(_offsets[SlotCount]);
+    for (const auto& [control, action] : bindings)
+    {
+        const unsigned int slot = _SlotOf(control);
+        if (slot != NoSlot) _actions[positions[slot]++] = action;
+    }
+}
+
+template<typename T>
+std::span<const T> ControlBindingTable<T>::getActions(const Control& control) const
+{
+    const unsigned int slot = _SlotOf(control);
+    if (slot == NoSlot) return {};
+
+    return std::span<const T>(_actions.data() + _offsets[slot], _offsets[slot + 1] - _offsets[slot]);
+}
+
+template<typename T>
+std::size_t ControlBindingTable<T>::size() const
+{
+    return _actions.size();
+}
+
+template<typename T>
+unsigned int ControlBindingTable<T>::_SlotOf(const Control& control)
+{
+    unsigned int code;
+    switch (control.kind)
+    {
+        case ControlKind::Key:
+            code = (unsigned int)control.key;
+            return (code < KeySlotCount) ? code : NoSlot;
+        case ControlKind::MouseButton:
+            code = (unsigned int)control.mouseButton;
+            return (code < MouseButtonSlotCount) ? KeySlotCount + code : NoSlot;
+        default:
+            return NoSlot;
+    }
+}
+
+template<typename T>
+using ControlBindingTablePtr = std::shared_ptr<const ControlBindingTable<T>>;
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__TOOLBOX__CONTROLS__CONTROL_BINDING_TABLE_HPP
@@ -1,17 +1,13 @@
 #ifndef RENDERBOI__TOOLBOX__CONTROLS__CONTROL_EVENT_TRANSLATOR_HPP
 #define RENDERBOI__TOOLBOX__CONTROLS__CONTROL_EVENT_TRANSLATOR_HPP
 
-#include <algorithm>
-#include <iterator>
-#include <map>
 #include <memory>
-#include <utility>
-#include <vector>
 
 #include <renderboi/window/gl_window.hpp>
 #include <renderboi/window/input_processor.hpp>
 
 #include "control.hpp"
+#include "control_binding_table.hpp"
 #include "../interfaces/control_binding_provider.hpp"
 #include "../interfaces/action_event_receiver.hpp"
 
@@ -33,11 +29,10 @@ private:
     /// by their bound controls.
     ActionEventReceiverPtr<T> _listener;
 
-    /// @brief Structure mapping actions to the control they are bound to.
-    std::multimap<Control, T> _controlBindings;
-
     /// @brief Translate a given control into action(s) and forward those to
-    /// the listener.
+    /// the listener. Actions are looked up in the latest binding table of
+    /// the binding provider, so that rebinding controls takes effect right
+    /// away.
     ///
     /// @param control Structure of litterals describing the control which 
     /// just processed.
@@ -47,15 +42,6 @@ private:
     /// captured.
     void _translateAndNotify(const Control& control, Window::Input::Action action, const GLWindowPtr window) const;
 
-    /// @brief Copies controls from a control binding provider into a multimap.
-    ///
-    /// @param bindingProvider Object to copy the bindings from.
-    /// @param destination Map to copy the bindings into.
-    static void _ImportControlBindingsIntoMap(
-        const ControlBindingProviderPtr<T>& bindingProvider,
-        std::multimap<Control, T>& destination
-    );
-
 public:
     /// @param bindingProvider Object which can tell which controls are 
     /// mapped to which actions.
@@ -112,10 +98,9 @@ ControlEventTranslator<T>::ControlEventTranslator(
     ActionEventReceiverPtr<T> listener
 ) :
     _bindingProvider(bindingProvider),
-    _listener(listener),
-    _controlBindings()
+    _listener(listener)
 {
-    _ImportControlBindingsIntoMap(bindingProvider, _controlBindings);
+
 }
 
 template<typename T>
@@ -148,33 +133,23 @@ void ControlEventTranslator<T>::processMouseButton(
 template<typename T>
 void ControlEventTranslator<T>::_translateAndNotify(const Control& control, Window::Input::Action action, const GLWindowPtr window) const
 {
-    using Iter = typename std::multimap<Control, T>::const_iterator;
-    const std::pair<Iter, Iter> range = _controlBindings.equal_range(control);
-    
+    // Keep the table alive while dispatching, even if it is swapped out
+    const ControlBindingTablePtr<T> table = _bindingProvider->getBindingTable();
+
     if (action == Window::Input::Action::Release)
     {
-        for (Iter it = range.first; it != range.second; it++)
+        for (const T& boundAction : table->getActions(control))
         {
-            _listener->stopAction(window, it->second);
+            _listener->stopAction(window, boundAction);
         }
     }
     else // (action == Window::Input::Action::Press)
     {
-        for (Iter it = range.first; it != range.second; it++)
+        for (const T& boundAction : table->getActions(control))
         {
-            _listener->triggerAction(window, it->second);
+            _listener->triggerAction(window, boundAction);
         }
-    }    
-}
-
-template<typename T>
-void ControlEventTranslator<T>::_ImportControlBindingsIntoMap(
-    const ControlBindingProviderPtr<T>& bindingProvider,
-    std::multimap<Control, T>& destination
-)
-{
-    const std::vector<std::pair<Control, T>> bindings = bindingProvider->getAllBoundControls();
-    std::copy(bindings.begin(), bindings.end(), std::inserter(destination, destination.begin()));
+    }
 }
 
 template<typename T>
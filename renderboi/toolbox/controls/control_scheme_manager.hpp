@@ -2,6 +2,7 @@
 #define RENDERBOI__TOOLBOX__CONTROLS__CONTROL_SCHEME_MANAGER_HPP
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <iterator>
 #include <map>
@@ -16,6 +17,7 @@
 #include <cpptools/utility/map_tools.hpp>
 
 #include "control.hpp"
+#include "control_binding_table.hpp"
 #include "../interfaces/control_binding_provider.hpp"
 
 namespace Renderboi
@@ -42,6 +44,14 @@ protected:
     /// control can only be bound to one action in the same scheme).
     std::unordered_map<Control, T, ControlHash> _actionBoundToControl;
 
+    /// @brief Table of all bound controls, compiled from the structures
+    /// above whenever bindings change, and swapped atomically so that
+    /// threads dispatching control events never wait on rebinding.
+    std::atomic<ControlBindingTablePtr<T>> _bindingTable;
+
+    /// @brief Compile the bound controls into a new table, and publish it.
+    void _rebuildBindingTable();
+
 public:
     /// @brief The default maximum number of controls bound to a single
     /// action in the ControlSchemeManager.
@@ -129,13 +139,21 @@ public:
     ///
     /// @return The array of all controls bound to an action.
     std::vector<std::pair<Control, T>> getAllBoundControls() override;
+
+    /// @brief Returns the table of all bound controls, as compiled after
+    /// the last change in bindings. May be called from any thread, while
+    /// bindings are being changed.
+    ///
+    /// @return A pointer to the table of all bound controls.
+    ControlBindingTablePtr<T> getBindingTable() override;
 };
 
 template<typename T>
 ControlSchemeManager<T>::ControlSchemeManager(unsigned int maxControlsPerAction) :
     _MaxControlsPerAction(maxControlsPerAction),
     _controlsBoundToAction(),
-    _actionBoundToControl()
+    _actionBoundToControl(),
+    _bindingTable(std::make_shared<const ControlBindingTable<T>>())
 {
     
 }
@@ -161,8 +179,12 @@ void ControlSchemeManager<T>::bindControl(const Control control, const T action)
 
     if (!alreadyPresent)
     {
+        // A control may only be bound to one action
+        unbindControl(control);
+
         _actionBoundToControl.insert({control, action});
         _controlsBoundToAction.insert({action, control});
+        _rebuildBindingTable();
     }
 }
 
@@ -172,20 +194,22 @@ void ControlSchemeManager<T>::unbindControl(const Control& control)
     auto it = _actionBoundToControl.find(control);
 
     if (it == _actionBoundToControl.end()) return;
-    const T& action = it->second;
+    const T action = it->second;
 
-    _actionBoundToControl.erase(control);
+    _actionBoundToControl.erase(it);
 
-    using Iter = typename std::unordered_multimap<Control, T>::iterator;
+    using Iter = typename std::multimap<T, Control>::iterator;
     std::pair<Iter, Iter> range = _controlsBoundToAction.equal_range(action);
-    for (Iter it = range.first; it != range.second; it++)
+    for (Iter jt = range.first; jt != range.second; jt++)
     {
-        if (it->second == control)
+        if (jt->second == control)
         {
-            _controlsBoundToAction.erase(it);
-            return;
+            _controlsBoundToAction.erase(jt);
+            break;
         }
     }
+
+    _rebuildBindingTable();
 }
 
 template<typename T>
@@ -193,14 +217,17 @@ unsigned int ControlSchemeManager<T>::unbindAllControlsFromAction(const T& actio
 {
     if (_controlsBoundToAction.count(action) == 0) return 0;
 
-    using Iter = typename std::unordered_multimap<T, Control>::iterator;
+    using Iter = typename std::multimap<T, Control>::iterator;
     std::pair<Iter, Iter> range = _controlsBoundToAction.equal_range(action);
     for (Iter it = range.first; it != range.second; it++)
     {
         _actionBoundToControl.erase(it->second);
     }
 
-    return (unsigned int) _controlsBoundToAction.erase(action);
+    const unsigned int count = (unsigned int) _controlsBoundToAction.erase(action);
+    _rebuildBindingTable();
+
+    return count;
 }
 
 template<typename T>
@@ -255,6 +282,21 @@ std::vector<std::pair<Control, T>> ControlSchemeManager<T>::getAllBoundControls(
     return boundControls;
 }
 
+template<typename T>
+ControlBindingTablePtr<T> ControlSchemeManager<T>::getBindingTable()
+{
+    return _bindingTable.load(std::memory_order_acquire);
+}
+
+template<typename T>
+void ControlSchemeManager<T>::_rebuildBindingTable()
+{
+    _bindingTable.store(
+        std::make_shared<const ControlBindingTable<T>>(getAllBoundControls()),
+        std::memory_order_release
+    );
+}
+
 template<typename T>
 using ControlSchemeManagerPtr = std::shared_ptr<ControlSchemeManager<T>>;
 
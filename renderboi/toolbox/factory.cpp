@@ -2,6 +2,8 @@
 
 #include <memory>
 
+#include <glad/gl.h>
+
 #include "scene/scene.hpp"
 #include "scene/scene_object.hpp"
 
@@ -27,4 +29,10 @@ SceneObjectPtr Factory::MakeSceneObject(std::string name)
     return sceneObject;
 }
 
+bool Factory::_IsTriangleMesh(const MeshPtr mesh)
+{
+    const unsigned int drawMode = mesh->getDrawMode();
+    return drawMode == GL_TRIANGLES || drawMode == GL_TRIANGLE_STRIP || drawMode == GL_TRIANGLE_FAN;
+}
+
 }//namespace Renderboi
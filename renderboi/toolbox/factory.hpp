@@ -1,7 +1,11 @@
 #ifndef RENDERBOI__TOOLBOX__FACTORY_HPP
 #define RENDERBOI__TOOLBOX__FACTORY_HPP
 
-#include <renderboi/core/materials.hpp>
+#include <cmath>
+#include <vector>
+
+#include <renderboi/core/dynamic_mesh.hpp>
+#include <renderboi/core/material_registry.hpp>
 #include <renderboi/core/mesh.hpp>
 #include <renderboi/core/shader/shader_builder.hpp>
 
@@ -9,6 +13,9 @@
 #include "interfaces/mesh_generator.hpp"
 #include "mesh_generators/mesh_type.hpp"
 #include "mesh_generators/type_to_gen_mapping.hpp"
+#include "mesh_tools/mesh_optimizer.hpp"
+#include "mesh_tools/mesh_simplifier.hpp"
+#include "mesh_tools/triangle_list.hpp"
 #include "scene/scene.hpp"
 #include "scene/scene_object.hpp"
 #include "scene/component.hpp"
@@ -21,6 +28,15 @@ namespace Renderboi
 /// @brief Provides static methods to facilitate complex object instantiation.
 class Factory
 {
+    private:
+        /// @brief Tell whether a mesh is made of triangles, and can thus be
+        /// processed by the mesh tools.
+        ///
+        /// @param mesh Pointer to the mesh to inspect.
+        ///
+        /// @return Whether or not the mesh is made of triangles.
+        static bool _IsTriangleMesh(const MeshPtr mesh);
+
     public:
         /// @brief Instantiate and initialize a new scene.
         ///
@@ -46,10 +62,53 @@ class Factory
         ///
         /// @param parameters Parameters to pass to the mesh generator.
         /// Look up generators in core/mesh_generators/ for details.
+        /// @param optimize Whether to run the generated mesh through the 
+        /// vertex cache and vertex fetch optimisation stage, which turns it
+        /// into an optimized triangle list. Only meshes made of triangles
+        /// are affected.
         ///
         /// @return Pointer to the generated mesh.
         template<MeshType T>
-        static MeshPtr MakeMesh(typename TypeToGenMapping<T>::GenType::Parameters parameters);
+        static MeshPtr MakeMesh(typename TypeToGenMapping<T>::GenType::Parameters parameters, bool optimize = false);
+
+        /// @brief Create a dynamic mesh whose vertices are initially arranged
+        /// in a certain shape, and can later be updated.
+        ///
+        /// @tparam T Literal describing which mesh generator to use.
+        ///
+        /// @param parameters Parameters to pass to the mesh generator.
+        /// @param bufferCount Amount of buffer regions the mesh should cycle
+        /// through upon updating vertices.
+        ///
+        /// @return Pointer to the generated dynamic mesh.
+        template<MeshType T>
+        static DynamicMeshPtr MakeDynamicMesh(
+            typename TypeToGenMapping<T>::GenType::Parameters parameters,
+            unsigned int bufferCount = DynamicMesh::DefaultBufferCount
+        );
+
+        /// @brief Create a mesh with vertices arranged in a certain shape, 
+        /// along with coarser levels of detail of it. Levels are generated at
+        /// decreasing resolutions by the mesh generator when it supports it,
+        /// and are otherwise obtained by simplifying the full resolution mesh.
+        ///
+        /// @tparam T Literal describing which mesh generator to use.
+        ///
+        /// @param parameters Parameters to pass to the mesh generator.
+        /// @param levelCount Maximum amount of levels to generate, the full 
+        /// resolution mesh included. Fewer levels may be returned if the mesh
+        /// cannot be made any coarser.
+        /// @param optimize Whether to run every level through the vertex 
+        /// cache and vertex fetch optimisation stage.
+        ///
+        /// @return An array filled with the generated levels, ordered from
+        /// finest to coarsest.
+        template<MeshType T>
+        static std::vector<MeshComponent::LodLevel> MakeMeshLodChain(
+            typename TypeToGenMapping<T>::GenType::Parameters parameters,
+            unsigned int levelCount,
+            bool optimize = false
+        );
 
         /// @brief Instantiate and initiliaze a scene object, generate a mesh,
         /// and attach it to the scene object within a mesh component.
@@ -57,14 +116,14 @@ class Factory
         /// @tparam T Literal describing which mesh generator to use.
         ///
         /// @param parameters Parameters of the mesh generation.
-        /// @param mat Material to render the mesh in.
+        /// @param mat Handle to the registered material to render the mesh in.
         /// @param shader Shader program to render the mesh with.
         ///
         /// @return Pointer to the instantiated scene object.
         template<MeshType T>
         static SceneObjectPtr MakeSceneObjectWithMesh(
             typename TypeToGenMapping<T>::GenType::Parameters parameters,
-            Material mat = Material(),
+            MaterialHandle mat = MaterialRegistry::GetDefault(),
             ShaderProgram shader = ShaderBuilder::MinimalShaderProgram()
         );
 
@@ -75,7 +134,7 @@ class Factory
         ///
         /// @param name Name to give to the scene object.
         /// @param parameters Parameters of the mesh generation.
-        /// @param mat Material to render the mesh in.
+        /// @param mat Handle to the registered material to render the mesh in.
         /// @param shader Shader program to render the mesh with.
         ///
         /// @return Pointer to the instantiated scene object.
@@ -83,7 +142,31 @@ class Factory
         static SceneObjectPtr MakeSceneObjectWithMesh(
             std::string name,
             typename TypeToGenMapping<T>::GenType::Parameters parameters,
-            Material mat = Materials::Default,
+            MaterialHandle mat = MaterialRegistry::GetDefault(),
+            ShaderProgram shader = ShaderBuilder::MinimalShaderProgram()
+        );
+
+        /// @brief Instantiate and initiliaze a scene object, generate a mesh
+        /// along with coarser levels of detail of it, and attach them to the
+        /// scene object within a mesh component. All levels are optimized for
+        /// vertex processing.
+        ///
+        /// @tparam T Literal describing which mesh generator to use.
+        ///
+        /// @param name Name to give to the scene object.
+        /// @param parameters Parameters of the mesh generation.
+        /// @param levelCount Maximum amount of levels of detail to generate,
+        /// the full resolution mesh included.
+        /// @param mat Handle to the registered material to render the mesh in.
+        /// @param shader Shader program to render the mesh with.
+        ///
+        /// @return Pointer to the instantiated scene object.
+        template<MeshType T>
+        static SceneObjectPtr MakeSceneObjectWithLodMesh(
+            std::string name,
+            typename TypeToGenMapping<T>::GenType::Parameters parameters,
+            unsigned int levelCount,
+            MaterialHandle mat = MaterialRegistry::GetDefault(),
             ShaderProgram shader = ShaderBuilder::MinimalShaderProgram()
         );
 
@@ -107,17 +190,82 @@ class Factory
 };
 
 template<MeshType T>
-MeshPtr Factory::MakeMesh(typename TypeToGenMapping<T>::GenType::Parameters parameters)
+MeshPtr Factory::MakeMesh(typename TypeToGenMapping<T>::GenType::Parameters parameters, bool optimize)
 {
     using GenType = typename TypeToGenMapping<T>::GenType;
     std::shared_ptr<GenType> gen = std::make_shared<GenType>(parameters);
-    return gen->generateMesh();
+    MeshPtr mesh = gen->generateMesh();
+
+    return (optimize && _IsTriangleMesh(mesh)) ? optimizeMesh(*mesh) : mesh;
+}
+
+template<MeshType T>
+DynamicMeshPtr Factory::MakeDynamicMesh(
+    typename TypeToGenMapping<T>::GenType::Parameters parameters,
+    unsigned int bufferCount
+)
+{
+    using GenType = typename TypeToGenMapping<T>::GenType;
+    std::shared_ptr<GenType> gen = std::make_shared<GenType>(parameters);
+    MeshPtr mesh = gen->generateMesh();
+
+    return std::make_shared<DynamicMesh>(
+        mesh->getDrawMode(),
+        mesh->getVertices(),
+        mesh->getIndices(),
+        mesh->getPrimitiveSizes(),
+        mesh->getPrimitiveOffsets(),
+        bufferCount
+    );
+}
+
+template<MeshType T>
+std::vector<MeshComponent::LodLevel> Factory::MakeMeshLodChain(
+    typename TypeToGenMapping<T>::GenType::Parameters parameters,
+    unsigned int levelCount,
+    bool optimize
+)
+{
+    using GenType = typename TypeToGenMapping<T>::GenType;
+    std::shared_ptr<GenType> gen = std::make_shared<GenType>(parameters);
+
+    // The full resolution mesh is always generated
+    std::vector<MeshComponent::LodLevel> levels;
+    for (unsigned int level = 0; level < levelCount || level == 0; level++)
+    {
+        float error = 0.f;
+        MeshPtr mesh = gen->generateLodMesh(level, error);
+
+        if (!mesh && level > 0 && _IsTriangleMesh(levels[0].mesh))
+        {
+            // Generator cannot go coarser on its own, fall back to simplifying
+            // the full resolution mesh to a quarter of the triangles per level
+            const float ratio = 1.f / std::pow(4.f, (float)level);
+            mesh = simplifyMesh(*levels[0].mesh, ratio, error);
+
+            // Simplification stalled, coarser levels would only be duplicates
+            if (mesh->getIndices().size() >= triangleListFromMesh(*levels.back().mesh).size()) break;
+        }
+
+        if (!mesh) break;
+        levels.push_back({mesh, error});
+    }
+
+    if (optimize && _IsTriangleMesh(levels[0].mesh))
+    {
+        for (auto& level : levels)
+        {
+            level.mesh = optimizeMesh(*level.mesh);
+        }
+    }
+
+    return levels;
 }
 
 template<MeshType T>
 SceneObjectPtr Factory::MakeSceneObjectWithMesh(
     typename TypeToGenMapping<T>::GenType::Parameters parameters,
-    Material mat,
+    MaterialHandle mat,
     ShaderProgram shader
 )
 {
@@ -128,7 +276,7 @@ template<MeshType T>
 SceneObjectPtr Factory::MakeSceneObjectWithMesh(
     std::string name,
     typename TypeToGenMapping<T>::GenType::Parameters parameters,
-    Material mat,
+    MaterialHandle mat,
     ShaderProgram shader
 )
 {
@@ -138,6 +286,28 @@ SceneObjectPtr Factory::MakeSceneObjectWithMesh(
     return obj;
 }
 
+template<MeshType T>
+SceneObjectPtr Factory::MakeSceneObjectWithLodMesh(
+    std::string name,
+    typename TypeToGenMapping<T>::GenType::Parameters parameters,
+    unsigned int levelCount,
+    MaterialHandle mat,
+    ShaderProgram shader
+)
+{
+    std::vector<MeshComponent::LodLevel> levels = Factory::MakeMeshLodChain<T>(parameters, levelCount, true);
+    SceneObjectPtr obj = Factory::MakeSceneObject(name);
+    obj->addComponent<MeshComponent>(levels[0].mesh, mat, shader);
+
+    std::shared_ptr<MeshComponent> meshComponent = obj->getComponent<MeshComponent>();
+    for (auto it = levels.cbegin() + 1; it != levels.cend(); it++)
+    {
+        meshComponent->addLodLevel(it->mesh, it->error);
+    }
+
+    return obj;
+}
+
 template<typename T, typename... ArgTypes>
 std::shared_ptr<T> Factory::CreateScriptAndAttachToObject(SceneObjectPtr object, ArgTypes&&... args)
 {
@@ -0,0 +1,81 @@
+#include "frame_pipeline.hpp"
+
+namespace Renderboi
+{
+
+FramePipeline::FramePipeline() :
+    _snapshots(),
+    _writeIndex(0),
+    _published(false),
+    _reading(false),
+    _closed(false),
+    _mutex(),
+    _stateChanged()
+{
+
+}
+
+FrameSnapshot& FramePipeline::getWriteSnapshot()
+{
+    // Only the simulation thread ever changes the write index
+    return _snapshots[_writeIndex];
+}
+
+bool FramePipeline::publish()
+{
+    std::unique_lock lock(_mutex);
+
+    // The other snapshot must have been rendered before it can be reused
+    _stateChanged.wait(lock, [this]()
+    {
+        return _closed || (!_published && !_reading);
+    });
+    if (_closed) return false;
+
+    _writeIndex = 1 - _writeIndex;
+    _published = true;
+
+    lock.unlock();
+    _stateChanged.notify_all();
+    return true;
+}
+
+const FrameSnapshot* FramePipeline::acquire()
+{
+    std::unique_lock lock(_mutex);
+    _stateChanged.wait(lock, [this]()
+    {
+        return _closed || _published;
+    });
+    if (!_published) return nullptr;
+
+    _published = false;
+    _reading = true;
+    return &_snapshots[1 - _writeIndex];
+}
+
+void FramePipeline::release()
+{
+    {
+        std::unique_lock lock(_mutex);
+        _reading = false;
+    }
+    _stateChanged.notify_all();
+}
+
+void FramePipeline::close()
+{
+    {
+        std::unique_lock lock(_mutex);
+        _closed = true;
+    }
+    _stateChanged.notify_all();
+}
+
+bool FramePipeline::closed()
+{
+    std::unique_lock lock(_mutex);
+    return _closed;
+}
+
+}//namespace Renderboi
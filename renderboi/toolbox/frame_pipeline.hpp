@@ -0,0 +1,114 @@
+#ifndef RENDERBOI__TOOLBOX__FRAME_PIPELINE_HPP
+#define RENDERBOI__TOOLBOX__FRAME_PIPELINE_HPP
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+#include "scene/frame_snapshot.hpp"
+
+namespace Renderboi
+{
+
+/// @brief Double buffer of frame snapshots, allowing a simulation thread to
+/// update frame N+1 of a scene while a render thread renders frame N. Both
+/// threads meet once per frame, when the simulation thread publishes a new
+/// snapshot and the render thread is done with the previous one, so that a
+/// frame takes about as long as the slowest of both threads rather than
+/// both of them combined. Meant to be used as follows:
+///
+/// @code
+/// // Simulation thread
+/// while (running)
+/// {
+///     scheduler.waitForNextFrame();
+///     while (scheduler.stepSimulation())
+///     {
+///         scene->triggerUpdate(scheduler.getFixedTimestep());
+///     }
+///     renderer.captureSnapshot(scene, pipeline.getWriteSnapshot(), scheduler.getInterpolationFactor());
+///     pipeline.publish();
+/// }
+/// pipeline.close();
+///
+/// // Render thread
+/// while (const FrameSnapshot* snapshot = pipeline.acquire())
+/// {
+///     renderer.renderSnapshot(*snapshot);
+///     pipeline.release();
+///     window->swapBuffers();
+/// }
+/// @endcode
+class FramePipeline
+{
+private:
+    FramePipeline(const FramePipeline& other) = delete;
+    FramePipeline& operator=(const FramePipeline& other) = delete;
+
+    /// @brief The two snapshots, one being written to by the simulation
+    /// thread, the other one being read from by the render thread.
+    FrameSnapshot _snapshots[2];
+
+    /// @brief Index of the snapshot being written to.
+    unsigned int _writeIndex;
+
+    /// @brief Whether the snapshot to read from was published and not
+    /// acquired yet.
+    bool _published;
+
+    /// @brief Whether the render thread is reading from its snapshot.
+    bool _reading;
+
+    /// @brief Whether the pipeline was closed.
+    bool _closed;
+
+    /// @brief Mutex protecting the state of the pipeline.
+    std::mutex _mutex;
+
+    /// @brief Condition signaled whenever the state of the pipeline changes.
+    std::condition_variable _stateChanged;
+
+public:
+    FramePipeline();
+
+    /// @brief Get the snapshot to capture the next frame into. Must only be
+    /// called from the simulation thread.
+    ///
+    /// @return A reference to the snapshot to write to.
+    FrameSnapshot& getWriteSnapshot();
+
+    /// @brief Hand the snapshot which was written to over to the render
+    /// thread, waiting for it to be done with the previous snapshot first.
+    /// Must only be called from the simulation thread.
+    ///
+    /// @return Whether the snapshot was published, false meaning the
+    /// pipeline was closed.
+    bool publish();
+
+    /// @brief Wait for a snapshot to be published, and get it for reading.
+    /// Must only be called from the render thread, and be followed by a
+    /// call to release() once the snapshot is no longer needed.
+    ///
+    /// @return A pointer to the published snapshot, or nullptr if the
+    /// pipeline was closed and no snapshot is left to render.
+    const FrameSnapshot* acquire();
+
+    /// @brief Let the simulation thread know that the acquired snapshot is
+    /// no longer needed. Must only be called from the render thread.
+    void release();
+
+    /// @brief Close the pipeline, waking up both threads. Snapshots
+    /// published from then on are discarded.
+    void close();
+
+    /// @brief Tell whether the pipeline was closed.
+    ///
+    /// @return Whether the pipeline was closed.
+    bool closed();
+};
+
+using FramePipelinePtr = std::shared_ptr<FramePipeline>;
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__TOOLBOX__FRAME_PIPELINE_HPP
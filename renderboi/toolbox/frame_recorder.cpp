@@ -0,0 +1,462 @@
+#include "frame_recorder.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+
+/// @brief Table of the CRCs of all byte values, as used in PNG chunks.
+const std::array<uint32_t, 256> CrcTable = []()
+{
+    std::array<uint32_t, 256> table;
+    for (uint32_t n = 0; n < 256; n++)
+    {
+        uint32_t c = n;
+        for (int k = 0; k < 8; k++)
+        {
+            c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+        }
+        table[n] = c;
+    }
+    return table;
+}();
+
+void appendBigEndian(std::vector<unsigned char>& dest, const uint32_t value)
+{
+    dest.push_back((value >> 24) & 0xFF);
+    dest.push_back((value >> 16) & 0xFF);
+    dest.push_back((value >> 8) & 0xFF);
+    dest.push_back(value & 0xFF);
+}
+
+void writePngChunk(std::ofstream& stream, const char* type, const std::vector<unsigned char>& data)
+{
+    std::vector<unsigned char> chunk;
+    chunk.reserve(data.size() + 12);
+    appendBigEndian(chunk, (uint32_t)data.size());
+    chunk.insert(chunk.end(), type, type + 4);
+    chunk.insert(chunk.end(), data.begin(), data.end());
+
+    // The CRC covers the type and the data
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 4; i < chunk.size(); i++)
+    {
+        crc = CrcTable[(crc ^ chunk[i]) & 0xFF] ^ (crc >> 8);
+    }
+    appendBigEndian(chunk, crc ^ 0xFFFFFFFFu);
+
+    stream.write((const char*)chunk.data(), chunk.size());
+}
+
+/// @brief Write RGBA pixels to a PNG file, dropping the alpha channel.
+/// Image data is stored in uncompressed deflate blocks, which keeps encoding
+/// cheap enough for the writer to keep up with rendering, at the cost of
+/// larger files.
+void writePng(const std::filesystem::path& path, const int width, const int height, const std::vector<unsigned char>& rgba)
+{
+    std::ofstream stream(path, std::ios::binary);
+    if (!stream)
+    {
+        throw std::runtime_error("FrameRecorder: could not open \"" + path.string() + "\" for writing.");
+    }
+
+    static const unsigned char Signature[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    stream.write((const char*)Signature, sizeof(Signature));
+
+    std::vector<unsigned char> header;
+    appendBigEndian(header, width);
+    appendBigEndian(header, height);
+    header.insert(header.end(), {
+        8,  // bit depth
+        2,  // color type: RGB
+        0,  // compression method
+        0,  // filter method
+        0   // interlace method
+    });
+    writePngChunk(stream, "IHDR", header);
+
+    // Filtered image data: a filter type byte (none) then RGB pixels, for
+    // each row from the top down
+    const size_t rowSize = 1 + 3 * (size_t)width;
+    std::vector<unsigned char> raw(rowSize * height);
+    for (int y = 0; y < height; y++)
+    {
+        unsigned char* row = raw.data() + y * rowSize;
+        const unsigned char* source = rgba.data() + (size_t)(height - 1 - y) * 4 * width;
+        row[0] = 0;
+        for (int x = 0; x < width; x++)
+        {
+            row[1 + 3 * x]     = source[4 * x];
+            row[1 + 3 * x + 1] = source[4 * x + 1];
+            row[1 + 3 * x + 2] = source[4 * x + 2];
+        }
+    }
+
+    // zlib stream made of stored deflate blocks
+    static constexpr size_t MaxBlockSize = 65535;
+    std::vector<unsigned char> data = {0x78, 0x01};
+    data.reserve(raw.size() + 5 * (raw.size() / MaxBlockSize + 1) + 6);
+
+    uint32_t adlerA = 1, adlerB = 0;
+    for (size_t offset = 0; offset < raw.size(); offset += MaxBlockSize)
+    {
+        const size_t blockSize = std::min(MaxBlockSize, raw.size() - offset);
+        const bool last = offset + blockSize == raw.size();
+        data.push_back(last ? 1 : 0);
+        data.push_back(blockSize & 0xFF);
+        data.push_back((blockSize >> 8) & 0xFF);
+        data.push_back(~blockSize & 0xFF);
+        data.push_back((~blockSize >> 8) & 0xFF);
+        data.insert(data.end(), raw.begin() + offset, raw.begin() + offset + blockSize);
+
+        for (size_t i = offset; i < offset + blockSize; i++)
+        {
+            adlerA = (adlerA + raw[i]) % 65521;
+            adlerB = (adlerB + adlerA) % 65521;
+        }
+    }
+    appendBigEndian(data, (adlerB << 16) | adlerA);
+    writePngChunk(stream, "IDAT", data);
+
+    writePngChunk(stream, "IEND", {});
+
+    if (!stream)
+    {
+        throw std::runtime_error("FrameRecorder: failed to write \"" + path.string() + "\".");
+    }
+}
+
+/// @brief Write RGBA pixels as a 4:4:4 Y4M frame, converting them to BT.601
+/// limited range YCbCr.
+void writeY4mFrame(std::ofstream& stream, const int width, const int height, const std::vector<unsigned char>& rgba)
+{
+    const size_t planeSize = (size_t)width * height;
+    std::vector<unsigned char> planes(3 * planeSize);
+    unsigned char* yPlane = planes.data();
+    unsigned char* uPlane = yPlane + planeSize;
+    unsigned char* vPlane = uPlane + planeSize;
+
+    for (int y = 0; y < height; y++)
+    {
+        const unsigned char* source = rgba.data() + (size_t)(height - 1 - y) * 4 * width;
+        for (int x = 0; x < width; x++)
+        {
+            const int r = source[4 * x];
+            const int g = source[4 * x + 1];
+            const int b = source[4 * x + 2];
+
+            const size_t i = (size_t)y * width + x;
+            yPlane[i] = (unsigned char)((( 66 * r + 129 * g +  25 * b + 128) >> 8) + 16);
+            uPlane[i] = (unsigned char)(((-38 * r -  74 * g + 112 * b + 128) >> 8) + 128);
+            vPlane[i] = (unsigned char)(((112 * r -  94 * g -  18 * b + 128) >> 8) + 128);
+        }
+    }
+
+    stream << "FRAME\n";
+    stream.write((const char*)planes.data(), planes.size());
+
+    if (!stream)
+    {
+        throw std::runtime_error("FrameRecorder: failed to write video frame.");
+    }
+}
+
+}//namespace
+
+namespace Renderboi
+{
+
+FrameRecorder::FrameRecorder(
+    const std::filesystem::path& outputPath,
+    const OutputFormat format,
+    const int width,
+    const int height,
+    const unsigned int frameRate,
+    const unsigned int ringSize
+) :
+    _outputPath(outputPath),
+    _format(format),
+    _width(width),
+    _height(height),
+    _frameSize(4 * (size_t)width * height),
+    _framebuffer(0),
+    _colorBuffer(0),
+    _depthStencilBuffer(0),
+    _previousFramebuffer(0),
+    _slots(ringSize),
+    _nextSlot(0),
+    _capturedFrames(0),
+    _finished(false),
+    _videoStream(),
+    _queue(),
+    _freePixelBuffers(),
+    _running(true),
+    _exception(),
+    _mutex(),
+    _frameQueued(),
+    _frameWritten(),
+    _thread()
+{
+    if (ringSize == 0)
+    {
+        throw std::runtime_error("FrameRecorder: cannot read frames back into a ring of 0 buffers.");
+    }
+
+    if (_format == OutputFormat::PngSequence)
+    {
+        std::filesystem::create_directories(_outputPath);
+    }
+    else // if (_format == OutputFormat::Y4M)
+    {
+        if (_outputPath.has_parent_path())
+        {
+            std::filesystem::create_directories(_outputPath.parent_path());
+        }
+
+        _videoStream.open(_outputPath, std::ios::binary);
+        if (!_videoStream)
+        {
+            throw std::runtime_error("FrameRecorder: could not open \"" + _outputPath.string() + "\" for writing.");
+        }
+        _videoStream << "YUV4MPEG2 W" << _width << " H" << _height << " F" << frameRate << ":1 Ip A1:1 C444\n";
+    }
+
+    for (Slot& slot : _slots)
+    {
+        glGenBuffers(1, &slot.buffer);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+        glBufferData(GL_PIXEL_PACK_BUFFER, _frameSize, nullptr, GL_STREAM_READ);
+        slot.fence = nullptr;
+        slot.frameIndex = 0;
+        slot.pending = false;
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    // Render into a framebuffer of our own, whose contents are well defined
+    // whether or not the window is visible
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &_previousFramebuffer);
+
+    glGenRenderbuffers(1, &_colorBuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, _colorBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, _width, _height);
+    glGenRenderbuffers(1, &_depthStencilBuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, _depthStencilBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, _width, _height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glGenFramebuffers(1, &_framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, _framebuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, _colorBuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, _depthStencilBuffer);
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    {
+        _releaseGLResources();
+        throw std::runtime_error("FrameRecorder: offscreen framebuffer is incomplete.");
+    }
+
+    glViewport(0, 0, _width, _height);
+
+    _thread = std::thread(&FrameRecorder::_writeLoop, this);
+}
+
+FrameRecorder::~FrameRecorder()
+{
+    try
+    {
+        finish();
+    }
+    catch (...)
+    {
+        // Write errors can only be reported through finish()
+    }
+}
+
+void FrameRecorder::capture()
+{
+    if (_finished)
+    {
+        throw std::runtime_error("FrameRecorder: cannot capture frames once the recording was finished.");
+    }
+
+    {
+        std::unique_lock lock(_mutex);
+        if (_exception)
+        {
+            throw std::runtime_error("FrameRecorder: cannot capture frames after a write error.");
+        }
+    }
+
+    // The oldest readback has had the most time to complete
+    Slot& slot = _slots[_nextSlot];
+    if (slot.pending) _retrieve(slot);
+
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, _framebuffer);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+    glReadPixels(0, 0, _width, _height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    slot.frameIndex = _capturedFrames++;
+    slot.pending = true;
+
+    _nextSlot = (_nextSlot + 1) % _slots.size();
+}
+
+void FrameRecorder::finish()
+{
+    if (_finished) return;
+    _finished = true;
+
+    // Retrieve the frames in flight, oldest first
+    for (size_t i = 0; i < _slots.size(); i++)
+    {
+        Slot& slot = _slots[(_nextSlot + i) % _slots.size()];
+        if (slot.pending) _retrieve(slot);
+    }
+
+    {
+        std::unique_lock lock(_mutex);
+        _running = false;
+    }
+    _frameQueued.notify_all();
+    _thread.join();
+
+    _releaseGLResources();
+    _videoStream.close();
+
+    if (_exception)
+    {
+        std::rethrow_exception(_exception);
+    }
+}
+
+void FrameRecorder::_releaseGLResources()
+{
+    for (Slot& slot : _slots)
+    {
+        glDeleteBuffers(1, &slot.buffer);
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, (GLuint)_previousFramebuffer);
+    glDeleteFramebuffers(1, &_framebuffer);
+    glDeleteRenderbuffers(1, &_colorBuffer);
+    glDeleteRenderbuffers(1, &_depthStencilBuffer);
+}
+
+unsigned int FrameRecorder::getCapturedFrameCount() const
+{
+    return _capturedFrames;
+}
+
+void FrameRecorder::_retrieve(Slot& slot)
+{
+    // Wait for the fence a second at a time
+    static constexpr GLuint64 Timeout = 1000000000;
+    while (glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, Timeout) == GL_TIMEOUT_EXPIRED);
+    glDeleteSync(slot.fence);
+    slot.fence = nullptr;
+    slot.pending = false;
+
+    Frame frame;
+    frame.index = slot.frameIndex;
+    {
+        std::unique_lock lock(_mutex);
+        if (!_freePixelBuffers.empty())
+        {
+            frame.pixels = std::move(_freePixelBuffers.back());
+            _freePixelBuffers.pop_back();
+        }
+    }
+    frame.pixels.resize(_frameSize);
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+    const void* mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, _frameSize, GL_MAP_READ_BIT);
+    if (mapped)
+    {
+        std::memcpy(frame.pixels.data(), mapped, _frameSize);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    {
+        std::unique_lock lock(_mutex);
+        _frameWritten.wait(lock, [this]()
+        {
+            return _queue.size() < MaxQueuedFrames;
+        });
+        _queue.push_back(std::move(frame));
+    }
+    _frameQueued.notify_one();
+}
+
+void FrameRecorder::_writeLoop()
+{
+    while (true)
+    {
+        Frame frame;
+        {
+            std::unique_lock lock(_mutex);
+            _frameQueued.wait(lock, [this]()
+            {
+                return !_running || !_queue.empty();
+            });
+
+            // Only stop once all queued frames were written
+            if (_queue.empty()) break;
+
+            frame = std::move(_queue.front());
+            _queue.pop_front();
+        }
+
+        bool failed;
+        {
+            std::unique_lock lock(_mutex);
+            failed = (bool)_exception;
+        }
+
+        // Frames coming after a write error are discarded
+        if (!failed)
+        {
+            try
+            {
+                _writeFrame(frame);
+            }
+            catch (...)
+            {
+                std::unique_lock lock(_mutex);
+                _exception = std::current_exception();
+            }
+        }
+
+        {
+            std::unique_lock lock(_mutex);
+            _freePixelBuffers.push_back(std::move(frame.pixels));
+        }
+        _frameWritten.notify_all();
+    }
+}
+
+void FrameRecorder::_writeFrame(const Frame& frame)
+{
+    if (_format == OutputFormat::PngSequence)
+    {
+        std::ostringstream filename;
+        filename << "frame_" << std::setw(6) << std::setfill('0') << frame.index << ".png";
+        writePng(_outputPath / filename.str(), _width, _height, frame.pixels);
+    }
+    else // if (_format == OutputFormat::Y4M)
+    {
+        writeY4mFrame(_videoStream, _width, _height, frame.pixels);
+    }
+}
+
+}//namespace Renderboi
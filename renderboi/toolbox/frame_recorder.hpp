@@ -0,0 +1,239 @@
+#ifndef RENDERBOI__TOOLBOX__FRAME_RECORDER_HPP
+#define RENDERBOI__TOOLBOX__FRAME_RECORDER_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <glad/gl.h>
+
+namespace Renderboi
+{
+
+/// @brief Records rendered frames to disk. Frames are rendered into an
+/// offscreen framebuffer owned by the recorder, as the contents of the 
+/// default framebuffer of a hidden window are undefined on most platforms.
+/// They are read back into a ring of pixel buffer objects, so that the
+/// transfer of a frame overlaps with the rendering of the next ones, and are
+/// only mapped once their fence was signaled, a few frames later. Mapped
+/// frames are then encoded and written by a thread of its own. Meant to be
+/// used as follows:
+///
+/// @code
+/// // Rendering thread, with the context current
+/// FrameRecorder recorder("out.y4m", FrameRecorder::OutputFormat::Y4M, width, height, 60);
+/// for (unsigned int i = 0; i < frameCount; i++)
+/// {
+///     scene->triggerUpdate(1.f / 60.f);
+///     renderer.renderScene(scene);
+///     recorder.capture();
+///     window->swapBuffers();
+/// }
+/// recorder.finish();
+/// @endcode
+class FrameRecorder
+{
+public:
+    /// @brief Collection of litterals describing the formats frames can be
+    /// written in.
+    enum class OutputFormat
+    {
+        /// @brief One PNG file per frame, in an output directory.
+        PngSequence,
+        /// @brief A single YUV4MPEG2 video file (4:4:4, uncompressed).
+        Y4M
+    };
+
+    /// @brief How many pixel buffer objects frames are read back into by
+    /// default, i.e. how many frames a readback may lag behind rendering.
+    static constexpr unsigned int DefaultRingSize = 3;
+
+    /// @brief How many frames may be waiting to be written before capturing
+    /// blocks, so that a slow disk does not exhaust memory.
+    static constexpr unsigned int MaxQueuedFrames = 8;
+
+private:
+    FrameRecorder(const FrameRecorder& other) = delete;
+    FrameRecorder& operator=(const FrameRecorder& other) = delete;
+
+    /// @brief Pixel buffer object of the ring, with the readback in flight
+    /// into it.
+    struct Slot
+    {
+        /// @brief Handle to the pixel buffer object.
+        GLuint buffer;
+
+        /// @brief Fence signaled once the readback into the buffer is
+        /// complete.
+        GLsync fence;
+
+        /// @brief Index of the frame being read back into the buffer.
+        unsigned int frameIndex;
+
+        /// @brief Whether a readback is in flight into the buffer.
+        bool pending;
+    };
+
+    /// @brief Frame waiting to be written.
+    struct Frame
+    {
+        /// @brief Index of the frame in the recording.
+        unsigned int index;
+
+        /// @brief RGBA pixels of the frame, 8 bits per channel, from the
+        /// bottom row to the top row.
+        std::vector<unsigned char> pixels;
+    };
+
+    /// @brief Path to the output directory or file.
+    std::filesystem::path _outputPath;
+
+    /// @brief Format frames are written in.
+    OutputFormat _format;
+
+    /// @brief Width of the frames in pixels.
+    int _width;
+
+    /// @brief Height of the frames in pixels.
+    int _height;
+
+    /// @brief Size in bytes of a frame.
+    size_t _frameSize;
+
+    /// @brief Framebuffer frames are rendered into and read back from.
+    GLuint _framebuffer;
+
+    /// @brief Color attachment of the framebuffer.
+    GLuint _colorBuffer;
+
+    /// @brief Depth and stencil attachment of the framebuffer.
+    GLuint _depthStencilBuffer;
+
+    /// @brief Framebuffer which was bound before the recorder bound its
+    /// own, bound back once the recording is finished.
+    GLint _previousFramebuffer;
+
+    /// @brief Ring of pixel buffer objects.
+    std::vector<Slot> _slots;
+
+    /// @brief Index of the slot the next frame will be read back into.
+    unsigned int _nextSlot;
+
+    /// @brief How many frames were captured.
+    unsigned int _capturedFrames;
+
+    /// @brief Whether the recording was finished.
+    bool _finished;
+
+    /// @brief Video file frames are written to in Y4M format.
+    std::ofstream _videoStream;
+
+    /// @brief Frames waiting to be written.
+    std::deque<Frame> _queue;
+
+    /// @brief Pixel vectors of written frames, kept to be reused.
+    std::vector<std::vector<unsigned char>> _freePixelBuffers;
+
+    /// @brief Whether the writer thread should keep running.
+    bool _running;
+
+    /// @brief Exception thrown by the writer thread, if any.
+    std::exception_ptr _exception;
+
+    /// @brief Mutex protecting the queue, the free pixel buffers, the
+    /// running flag and the exception.
+    std::mutex _mutex;
+
+    /// @brief Condition signaled when frames are queued or when the
+    /// recording is finished.
+    std::condition_variable _frameQueued;
+
+    /// @brief Condition signaled when frames are written.
+    std::condition_variable _frameWritten;
+
+    /// @brief Thread writing the frames.
+    std::thread _thread;
+
+    /// @brief Wait for the readback into a slot to complete, and queue the
+    /// frame it holds for writing.
+    ///
+    /// @param slot Slot whose frame to retrieve.
+    void _retrieve(Slot& slot);
+
+    /// @brief Routine run by the writer thread.
+    void _writeLoop();
+
+    /// @brief Delete the pixel buffer objects and the offscreen framebuffer,
+    /// and bind back the framebuffer which was bound beforehand.
+    void _releaseGLResources();
+
+    /// @brief Encode and write a frame in the output format.
+    ///
+    /// @param frame Frame to write.
+    void _writeFrame(const Frame& frame);
+
+public:
+    /// @param outputPath Path to the output directory (PNG sequence) or file
+    /// (Y4M). Missing directories are created.
+    /// @param format Format to write frames in.
+    /// @param width Width of the frames in pixels.
+    /// @param height Height of the frames in pixels.
+    /// @param frameRate Frame rate to write in the header of video files.
+    /// @param ringSize How many pixel buffer objects to read frames back
+    /// into.
+    ///
+    /// @note Must be called from the rendering thread, with the context
+    /// current. The offscreen framebuffer of the recorder is bound as the
+    /// render target until the recording is finished.
+    ///
+    /// @exception If the output file cannot be opened, if the ring size is
+    /// 0, or if the offscreen framebuffer cannot be set up, the function
+    /// will throw a std::runtime_error.
+    FrameRecorder(
+        const std::filesystem::path& outputPath,
+        const OutputFormat format,
+        const int width,
+        const int height,
+        const unsigned int frameRate,
+        const unsigned int ringSize = DefaultRingSize
+    );
+
+    /// @brief Finish the recording if that was not done already. Must be
+    /// called from the rendering thread, with the context current.
+    ~FrameRecorder();
+
+    /// @brief Start reading back the contents of the offscreen framebuffer
+    /// as the next frame, without waiting for the transfer. Must
+    /// be called from the rendering thread, with the context current, after
+    /// a frame was rendered and before buffers are swapped.
+    ///
+    /// @exception If the recording was finished, or if writing a previous
+    /// frame failed, the function will throw a std::runtime_error.
+    void capture();
+
+    /// @brief Retrieve all frames in flight, wait for them to be written,
+    /// release the pixel buffer objects and the offscreen framebuffer, and
+    /// bind back the framebuffer which was bound beforehand. Must be called
+    /// from the rendering thread, with the context current.
+    ///
+    /// @exception If writing a frame failed, the exception thrown while
+    /// doing so is rethrown by this function.
+    void finish();
+
+    /// @brief Get how many frames were captured.
+    ///
+    /// @return How many frames were captured.
+    unsigned int getCapturedFrameCount() const;
+};
+
+using FrameRecorderPtr = std::shared_ptr<FrameRecorder>;
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__TOOLBOX__FRAME_RECORDER_HPP
@@ -0,0 +1,154 @@
+#include "frame_scheduler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+namespace Renderboi
+{
+
+FrameScheduler::FrameScheduler(
+    const PacingMode pacingMode,
+    const unsigned int framerateLimit,
+    const unsigned int simulationRate
+) :
+    _pacingMode(pacingMode),
+    _frameInterval(_RateToInterval(framerateLimit)),
+    _spinThreshold(DefaultSpinThreshold),
+    _nextFrameTime(),
+    _lastFrameTime(),
+    _lastFrameDuration(Clock::duration::zero()),
+    _fixedTimestep(_RateToInterval(simulationRate)),
+    _accumulator(Clock::duration::zero()),
+    _maxStepsPerFrame(DefaultMaxStepsPerFrame),
+    _started(false)
+{
+
+}
+
+void FrameScheduler::waitForNextFrame()
+{
+    Clock::time_point now = Clock::now();
+    if (!_started)
+    {
+        _started = true;
+        _lastFrameTime = now;
+        _nextFrameTime = now + _frameInterval;
+        return;
+    }
+
+    if (_pacingMode == PacingMode::Limited)
+    {
+        if (now < _nextFrameTime)
+        {
+            _waitUntil(_nextFrameTime);
+            now = Clock::now();
+        }
+
+        // Schedule the next frame from the deadline rather than from now so
+        // that no drift builds up, unless the deadline was missed by more 
+        // than a frame
+        _nextFrameTime += _frameInterval;
+        if (_nextFrameTime <= now)
+        {
+            _nextFrameTime = now + _frameInterval;
+        }
+    }
+
+    _lastFrameDuration = now - _lastFrameTime;
+    _lastFrameTime = now;
+
+    // Drop simulation time which could not be caught up on in one frame
+    _accumulator = std::min(_accumulator + _lastFrameDuration, _fixedTimestep * _maxStepsPerFrame);
+}
+
+bool FrameScheduler::stepSimulation()
+{
+    if (_accumulator < _fixedTimestep) return false;
+
+    _accumulator -= _fixedTimestep;
+    return true;
+}
+
+float FrameScheduler::getFixedTimestep() const
+{
+    return std::chrono::duration<float>(_fixedTimestep).count();
+}
+
+float FrameScheduler::getInterpolationFactor() const
+{
+    const double factor = std::chrono::duration<double>(_accumulator) / std::chrono::duration<double>(_fixedTimestep);
+    return (float)std::min(factor, 1.0);
+}
+
+float FrameScheduler::getLastFrameDuration() const
+{
+    return std::chrono::duration<float>(_lastFrameDuration).count();
+}
+
+FrameScheduler::PacingMode FrameScheduler::getPacingMode() const
+{
+    return _pacingMode;
+}
+
+void FrameScheduler::setPacingMode(const PacingMode pacingMode)
+{
+    _pacingMode = pacingMode;
+}
+
+void FrameScheduler::applySwapInterval(const GLWindowPtr window) const
+{
+    window->setSwapInterval((_pacingMode == PacingMode::VSync) ? 1 : 0);
+}
+
+void FrameScheduler::setFramerateLimit(const unsigned int framerateLimit)
+{
+    _frameInterval = _RateToInterval(framerateLimit);
+}
+
+void FrameScheduler::setSimulationRate(const unsigned int simulationRate)
+{
+    _fixedTimestep = _RateToInterval(simulationRate);
+}
+
+void FrameScheduler::setSpinThreshold(const std::chrono::microseconds spinThreshold)
+{
+    _spinThreshold = spinThreshold;
+}
+
+void FrameScheduler::setMaxStepsPerFrame(const unsigned int maxStepsPerFrame)
+{
+    if (!maxStepsPerFrame)
+    {
+        throw std::runtime_error("FrameScheduler: cannot run at most 0 simulation steps per frame.");
+    }
+
+    _maxStepsPerFrame = maxStepsPerFrame;
+}
+
+void FrameScheduler::_waitUntil(const Clock::time_point deadline) const
+{
+    // Sleep through most of the wait, as sleeps may overshoot by about a
+    // scheduler quantum...
+    const Clock::time_point spinStart = deadline - _spinThreshold;
+    if (Clock::now() < spinStart)
+    {
+        std::this_thread::sleep_until(spinStart);
+    }
+
+    // ...and spin through the rest of it to hit the deadline precisely
+    while (Clock::now() < deadline);
+}
+
+FrameScheduler::Clock::duration FrameScheduler::_RateToInterval(const unsigned int rate)
+{
+    if (!rate)
+    {
+        throw std::runtime_error("FrameScheduler: rate cannot be 0.");
+    }
+
+    return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / rate));
+}
+
+}//namespace Renderboi
@@ -0,0 +1,205 @@
+#ifndef RENDERBOI__TOOLBOX__FRAME_SCHEDULER_HPP
+#define RENDERBOI__TOOLBOX__FRAME_SCHEDULER_HPP
+
+#include <chrono>
+#include <memory>
+
+#include <renderboi/window/gl_window.hpp>
+
+namespace Renderboi
+{
+
+/// @brief Paces the frames of a render loop and schedules fixed-timestep
+/// simulation steps in between them. Meant to be used as follows:
+///
+/// @code
+/// while (running)
+/// {
+///     scheduler.waitForNextFrame();
+///     while (scheduler.stepSimulation())
+///     {
+///         scene->triggerUpdate(scheduler.getFixedTimestep());
+///     }
+///     renderer.renderScene(scene, scheduler.getInterpolationFactor());
+///     window->swapBuffers();
+/// }
+/// @endcode
+class FrameScheduler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief Collection of litterals describing how frames are paced.
+    enum class PacingMode
+    {
+        /// @brief Frames are started as soon as possible.
+        Unlimited,
+        /// @brief Frames are started at a fixed rate, waiting in between
+        /// them as required.
+        Limited,
+        /// @brief Frames are paced by buffer swaps waiting for vertical
+        /// sync (see applySwapInterval()), and are otherwise started as
+        /// soon as possible.
+        VSync
+    };
+
+    /// @brief Time before a frame deadline at which waiting switches from
+    /// sleeping to spinning by default. Sleeping is cheap but imprecise,
+    /// spinning is precise but keeps a core busy.
+    static constexpr std::chrono::microseconds DefaultSpinThreshold = std::chrono::microseconds(1500);
+
+    /// @brief Maximum amount of simulation steps which are run in a single
+    /// frame by default. Simulation time which cannot be caught up on within
+    /// that many steps is dropped.
+    static constexpr unsigned int DefaultMaxStepsPerFrame = 8;
+
+private:
+    /// @brief How frames are paced.
+    PacingMode _pacingMode;
+
+    /// @brief Time interval to keep between frame starts in limited mode.
+    Clock::duration _frameInterval;
+
+    /// @brief Time before a frame deadline at which waiting switches from
+    /// sleeping to spinning.
+    Clock::duration _spinThreshold;
+
+    /// @brief Point in time at which the next frame should start in
+    /// limited mode.
+    Clock::time_point _nextFrameTime;
+
+    /// @brief Point in time at which the last frame started.
+    Clock::time_point _lastFrameTime;
+
+    /// @brief Time elapsed between the starts of the last two frames.
+    Clock::duration _lastFrameDuration;
+
+    /// @brief Duration of a simulation step.
+    Clock::duration _fixedTimestep;
+
+    /// @brief Simulation time which is yet to be stepped through.
+    Clock::duration _accumulator;
+
+    /// @brief Maximum amount of simulation steps to run in a single frame.
+    unsigned int _maxStepsPerFrame;
+
+    /// @brief Whether a frame was ever started.
+    bool _started;
+
+    /// @brief Block the calling thread until a point in time, sleeping
+    /// for most of the wait and spinning for the rest of it.
+    ///
+    /// @param deadline Point in time until which to block.
+    void _waitUntil(const Clock::time_point deadline) const;
+
+    /// @brief Compute the time interval corresponding to a rate.
+    ///
+    /// @param rate Rate (in Hz) to compute the interval of.
+    ///
+    /// @return The time interval corresponding to the rate.
+    static Clock::duration _RateToInterval(const unsigned int rate);
+
+public:
+    /// @param pacingMode How frames should be paced.
+    /// @param framerateLimit How many frames per second should be started
+    /// in limited mode.
+    /// @param simulationRate How many simulation steps should be run per
+    /// second.
+    ///
+    /// @exception If either rate is 0, the function will throw a
+    /// std::runtime_error.
+    FrameScheduler(
+        const PacingMode pacingMode = PacingMode::Limited,
+        const unsigned int framerateLimit = 60,
+        const unsigned int simulationRate = 60
+    );
+
+    /// @brief Wait until the next frame is due, as per the pacing mode, and
+    /// account for the simulation time elapsed since the last frame.
+    void waitForNextFrame();
+
+    /// @brief Consume a simulation step, if one is due in the current
+    /// frame. Call repeatedly until it returns false.
+    ///
+    /// @return Whether a simulation step should be run.
+    bool stepSimulation();
+
+    /// @brief Get the duration of a simulation step.
+    ///
+    /// @return The duration (in seconds) of a simulation step.
+    float getFixedTimestep() const;
+
+    /// @brief Get how far in between the last two simulation steps the
+    /// current frame lies, once all due steps were consumed.
+    ///
+    /// @return A factor between 0 and 1, to be used to interpolate the
+    /// state of the last two simulation steps when rendering.
+    float getInterpolationFactor() const;
+
+    /// @brief Get the time elapsed between the starts of the last two
+    /// frames.
+    ///
+    /// @return The time (in seconds) elapsed between the starts of the
+    /// last two frames.
+    float getLastFrameDuration() const;
+
+    /// @brief Get how frames are paced.
+    ///
+    /// @return The pacing mode of the scheduler.
+    PacingMode getPacingMode() const;
+
+    /// @brief Set how frames are paced. The swap interval of the window
+    /// must then be applied again (see applySwapInterval()).
+    ///
+    /// @param pacingMode The new pacing mode of the scheduler.
+    void setPacingMode(const PacingMode pacingMode);
+
+    /// @brief Set the swap interval of a window as required by the pacing
+    /// mode: buffer swaps wait for vertical sync in VSync mode, and do not
+    /// otherwise so that they do not interfere with pacing. Must be called
+    /// from the thread the GL context of the window is current on.
+    ///
+    /// @param window Pointer to the window whose swap interval to set.
+    void applySwapInterval(const GLWindowPtr window) const;
+
+    /// @brief Set how many frames per second should be started in limited
+    /// mode.
+    ///
+    /// @param framerateLimit How many frames per second should be started.
+    ///
+    /// @exception If the provided rate is 0, the function will throw a
+    /// std::runtime_error.
+    void setFramerateLimit(const unsigned int framerateLimit);
+
+    /// @brief Set how many simulation steps should be run per second.
+    ///
+    /// @param simulationRate How many simulation steps should be run per
+    /// second.
+    ///
+    /// @exception If the provided rate is 0, the function will throw a
+    /// std::runtime_error.
+    void setSimulationRate(const unsigned int simulationRate);
+
+    /// @brief Set the time before a frame deadline at which waiting
+    /// switches from sleeping to spinning.
+    ///
+    /// @param spinThreshold Time before a frame deadline at which to start
+    /// spinning. 0 disables spinning altogether.
+    void setSpinThreshold(const std::chrono::microseconds spinThreshold);
+
+    /// @brief Set the maximum amount of simulation steps to run in a
+    /// single frame.
+    ///
+    /// @param maxStepsPerFrame Maximum amount of simulation steps to run in
+    /// a single frame.
+    ///
+    /// @exception If the provided amount is 0, the function will throw a
+    /// std::runtime_error.
+    void setMaxStepsPerFrame(const unsigned int maxStepsPerFrame);
+};
+
+using FrameSchedulerPtr = std::shared_ptr<FrameScheduler>;
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__TOOLBOX__FRAME_SCHEDULER_HPP
@@ -0,0 +1,249 @@
+#include "input_log.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+
+using Renderboi::InputEvent;
+using Type = InputEvent::Type;
+using Nanoseconds = std::chrono::nanoseconds;
+
+/// @brief Append the bytes of a value to a buffer.
+template<typename V>
+void put(std::vector<char>& dest, const V value)
+{
+    const char* bytes = (const char*)&value;
+    dest.insert(dest.end(), bytes, bytes + sizeof(V));
+}
+
+/// @brief Read a value from a buffer and advance the read position.
+template<typename V>
+V take(const std::vector<char>& src, std::size_t& position)
+{
+    if (src.size() - position < sizeof(V))
+    {
+        throw std::runtime_error("InputLog: unexpected end of file.");
+    }
+
+    V value;
+    std::memcpy(&value, src.data() + position, sizeof(V));
+    position += sizeof(V);
+    return value;
+}
+
+/// @brief Append the parameters of an event to a buffer, in as few bytes as
+/// their value ranges allow.
+void putParameters(std::vector<char>& dest, const InputEvent& event)
+{
+    switch (event.type)
+    {
+        case Type::FramebufferResize:
+            put<uint32_t>(dest, event.framebufferResize.width);
+            put<uint32_t>(dest, event.framebufferResize.height);
+            break;
+        case Type::Keyboard:
+            put<uint16_t>(dest, (uint16_t)event.keyboard.key);
+            put<int32_t>(dest, event.keyboard.scancode);
+            put<uint8_t>(dest, (uint8_t)event.keyboard.action);
+            put<uint8_t>(dest, (uint8_t)event.keyboard.mods);
+            break;
+        case Type::MouseButton:
+            put<uint8_t>(dest, (uint8_t)event.mouseButton.button);
+            put<uint8_t>(dest, (uint8_t)event.mouseButton.action);
+            put<uint8_t>(dest, (uint8_t)event.mouseButton.mods);
+            break;
+        case Type::MouseCursor:
+            put<double>(dest, event.mouseCursor.xpos);
+            put<double>(dest, event.mouseCursor.ypos);
+            break;
+        case Type::GamepadConnected:
+        case Type::GamepadDisconnected:
+            break;
+        case Type::GamepadButton:
+            put<uint8_t>(dest, (uint8_t)event.gamepadButton.button);
+            put<uint8_t>(dest, (uint8_t)event.gamepadButton.action);
+            break;
+        case Type::GamepadAxis:
+            put<uint8_t>(dest, (uint8_t)event.gamepadAxis.axis);
+            put<float>(dest, event.gamepadAxis.value);
+            break;
+        case Type::GamepadStateChange:
+        {
+            // Only the values of changed axes are written
+            const Renderboi::GamepadStateChange& change = event.gamepadStateChange;
+            put<uint16_t>(dest, change.pressedButtons);
+            put<uint16_t>(dest, change.releasedButtons);
+            put<uint8_t>(dest, change.changedAxes);
+            for (unsigned int i = 0; i < Renderboi::GamepadState::AxisCount; i++)
+            {
+                if (change.changedAxes & (1u << i)) put<float>(dest, change.axes[i]);
+            }
+            break;
+        }
+    }
+}
+
+/// @brief Read the parameters of an event from a buffer, its type being
+/// already set.
+void takeParameters(const std::vector<char>& src, std::size_t& position, InputEvent& event)
+{
+    using namespace Renderboi::Window::Input;
+
+    switch (event.type)
+    {
+        case Type::FramebufferResize:
+            event.framebufferResize.width = take<uint32_t>(src, position);
+            event.framebufferResize.height = take<uint32_t>(src, position);
+            break;
+        case Type::Keyboard:
+            event.keyboard.key = (Key)take<uint16_t>(src, position);
+            event.keyboard.scancode = take<int32_t>(src, position);
+            event.keyboard.action = (Action)take<uint8_t>(src, position);
+            event.keyboard.mods = take<uint8_t>(src, position);
+            break;
+        case Type::MouseButton:
+            event.mouseButton.button = (MouseButton)take<uint8_t>(src, position);
+            event.mouseButton.action = (Action)take<uint8_t>(src, position);
+            event.mouseButton.mods = take<uint8_t>(src, position);
+            break;
+        case Type::MouseCursor:
+            event.mouseCursor.xpos = take<double>(src, position);
+            event.mouseCursor.ypos = take<double>(src, position);
+            break;
+        case Type::GamepadConnected:
+        case Type::GamepadDisconnected:
+            break;
+        case Type::GamepadButton:
+            event.gamepadButton.button = (Gamepad::Button)take<uint8_t>(src, position);
+            event.gamepadButton.action = (Action)take<uint8_t>(src, position);
+            break;
+        case Type::GamepadAxis:
+            event.gamepadAxis.axis = (Gamepad::Axis)take<uint8_t>(src, position);
+            event.gamepadAxis.value = take<float>(src, position);
+            break;
+        case Type::GamepadStateChange:
+        {
+            Renderboi::GamepadStateChange& change = event.gamepadStateChange;
+            change.pressedButtons = take<uint16_t>(src, position);
+            change.releasedButtons = take<uint16_t>(src, position);
+            change.changedAxes = take<uint8_t>(src, position);
+            for (unsigned int i = 0; i < Renderboi::GamepadState::AxisCount; i++)
+            {
+                change.axes[i] = (change.changedAxes & (1u << i)) ? take<float>(src, position) : 0.f;
+            }
+            break;
+        }
+        default:
+            throw std::runtime_error("InputLog: unknown event type " + std::to_string((unsigned int)event.type) + ".");
+    }
+}
+
+}//namespace
+
+namespace Renderboi
+{
+
+InputLog::InputLog() :
+    _records()
+{
+
+}
+
+void InputLog::append(const Record& record)
+{
+    if (!_records.empty() && record.step < _records.back().step)
+    {
+        throw std::runtime_error("InputLog: cannot append event of step " + std::to_string(record.step) +
+            " after event of step " + std::to_string(_records.back().step) + ".");
+    }
+
+    _records.push_back(record);
+}
+
+const std::vector<InputLog::Record>& InputLog::getRecords() const
+{
+    return _records;
+}
+
+uint32_t InputLog::getLastStep() const
+{
+    return _records.empty() ? 0 : _records.back().step;
+}
+
+void InputLog::save(const std::filesystem::path& path) const
+{
+    std::vector<char> buffer;
+    buffer.insert(buffer.end(), Magic, Magic + sizeof(Magic));
+    put<uint32_t>(buffer, Version);
+    put<uint32_t>(buffer, (uint32_t)_records.size());
+
+    const InputEvent::Clock::time_point origin = _records.empty() ? InputEvent::Clock::time_point() : _records.front().event.timestamp;
+    for (const Record& record : _records)
+    {
+        put<uint32_t>(buffer, record.step);
+        put<int64_t>(buffer, std::chrono::duration_cast<Nanoseconds>(record.event.timestamp - origin).count());
+        put<uint8_t>(buffer, (uint8_t)record.event.type);
+        putParameters(buffer, record.event);
+    }
+
+    std::ofstream stream(path, std::ios::binary);
+    if (!stream)
+    {
+        throw std::runtime_error("InputLog: could not open \"" + path.string() + "\" for writing.");
+    }
+
+    stream.write(buffer.data(), buffer.size());
+    if (!stream)
+    {
+        throw std::runtime_error("InputLog: failed to write \"" + path.string() + "\".");
+    }
+}
+
+InputLog InputLog::Load(const std::filesystem::path& path)
+{
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream)
+    {
+        throw std::runtime_error("InputLog: could not open \"" + path.string() + "\" for reading.");
+    }
+
+    const std::vector<char> buffer((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    if (buffer.size() < sizeof(Magic) || std::memcmp(buffer.data(), Magic, sizeof(Magic)) != 0)
+    {
+        throw std::runtime_error("InputLog: \"" + path.string() + "\" is not an input log.");
+    }
+
+    std::size_t position = sizeof(Magic);
+    const uint32_t version = take<uint32_t>(buffer, position);
+    if (version != Version)
+    {
+        throw std::runtime_error("InputLog: unsupported input log version " + std::to_string(version) + ".");
+    }
+
+    InputLog log;
+    const uint32_t count = take<uint32_t>(buffer, position);
+    log._records.reserve(count);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        Record record = {};
+        record.step = take<uint32_t>(buffer, position);
+        record.event.timestamp = InputEvent::Clock::time_point(
+            std::chrono::duration_cast<InputEvent::Clock::duration>(Nanoseconds(take<int64_t>(buffer, position)))
+        );
+        record.event.type = (InputEvent::Type)take<uint8_t>(buffer, position);
+        record.event.source = 0;
+        takeParameters(buffer, position, record.event);
+
+        log.append(record);
+    }
+
+    return log;
+}
+
+}//namespace Renderboi
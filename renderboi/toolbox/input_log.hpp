@@ -0,0 +1,89 @@
+#ifndef RENDERBOI__TOOLBOX__INPUT_LOG_HPP
+#define RENDERBOI__TOOLBOX__INPUT_LOG_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include <renderboi/window/event/input_event.hpp>
+
+namespace Renderboi
+{
+
+/// @brief Sequence of input events, each tagged with the simulation step
+/// before which it was processed, so that it can be replayed at the same
+/// point of a fixed-timestep simulation. Saved to disk in a compact binary
+/// format: a header, followed by one record per event made of its step, its
+/// timestamp, its type and only the parameters relevant to that type. Values
+/// are written in the byte order of the machine.
+class InputLog
+{
+public:
+    /// @brief Input event along with the simulation step it belongs to.
+    struct Record
+    {
+        /// @brief Index of the simulation step before which the event was
+        /// processed.
+        uint32_t step;
+
+        /// @brief The recorded event. Its source index is not recorded, and
+        /// is 0 in loaded logs.
+        InputEvent event;
+    };
+
+    /// @brief Bytes identifying an input log file.
+    static constexpr char Magic[8] = {'R', 'B', 'I', 'N', 'P', 'U', 'T', '\0'};
+
+    /// @brief Version of the format of input log files.
+    static constexpr uint32_t Version = 1;
+
+private:
+    /// @brief Recorded events, by increasing step.
+    std::vector<Record> _records;
+
+public:
+    InputLog();
+
+    /// @brief Append an event to the log.
+    ///
+    /// @param record Event to append, along with its step. Its step must
+    /// not be lower than that of the last appended event.
+    ///
+    /// @exception If the step of the event is lower than that of the last
+    /// event in the log, the function will throw a std::runtime_error.
+    void append(const Record& record);
+
+    /// @brief Get the events in the log.
+    ///
+    /// @return The array of events in the log, by increasing step.
+    const std::vector<Record>& getRecords() const;
+
+    /// @brief Get the step of the last event in the log.
+    ///
+    /// @return The step of the last event in the log, or 0 if it is empty.
+    uint32_t getLastStep() const;
+
+    /// @brief Write the log to a file. Timestamps are saved relative to that
+    /// of the first event.
+    ///
+    /// @param path Path to the file to write.
+    ///
+    /// @exception If the file cannot be written, the function will throw a
+    /// std::runtime_error.
+    void save(const std::filesystem::path& path) const;
+
+    /// @brief Read a log from a file.
+    ///
+    /// @param path Path to the file to read.
+    ///
+    /// @return The log read from the file. Timestamps are relative to an
+    /// epoch of 0.
+    ///
+    /// @exception If the file cannot be read, is not an input log, or is
+    /// corrupted, the function will throw a std::runtime_error.
+    static InputLog Load(const std::filesystem::path& path);
+};
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__TOOLBOX__INPUT_LOG_HPP
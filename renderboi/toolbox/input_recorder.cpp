@@ -0,0 +1,123 @@
+#include "input_recorder.hpp"
+
+namespace Renderboi
+{
+
+InputRecorder::InputRecorder(const std::filesystem::path& outputPath) :
+    InputProcessor(),
+    GamepadInputProcessor(),
+    _outputPath(outputPath),
+    _log(),
+    _step(0),
+    _finished(false)
+{
+
+}
+
+void InputRecorder::_record(InputEvent& event)
+{
+    if (_finished) return;
+
+    event.timestamp = InputEvent::Clock::now();
+    event.source = 0;
+    _log.append({_step, event});
+}
+
+void InputRecorder::setStep(const uint32_t step)
+{
+    _step = step;
+}
+
+unsigned int InputRecorder::getRecordedEventCount() const
+{
+    return (unsigned int)_log.getRecords().size();
+}
+
+void InputRecorder::finish()
+{
+    if (_finished) return;
+
+    _finished = true;
+    _log.save(_outputPath);
+}
+
+void InputRecorder::processFramebufferResize(const GLWindowPtr window, const unsigned int width, const unsigned int height)
+{
+    InputEvent event;
+    event.type = InputEvent::Type::FramebufferResize;
+    event.framebufferResize = {width, height};
+
+    _record(event);
+}
+
+void InputRecorder::processKeyboard(const GLWindowPtr window, const Key key, const int scancode, const Action action, const int mods)
+{
+    InputEvent event;
+    event.type = InputEvent::Type::Keyboard;
+    event.keyboard = {key, scancode, action, mods};
+
+    _record(event);
+}
+
+void InputRecorder::processMouseButton(const GLWindowPtr window, const MButton button, const Action action, const int mods)
+{
+    InputEvent event;
+    event.type = InputEvent::Type::MouseButton;
+    event.mouseButton = {button, action, mods};
+
+    _record(event);
+}
+
+void InputRecorder::processMouseCursor(const GLWindowPtr window, const double xpos, const double ypos)
+{
+    InputEvent event;
+    event.type = InputEvent::Type::MouseCursor;
+    event.mouseCursor = {xpos, ypos};
+
+    _record(event);
+}
+
+void InputRecorder::processConnected(const GamepadPtr gamepad)
+{
+    InputEvent event;
+    event.type = InputEvent::Type::GamepadConnected;
+
+    _record(event);
+}
+
+void InputRecorder::processDisconnected(const GamepadPtr gamepad)
+{
+    InputEvent event;
+    event.type = InputEvent::Type::GamepadDisconnected;
+
+    _record(event);
+}
+
+void InputRecorder::processButton(const GamepadPtr gamepad, const GButton button, const Action action)
+{
+    InputEvent event;
+    event.type = InputEvent::Type::GamepadButton;
+    event.gamepadButton = {button, action};
+
+    _record(event);
+}
+
+void InputRecorder::processAxis(const GamepadPtr gamepad, const Axis axis, const float value)
+{
+    InputEvent event;
+    event.type = InputEvent::Type::GamepadAxis;
+    event.gamepadAxis = {axis, value};
+
+    _record(event);
+}
+
+void InputRecorder::processStateChange(const GamepadPtr gamepad, const GamepadStateChange& change)
+{
+    InputEvent event;
+    event.type = InputEvent::Type::GamepadStateChange;
+    event.gamepadStateChange = change;
+
+    _record(event);
+}
+
+}//namespace Renderboi
@@ -0,0 +1,168 @@
+#ifndef RENDERBOI__TOOLBOX__INPUT_RECORDER_HPP
+#define RENDERBOI__TOOLBOX__INPUT_RECORDER_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+
+#include <renderboi/window/input_processor.hpp>
+#include <renderboi/window/gl_window.hpp>
+#include <renderboi/window/event/input_event.hpp>
+#include <renderboi/window/gamepad/gamepad.hpp>
+#include <renderboi/window/gamepad/gamepad_input_processor.hpp>
+
+#include "input_log.hpp"
+
+namespace Renderboi
+{
+
+/// @brief Input processor recording all the events it receives into an input
+/// log, each tagged with the current simulation step, so that they can be
+/// replayed later on by an InputReplayer. Meant to be registered to the input
+/// splitter receiving all input, and to be told which simulation step is next
+/// before events are processed.
+class InputRecorder : public InputProcessor, public GamepadInputProcessor
+{
+private:
+    using Key = Window::Input::Key;
+    using MButton = Window::Input::MouseButton;
+    using GButton = Window::Input::Gamepad::Button;
+    using Axis = Window::Input::Gamepad::Axis;
+    using Action = Window::Input::Action;
+
+    /// @brief Path to the file to write the log to.
+    std::filesystem::path _outputPath;
+
+    /// @brief Events recorded so far.
+    InputLog _log;
+
+    /// @brief Index of the simulation step which recorded events are tagged
+    /// with.
+    uint32_t _step;
+
+    /// @brief Whether the log was written.
+    bool _finished;
+
+    /// @brief Timestamp and append an event to the log.
+    ///
+    /// @param event Event to record. Its timestamp is set by this function.
+    void _record(InputEvent& event);
+
+public:
+    /// @param outputPath Path to the file to write the log to once the
+    /// recording is finished.
+    InputRecorder(const std::filesystem::path& outputPath);
+
+    /// @brief Set the simulation step which events recorded from now on
+    /// will be replayed before.
+    ///
+    /// @param step Index of the next simulation step.
+    void setStep(const uint32_t step);
+
+    /// @brief Get how many events were recorded.
+    ///
+    /// @return How many events were recorded.
+    unsigned int getRecordedEventCount() const;
+
+    /// @brief Write the log to its file. Events received afterwards are
+    /// discarded.
+    ///
+    /// @exception If the log cannot be written, the function will throw a
+    /// std::runtime_error.
+    void finish();
+
+    //////////////////////////////////////////////
+    ///                                        ///
+    /// Methods overridden from InputProcessor ///
+    ///                                        ///
+    //////////////////////////////////////////////
+
+    /// @brief Callback for a framebuffer resize event.
+    ///
+    /// @param window Pointer to the GLWindow in which the event was
+    /// triggered.
+    /// @param width New width (in pixels) of the framebuffer.
+    /// @param height New height (in pixels) of the framebuffer.
+    void processFramebufferResize(const GLWindowPtr window, const unsigned int width, const unsigned int height) override;
+
+    /// @brief Callback for a keyboard event.
+    ///
+    /// @param window Pointer to the GLWindow in which the event was
+    /// triggered.
+    /// @param key Literal describing which key triggered the event.
+    /// @param scancode Scancode of the key which triggered the event.
+    /// Platform-dependent, but consistent over time.
+    /// @param action Literal describing what action was performed on
+    /// the key which triggered the event.
+    /// @param mods Bit field describing which modifiers were enabled
+    /// during the key event (Ctrl, Shift, etc).
+    void processKeyboard(
+        const GLWindowPtr window,
+        const Key key,
+        const int scancode,
+        const Action action,
+        const int mods
+    ) override;
+
+    /// @brief Callback for a mouse button event.
+    ///
+    /// @param window Pointer to the GLWindow in which the event was
+    /// triggered.
+    /// @param button Literal describing which button triggered the
+    /// event.
+    /// @param action Literal describing what action was performed on
+    /// the button which triggered the event.
+    /// @param mods Bit field describing which modifiers were enabled
+    /// during the button event (Ctrl, Shift, etc).
+    void processMouseButton(
+        const GLWindowPtr window,
+        const MButton button,
+        const Action action,
+        const int mods
+    ) override;
+
+    /// @brief Callback for a mouse cursor event.
+    ///
+    /// @param window Pointer to the GLWindow in which the event was
+    /// triggered.
+    /// @param xpos X coordinate of the new position of the mouse.
+    /// @param ypos Y coordinate of the new position of the mouse.
+    void processMouseCursor(const GLWindowPtr window, const double xpos, const double ypos) override;
+
+    /////////////////////////////////////////////////////
+    ///                                               ///
+    /// Methods overridden from GamepadInputProcessor ///
+    ///                                               ///
+    /////////////////////////////////////////////////////
+
+    /// @brief Callback for when the gamepad is connected.
+    void processConnected(const GamepadPtr gamepad) override;
+
+    /// @brief Callback for when the gamepad is disconnected.
+    void processDisconnected(const GamepadPtr gamepad) override;
+
+    /// @brief Callback for a gamepad button event.
+    ///
+    /// @param button Literal describing which key triggered the event.
+    /// @param action Literal describing what action was performed on
+    /// the button which triggered the event.
+    void processButton(const GamepadPtr gamepad, const GButton button, const Action action) override;
+
+    /// @brief Callback for a gamepad axis event.
+    ///
+    /// @param axis Literal describing which axis triggered the event.
+    /// @param value Value at which the axis was polled.
+    void processAxis(const GamepadPtr gamepad, const Axis axis, const float value) override;
+
+    /// @brief Callback for all the button and axis events of a single poll
+    /// of the gamepad. Recorded as a single event.
+    ///
+    /// @param change Record of the changes in the state of the gamepad.
+    void processStateChange(const GamepadPtr gamepad, const GamepadStateChange& change) override;
+};
+
+using InputRecorderPtr = std::shared_ptr<InputRecorder>;
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__TOOLBOX__INPUT_RECORDER_HPP
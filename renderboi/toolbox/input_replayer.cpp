@@ -0,0 +1,100 @@
+#include "input_replayer.hpp"
+
+#include <stdexcept>
+
+namespace Renderboi
+{
+
+InputReplayer::InputReplayer(
+    const std::filesystem::path& path,
+    const InputProcessorPtr target,
+    const GamepadInputProcessorPtr gamepadTarget,
+    const GLWindowPtr window,
+    const GamepadPtr gamepad
+) :
+    _log(),
+    _nextRecord(0),
+    _target(target),
+    _gamepadTarget(gamepadTarget),
+    _window(window),
+    _gamepad(gamepad)
+{
+    if (!_target || !_gamepadTarget)
+    {
+        throw std::runtime_error("InputReplayer: cannot inject events into null input processor pointer.");
+    }
+
+    if (!_window)
+    {
+        throw std::runtime_error("InputReplayer: cannot inject events on behalf of null window pointer.");
+    }
+
+    _log = InputLog::Load(path);
+}
+
+void InputReplayer::_dispatch(const InputEvent& event)
+{
+    switch (event.type)
+    {
+        case InputEvent::Type::FramebufferResize:
+            _target->processFramebufferResize(_window,
+                event.framebufferResize.width, event.framebufferResize.height);
+            break;
+        case InputEvent::Type::Keyboard:
+            _target->processKeyboard(_window,
+                event.keyboard.key, event.keyboard.scancode, event.keyboard.action, event.keyboard.mods);
+            break;
+        case InputEvent::Type::MouseButton:
+            _target->processMouseButton(_window,
+                event.mouseButton.button, event.mouseButton.action, event.mouseButton.mods);
+            break;
+        case InputEvent::Type::MouseCursor:
+            _target->processMouseCursor(_window,
+                event.mouseCursor.xpos, event.mouseCursor.ypos);
+            break;
+        case InputEvent::Type::GamepadConnected:
+            if (_gamepad) _gamepadTarget->processConnected(_gamepad);
+            break;
+        case InputEvent::Type::GamepadDisconnected:
+            if (_gamepad) _gamepadTarget->processDisconnected(_gamepad);
+            break;
+        case InputEvent::Type::GamepadButton:
+            if (_gamepad) _gamepadTarget->processButton(_gamepad,
+                event.gamepadButton.button, event.gamepadButton.action);
+            break;
+        case InputEvent::Type::GamepadAxis:
+            if (_gamepad) _gamepadTarget->processAxis(_gamepad,
+                event.gamepadAxis.axis, event.gamepadAxis.value);
+            break;
+        case InputEvent::Type::GamepadStateChange:
+            if (_gamepad) _gamepadTarget->processStateChange(_gamepad,
+                event.gamepadStateChange);
+            break;
+    }
+}
+
+unsigned int InputReplayer::replayStep(const uint32_t step)
+{
+    const std::vector<InputLog::Record>& records = _log.getRecords();
+    unsigned int count = 0;
+
+    while (_nextRecord < records.size() && records[_nextRecord].step <= step)
+    {
+        _dispatch(records[_nextRecord++].event);
+        count++;
+    }
+
+    return count;
+}
+
+bool InputReplayer::finished() const
+{
+    return _nextRecord == _log.getRecords().size();
+}
+
+uint32_t InputReplayer::getLastStep() const
+{
+    return _log.getLastStep();
+}
+
+}//namespace Renderboi
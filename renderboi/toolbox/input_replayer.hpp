@@ -0,0 +1,95 @@
+#ifndef RENDERBOI__TOOLBOX__INPUT_REPLAYER_HPP
+#define RENDERBOI__TOOLBOX__INPUT_REPLAYER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+
+#include <renderboi/window/gl_window.hpp>
+#include <renderboi/window/input_processor.hpp>
+#include <renderboi/window/gamepad/gamepad.hpp>
+#include <renderboi/window/gamepad/gamepad_input_processor.hpp>
+
+#include "input_log.hpp"
+
+namespace Renderboi
+{
+
+/// @brief Injects the events of an input log into input processors, at the
+/// simulation steps they were recorded at. Provided the simulation runs at a
+/// fixed timestep, replaying a log reproduces the recorded session exactly,
+/// regardless of how fast frames are rendered.
+class InputReplayer
+{
+private:
+    /// @brief Events to replay.
+    InputLog _log;
+
+    /// @brief Index of the next event to replay.
+    std::size_t _nextRecord;
+
+    /// @brief Input processor to which window events are injected.
+    InputProcessorPtr _target;
+
+    /// @brief Input processor to which gamepad events are injected.
+    GamepadInputProcessorPtr _gamepadTarget;
+
+    /// @brief Window on behalf of which window events are injected.
+    GLWindowPtr _window;
+
+    /// @brief Gamepad on behalf of which gamepad events are injected.
+    GamepadPtr _gamepad;
+
+    /// @brief Forward an event to the relevant target.
+    ///
+    /// @param event Event to forward.
+    void _dispatch(const InputEvent& event);
+
+public:
+    /// @param path Path to the input log to replay.
+    /// @param target Input processor to which window events will be
+    /// injected.
+    /// @param gamepadTarget Input processor to which gamepad events will be
+    /// injected.
+    /// @param window Window on behalf of which window events will be
+    /// injected.
+    /// @param gamepad Gamepad on behalf of which gamepad events will be
+    /// injected. If null, gamepad events are discarded.
+    ///
+    /// @exception If either input processor pointer or the window pointer
+    /// is null, or if the log cannot be read, the function will throw a
+    /// std::runtime_error.
+    InputReplayer(
+        const std::filesystem::path& path,
+        const InputProcessorPtr target,
+        const GamepadInputProcessorPtr gamepadTarget,
+        const GLWindowPtr window,
+        const GamepadPtr gamepad = nullptr
+    );
+
+    /// @brief Inject all events which were recorded before a simulation
+    /// step and were not injected yet. Must be called before every
+    /// simulation step is run, with increasing step indices.
+    ///
+    /// @param step Index of the simulation step about to be run.
+    ///
+    /// @return How many events were injected.
+    unsigned int replayStep(const uint32_t step);
+
+    /// @brief Tell whether all events were injected.
+    ///
+    /// @return Whether all events were injected.
+    bool finished() const;
+
+    /// @brief Get the step of the last event in the log.
+    ///
+    /// @return The step of the last event in the log.
+    uint32_t getLastStep() const;
+};
+
+using InputReplayerPtr = std::shared_ptr<InputReplayer>;
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__TOOLBOX__INPUT_REPLAYER_HPP
@@ -1,64 +1,118 @@
 #include "input_splitter.hpp"
 
 #include <stdexcept>
+#include <utility>
 
 namespace Renderboi
 {
 
 InputSplitter::InputSplitter() :
     _subscriberRollingCount(0),
-    _subscribers()
+    _framebufferResizeSubscribers(),
+    _keyboardSubscribers(),
+    _mouseButtonSubscribers(),
+    _mouseCursorSubscribers(),
+    _connectedSubscribers(),
+    _disconnectedSubscribers(),
+    _buttonSubscribers(),
+    _axisSubscribers(),
+    _stateChangeSubscribers()
 {
 
 }
 
-unsigned int InputSplitter::registerInputProcessor(InputProcessorPtr inputProcessor)
+void InputSplitter::_CheckNotNull(const void* inputProcessor)
 {
     if (!inputProcessor)
     {
         throw std::runtime_error("InputSplitter: cannot register null input processor pointer.");
     }
-
-    _subscribers[_subscriberRollingCount] = inputProcessor;
-    return _subscriberRollingCount++;
 }
 
 void InputSplitter::detachInputProcessor(unsigned int subscriptionId)
 {
-    _subscribers.erase(subscriptionId);
+    _Detach(_framebufferResizeSubscribers, subscriptionId);
+    _Detach(_keyboardSubscribers, subscriptionId);
+    _Detach(_mouseButtonSubscribers, subscriptionId);
+    _Detach(_mouseCursorSubscribers, subscriptionId);
 }
 
 void InputSplitter::detachAllInputProcessors()
 {
-    _subscribers.clear();
+    _framebufferResizeSubscribers.clear();
+    _keyboardSubscribers.clear();
+    _mouseButtonSubscribers.clear();
+    _mouseCursorSubscribers.clear();
 }
 
-unsigned int InputSplitter::registerGamepadInputProcessor(GamepadInputProcessorPtr inputProcessor)
+void InputSplitter::detachGamepadInputProcessor(unsigned int subscriptionId)
 {
-    if (!inputProcessor)
-    {
-        throw std::runtime_error("InputSplitter: cannot register null input processor pointer.");
-    }
+    _Detach(_connectedSubscribers, subscriptionId);
+    _Detach(_disconnectedSubscribers, subscriptionId);
+    _Detach(_buttonSubscribers, subscriptionId);
+    _Detach(_axisSubscribers, subscriptionId);
+    _Detach(_stateChangeSubscribers, subscriptionId);
+}
 
-    _gamepadSubscribers[_subscriberRollingCount] = inputProcessor;
-    return _subscriberRollingCount++;
+void InputSplitter::detachAllIGamepadnputProcessors()
+{
+    _connectedSubscribers.clear();
+    _disconnectedSubscribers.clear();
+    _buttonSubscribers.clear();
+    _axisSubscribers.clear();
+    _stateChangeSubscribers.clear();
 }
 
-void InputSplitter::detachGamepadInputProcessor(unsigned int subscriptionId)
+unsigned int InputSplitter::registerFramebufferResizeCallback(FramebufferResizeCallback callback)
 {
-    _gamepadSubscribers.erase(subscriptionId);
+    return _subscribe(_framebufferResizeSubscribers, std::move(callback));
 }
 
-void InputSplitter::detachAllIGamepadnputProcessors()
+unsigned int InputSplitter::registerKeyboardCallback(KeyboardCallback callback)
 {
-    _gamepadSubscribers.clear();
+    return _subscribe(_keyboardSubscribers, std::move(callback));
+}
+
+unsigned int InputSplitter::registerMouseButtonCallback(MouseButtonCallback callback)
+{
+    return _subscribe(_mouseButtonSubscribers, std::move(callback));
+}
+
+unsigned int InputSplitter::registerMouseCursorCallback(MouseCursorCallback callback)
+{
+    return _subscribe(_mouseCursorSubscribers, std::move(callback));
+}
+
+unsigned int InputSplitter::registerGamepadConnectedCallback(GamepadConnectionCallback callback)
+{
+    return _subscribe(_connectedSubscribers, std::move(callback));
+}
+
+unsigned int InputSplitter::registerGamepadDisconnectedCallback(GamepadConnectionCallback callback)
+{
+    return _subscribe(_disconnectedSubscribers, std::move(callback));
+}
+
+unsigned int InputSplitter::registerGamepadButtonCallback(GamepadButtonCallback callback)
+{
+    return _subscribe(_buttonSubscribers, std::move(callback));
+}
+
+unsigned int InputSplitter::registerGamepadAxisCallback(GamepadAxisCallback callback)
+{
+    return _subscribe(_axisSubscribers, std::move(callback));
+}
+
+unsigned int InputSplitter::registerGamepadStateChangeCallback(GamepadStateChangeCallback callback)
+{
+    return _subscribe(_stateChangeSubscribers, std::move(callback));
 }
 
 void InputSplitter::processFramebufferResize(const GLWindowPtr window, const unsigned int width, const unsigned int height)
 {
-    for (const auto& [_, inputProc] : _subscribers)
+    for (const auto& subscriber : _framebufferResizeSubscribers)
     {
-        inputProc->processFramebufferResize(window, width, height);
+        subscriber.callback(window, width, height);
     }
 }
 
@@ -70,9 +124,9 @@ void InputSplitter::processKeyboard(
     const int mods
 )
 {
-    for (const auto [_, inputProc] : _subscribers)
+    for (const auto& subscriber : _keyboardSubscribers)
     {
-        inputProc->processKeyboard(window, key, scancode, action, mods);
+        subscriber.callback(window, key, scancode, action, mods);
     }
 }
 
@@ -83,49 +137,57 @@ void InputSplitter::processMouseButton(
     const int mods
 )
 {
-    for (const auto [_, inputProc] : _subscribers)
+    for (const auto& subscriber : _mouseButtonSubscribers)
     {
-        inputProc->processMouseButton(window, button, action, mods);
+        subscriber.callback(window, button, action, mods);
     }
 }
 
 void InputSplitter::processMouseCursor(const GLWindowPtr window, const double xpos, const double ypos)
 {
-    for (const auto [_, inputProc] : _subscribers)
+    for (const auto& subscriber : _mouseCursorSubscribers)
     {
-        inputProc->processMouseCursor(window, xpos, ypos);
+        subscriber.callback(window, xpos, ypos);
     }
 }
 
 void InputSplitter::processConnected(const GamepadPtr gamepad)
 {
-    for (const auto [_, inputProc] : _gamepadSubscribers)
+    for (const auto& subscriber : _connectedSubscribers)
     {
-        inputProc->processConnected(gamepad);
+        subscriber.callback(gamepad);
     }
 }
 
 void InputSplitter::processDisconnected(const GamepadPtr gamepad)
 {
-    for (const auto [_, inputProc] : _gamepadSubscribers)
+    for (const auto& subscriber : _disconnectedSubscribers)
     {
-        inputProc->processDisconnected(gamepad);
+        subscriber.callback(gamepad);
     }
 }
 
 void InputSplitter::processButton(const GamepadPtr gamepad, const GButton button, const Action action)
 {
-    for (const auto [_, inputProc] : _gamepadSubscribers)
+    for (const auto& subscriber : _buttonSubscribers)
     {
-        inputProc->processButton(gamepad, button, action);
+        subscriber.callback(gamepad, button, action);
     }
 }
 
 void InputSplitter::processAxis(const GamepadPtr gamepad, const Axis axis, const float value)
 {
-    for (const auto [_, inputProc] : _gamepadSubscribers)
+    for (const auto& subscriber : _axisSubscribers)
+    {
+        subscriber.callback(gamepad, axis, value);
+    }
+}
+
+void InputSplitter::processStateChange(const GamepadPtr gamepad, const GamepadStateChange& change)
+{
+    for (const auto& subscriber : _stateChangeSubscribers)
     {
-        inputProc->processAxis(gamepad, axis, value);
+        subscriber.callback(gamepad, change);
     }
 }
 
@@ -2,16 +2,27 @@
 #define RENDERBOI__TOOLBOX__INPUT_SPLITTER_HPP
 
 #include <memory>
-#include <unordered_map>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <renderboi/utilities/delegate.hpp>
 
 #include <renderboi/window/input_processor.hpp>
 #include <renderboi/window/gl_window.hpp>
+#include <renderboi/window/gamepad/gamepad.hpp>
 #include <renderboi/window/gamepad/gamepad_input_processor.hpp>
 
 namespace Renderboi
 {
 
-/// @brief Forwards all input it receives to multiple subscribers.
+/// @brief Forwards all input it receives to multiple subscribers. Subscribers
+/// are kept in one contiguous list per kind of event, and an input processor
+/// is only added to the lists of the events whose handler its class
+/// overrides, so that events are not forwarded to processors which would
+/// ignore them. Plain callables can be subscribed to a single kind of event
+/// as well. Events are forwarded to subscribers in the order they were
+/// registered.
 class InputSplitter : public InputProcessor, public GamepadInputProcessor
 {
 private:
@@ -22,54 +33,211 @@ private:
     using Axis = Window::Input::Gamepad::Axis;
     using Action = Window::Input::Action;
 
+public:
+    using FramebufferResizeCallback = Delegate<void(const GLWindowPtr&, unsigned int, unsigned int)>;
+    using KeyboardCallback = Delegate<void(const GLWindowPtr&, Key, int, Action, int)>;
+    using MouseButtonCallback = Delegate<void(const GLWindowPtr&, MButton, Action, int)>;
+    using MouseCursorCallback = Delegate<void(const GLWindowPtr&, double, double)>;
+    using GamepadConnectionCallback = Delegate<void(const GamepadPtr&)>;
+    using GamepadButtonCallback = Delegate<void(const GamepadPtr&, GButton, Action)>;
+    using GamepadAxisCallback = Delegate<void(const GamepadPtr&, Axis, float)>;
+    using GamepadStateChangeCallback = Delegate<void(const GamepadPtr&, const GamepadStateChange&)>;
+
+private:
+    /// @brief Callback along with the ID of the subscription it belongs to.
+    template<typename C>
+    struct _Subscriber
+    {
+        unsigned int id;
+        C callback;
+    };
+
+    template<typename C>
+    using _SubscriberList = std::vector<_Subscriber<C>>;
+
     /// @brief Used to uniquely identify subscriptions.
     unsigned int _subscriberRollingCount;
 
-    /// @brief Array of subscribers to which input must be forwarded.
-    std::unordered_map<unsigned int, InputProcessorPtr> _subscribers;
+    /// @brief Subscribers to framebuffer resize events.
+    _SubscriberList<FramebufferResizeCallback> _framebufferResizeSubscribers;
+
+    /// @brief Subscribers to keyboard events.
+    _SubscriberList<KeyboardCallback> _keyboardSubscribers;
+
+    /// @brief Subscribers to mouse button events.
+    _SubscriberList<MouseButtonCallback> _mouseButtonSubscribers;
+
+    /// @brief Subscribers to mouse cursor events.
+    _SubscriberList<MouseCursorCallback> _mouseCursorSubscribers;
+
+    /// @brief Subscribers to gamepad connection events.
+    _SubscriberList<GamepadConnectionCallback> _connectedSubscribers;
 
-    /// @brief Array of subscribers to which input must be forwarded.
-    std::unordered_map<unsigned int, GamepadInputProcessorPtr> _gamepadSubscribers;
+    /// @brief Subscribers to gamepad disconnection events.
+    _SubscriberList<GamepadConnectionCallback> _disconnectedSubscribers;
+
+    /// @brief Subscribers to gamepad button events.
+    _SubscriberList<GamepadButtonCallback> _buttonSubscribers;
+
+    /// @brief Subscribers to gamepad axis events.
+    _SubscriberList<GamepadAxisCallback> _axisSubscribers;
+
+    /// @brief Subscribers to gamepad state change events.
+    _SubscriberList<GamepadStateChangeCallback> _stateChangeSubscribers;
+
+    /// @brief Tell whether a class overrides a handler, given pointers to
+    /// the handler as seen from the class and from the base class. Both
+    /// pointers have the same type unless some class other than the base
+    /// class declares the handler.
+    template<typename M, typename BaseM>
+    static constexpr bool _Overrides(M, BaseM);
+
+    /// @brief Add a callback to a subscriber list.
+    ///
+    /// @return The ID of the new subscription.
+    template<typename C>
+    unsigned int _subscribe(_SubscriberList<C>& list, C&& callback);
+
+    /// @brief Remove all callbacks belonging to a subscription from a list.
+    template<typename C>
+    static void _Detach(_SubscriberList<C>& list, const unsigned int subscriptionId);
+
+    /// @brief Throw if a pointer to a processor to register is null.
+    static void _CheckNotNull(const void* inputProcessor);
 
 public:
     InputSplitter();
 
     /// @brief Register a new input processor. Use the returned subscription
-    /// ID to detach it.
+    /// ID to detach it. The processor only receives the events whose
+    /// handler is overridden by its static type; if its static type is
+    /// InputProcessor, it receives all of them.
+    ///
+    /// @tparam T Static type of the input processor.
     ///
     /// @param inputProcessor Pointer to the new input processor.
     ///
     /// @return The subscription ID, used to unsubscribe the registered
     /// input processor.
-    unsigned int registerInputProcessor(InputProcessorPtr inputProcessor);
+    ///
+    /// @exception If the provided pointer is null, the function will throw
+    /// a std::runtime_error.
+    template<typename T, typename = std::enable_if_t<std::is_base_of_v<InputProcessor, T>>>
+    unsigned int registerInputProcessor(const std::shared_ptr<T> inputProcessor);
 
-    /// @brief Unsubscribe an input processor.
+    /// @brief Unsubscribe an input processor, or callbacks subscribed to
+    /// window events.
     ///
     /// @param subscriptionId ID returned when the input processor was first
     /// registered to the input splitter.
     void detachInputProcessor(unsigned int subscriptionId);
 
-    /// @brief Unsubscribe all input processors from the input splitter.
+    /// @brief Unsubscribe all input processors from the input splitter,
+    /// along with all callbacks subscribed to window events.
     void detachAllInputProcessors();
 
-    /// @brief Register a new input processor. Use the returned subscription
-    /// ID to detach it.
+    /// @brief Register a new gamepad input processor. Use the returned
+    /// subscription ID to detach it. The processor only receives the events
+    /// whose handler is overridden by its static type; if its static type
+    /// is GamepadInputProcessor, it receives all of them. State changes are
+    /// received by processors overriding any button or axis handler, as
+    /// they are expanded by default.
     ///
-    /// @param inputProcessor Pointer to the new input processor.
+    /// @tparam T Static type of the gamepad input processor.
+    ///
+    /// @param gamepadInputProcessor Pointer to the new input processor.
     ///
     /// @return The subscription ID, used to unsubscribe the registered
     /// input processor.
-    unsigned int registerGamepadInputProcessor(GamepadInputProcessorPtr gamepadInputProcessor);
+    ///
+    /// @exception If the provided pointer is null, the function will throw
+    /// a std::runtime_error.
+    template<typename T, typename = std::enable_if_t<std::is_base_of_v<GamepadInputProcessor, T>>>
+    unsigned int registerGamepadInputProcessor(const std::shared_ptr<T> gamepadInputProcessor);
 
-    /// @brief Unsubscribe an input processor.
+    /// @brief Unsubscribe a gamepad input processor, or callbacks subscribed
+    /// to gamepad events.
     ///
     /// @param subscriptionId ID returned when the input processor was first
     /// registered to the input splitter.
     void detachGamepadInputProcessor(unsigned int subscriptionId);
 
-    /// @brief Unsubscribe all input processors from the input splitter.
+    /// @brief Unsubscribe all gamepad input processors from the input
+    /// splitter, along with all callbacks subscribed to gamepad events.
     void detachAllIGamepadnputProcessors();
 
+    /// @brief Subscribe a callable to framebuffer resize events. Detach it
+    /// with detachInputProcessor().
+    ///
+    /// @param callback Callable to invoke on framebuffer resize events.
+    ///
+    /// @return The subscription ID.
+    unsigned int registerFramebufferResizeCallback(FramebufferResizeCallback callback);
+
+    /// @brief Subscribe a callable to keyboard events. Detach it with
+    /// detachInputProcessor().
+    ///
+    /// @param callback Callable to invoke on keyboard events.
+    ///
+    /// @return The subscription ID.
+    unsigned int registerKeyboardCallback(KeyboardCallback callback);
+
+    /// @brief Subscribe a callable to mouse button events. Detach it with
+    /// detachInputProcessor().
+    ///
+    /// @param callback Callable to invoke on mouse button events.
+    ///
+    /// @return The subscription ID.
+    unsigned int registerMouseButtonCallback(MouseButtonCallback callback);
+
+    /// @brief Subscribe a callable to mouse cursor events. Detach it with
+    /// detachInputProcessor().
+    ///
+    /// @param callback Callable to invoke on mouse cursor events.
+    ///
+    /// @return The subscription ID.
+    unsigned int registerMouseCursorCallback(MouseCursorCallback callback);
+
+    /// @brief Subscribe a callable to gamepad connection events. Detach it
+    /// with detachGamepadInputProcessor().
+    ///
+    /// @param callback Callable to invoke on gamepad connection events.
+    ///
+    /// @return The subscription ID.
+    unsigned int registerGamepadConnectedCallback(GamepadConnectionCallback callback);
+
+    /// @brief Subscribe a callable to gamepad disconnection events. Detach
+    /// it with detachGamepadInputProcessor().
+    ///
+    /// @param callback Callable to invoke on gamepad disconnection events.
+    ///
+    /// @return The subscription ID.
+    unsigned int registerGamepadDisconnectedCallback(GamepadConnectionCallback callback);
+
+    /// @brief Subscribe a callable to gamepad button events. Detach it with
+    /// detachGamepadInputProcessor().
+    ///
+    /// @param callback Callable to invoke on gamepad button events.
+    ///
+    /// @return The subscription ID.
+    unsigned int registerGamepadButtonCallback(GamepadButtonCallback callback);
+
+    /// @brief Subscribe a callable to gamepad axis events. Detach it with
+    /// detachGamepadInputProcessor().
+    ///
+    /// @param callback Callable to invoke on gamepad axis events.
+    ///
+    /// @return The subscription ID.
+    unsigned int registerGamepadAxisCallback(GamepadAxisCallback callback);
+
+    /// @brief Subscribe a callable to gamepad state change events. Detach
+    /// it with detachGamepadInputProcessor().
+    ///
+    /// @param callback Callable to invoke on gamepad state change events.
+    ///
+    /// @return The subscription ID.
+    unsigned int registerGamepadStateChangeCallback(GamepadStateChangeCallback callback);
+
     //////////////////////////////////////////////
     ///                                        ///
     /// Methods overridden from InputProcessor ///
@@ -89,11 +257,11 @@ public:
     /// @param window Pointer to the GLWindow in which the event was
     /// triggered.
     /// @param key Literal describing which key triggered the event.
-    /// @param scancode Scancode of the key which triggered the event. 
+    /// @param scancode Scancode of the key which triggered the event.
     /// Platform-dependent, but consistent over time.
     /// @param action Literal describing what action was performed on
     /// the key which triggered the event.
-    /// @param mods Bit field describing which modifiers were enabled 
+    /// @param mods Bit field describing which modifiers were enabled
     /// during the key event (Ctrl, Shift, etc).
     void processKeyboard(
         const GLWindowPtr window,
@@ -111,7 +279,7 @@ public:
     /// event.
     /// @param action Literal describing what action was performed on
     /// the button which triggered the event.
-    /// @param mods Bit field describing which modifiers were enabled 
+    /// @param mods Bit field describing which modifiers were enabled
     /// during the button event (Ctrl, Shift, etc).
     void processMouseButton(
         const GLWindowPtr window,
@@ -152,10 +320,139 @@ public:
     /// @param axis Literal describing which axis triggered the event.
     /// @param value Value at which the axis was polled.
     void processAxis(const GamepadPtr gamepad, const Axis axis, const float value) override;
+
+    /// @brief Callback for all the button and axis events of a single poll
+    /// of the gamepad. Forwarded as a whole to subscribers.
+    ///
+    /// @param change Record of the changes in the state of the gamepad.
+    void processStateChange(const GamepadPtr gamepad, const GamepadStateChange& change) override;
 };
 
+template<typename M, typename BaseM>
+constexpr bool InputSplitter::_Overrides(M, BaseM)
+{
+    return !std::is_same_v<M, BaseM>;
+}
+
+template<typename C>
+unsigned int InputSplitter::_subscribe(_SubscriberList<C>& list, C&& callback)
+{
+    list.push_back({_subscriberRollingCount, std::move(callback)});
+    return _subscriberRollingCount++;
+}
+
+template<typename C>
+void InputSplitter::_Detach(_SubscriberList<C>& list, const unsigned int subscriptionId)
+{
+    std::erase_if(list, [subscriptionId](const _Subscriber<C>& subscriber)
+    {
+        return subscriber.id == subscriptionId;
+    });
+}
+
+template<typename T, typename>
+unsigned int InputSplitter::registerInputProcessor(const std::shared_ptr<T> inputProcessor)
+{
+    using Base = InputProcessor;
+    _CheckNotNull(inputProcessor.get());
+
+    constexpr bool all = std::is_same_v<T, Base>;
+    const unsigned int id = _subscriberRollingCount++;
+
+    // The processor is captured in each of its callbacks, which share
+    // ownership of it
+    if constexpr (all || _Overrides(&T::processFramebufferResize, &Base::processFramebufferResize))
+    {
+        _framebufferResizeSubscribers.push_back({id, [inputProcessor](const GLWindowPtr& window, unsigned int width, unsigned int height)
+        {
+            inputProcessor->processFramebufferResize(window, width, height);
+        }});
+    }
+
+    if constexpr (all || _Overrides(&T::processKeyboard, &Base::processKeyboard))
+    {
+        _keyboardSubscribers.push_back({id, [inputProcessor](const GLWindowPtr& window, Key key, int scancode, Action action, int mods)
+        {
+            inputProcessor->processKeyboard(window, key, scancode, action, mods);
+        }});
+    }
+
+    if constexpr (all || _Overrides(&T::processMouseButton, &Base::processMouseButton))
+    {
+        _mouseButtonSubscribers.push_back({id, [inputProcessor](const GLWindowPtr& window, MButton button, Action action, int mods)
+        {
+            inputProcessor->processMouseButton(window, button, action, mods);
+        }});
+    }
+
+    if constexpr (all || _Overrides(&T::processMouseCursor, &Base::processMouseCursor))
+    {
+        _mouseCursorSubscribers.push_back({id, [inputProcessor](const GLWindowPtr& window, double xpos, double ypos)
+        {
+            inputProcessor->processMouseCursor(window, xpos, ypos);
+        }});
+    }
+
+    return id;
+}
+
+template<typename T, typename>
+unsigned int InputSplitter::registerGamepadInputProcessor(const std::shared_ptr<T> gamepadInputProcessor)
+{
+    using Base = GamepadInputProcessor;
+    _CheckNotNull(gamepadInputProcessor.get());
+
+    constexpr bool all = std::is_same_v<T, Base>;
+    const unsigned int id = _subscriberRollingCount++;
+
+    if constexpr (all || _Overrides(&T::processConnected, &Base::processConnected))
+    {
+        _connectedSubscribers.push_back({id, [gamepadInputProcessor](const GamepadPtr& gamepad)
+        {
+            gamepadInputProcessor->processConnected(gamepad);
+        }});
+    }
+
+    if constexpr (all || _Overrides(&T::processDisconnected, &Base::processDisconnected))
+    {
+        _disconnectedSubscribers.push_back({id, [gamepadInputProcessor](const GamepadPtr& gamepad)
+        {
+            gamepadInputProcessor->processDisconnected(gamepad);
+        }});
+    }
+
+    constexpr bool button = all || _Overrides(&T::processButton, &Base::processButton);
+    if constexpr (button)
+    {
+        _buttonSubscribers.push_back({id, [gamepadInputProcessor](const GamepadPtr& gamepad, GButton button, Action action)
+        {
+            gamepadInputProcessor->processButton(gamepad, button, action);
+        }});
+    }
+
+    constexpr bool axis = all || _Overrides(&T::processAxis, &Base::processAxis);
+    if constexpr (axis)
+    {
+        _axisSubscribers.push_back({id, [gamepadInputProcessor](const GamepadPtr& gamepad, Axis axis, float value)
+        {
+            gamepadInputProcessor->processAxis(gamepad, axis, value);
+        }});
+    }
+
+    // State changes are expanded into button and axis events by default
+    if constexpr (button || axis || _Overrides(&T::processStateChange, &Base::processStateChange))
+    {
+        _stateChangeSubscribers.push_back({id, [gamepadInputProcessor](const GamepadPtr& gamepad, const GamepadStateChange& change)
+        {
+            gamepadInputProcessor->processStateChange(gamepad, change);
+        }});
+    }
+
+    return id;
+}
+
 using InputSplitterPtr = std::shared_ptr<InputSplitter>;
 
 }//namespace Renderboi
 
-#endif//RENDERBOI__TOOLBOX__INPUT_SPLITTER_HPP
\ No newline at end of file
+#endif//RENDERBOI__TOOLBOX__INPUT_SPLITTER_HPP
@@ -3,6 +3,8 @@
 
 #include <memory>
 
+#include "../controls/control_binding_table.hpp"
+
 namespace Renderboi
 {
 
@@ -53,6 +55,17 @@ public:
     ///
     /// @return The array of all controls bound to an action.
     virtual std::vector<std::pair<Control, T>> getAllBoundControls() = 0;
+
+    /// @brief Returns a table of all bound controls, meant to dispatch
+    /// control events quickly. The default implementation compiles a new
+    /// table at every call; implementations should rather keep a table and
+    /// only rebuild it when bindings change. May be called from any thread.
+    ///
+    /// @return A pointer to the table of all bound controls.
+    virtual ControlBindingTablePtr<T> getBindingTable()
+    {
+        return std::make_shared<const ControlBindingTable<T>>(getAllBoundControls());
+    }
 };
 
 template<typename T>
@@ -15,6 +15,25 @@ class MeshGenerator
         ///
         /// @return A pointer to the mesh containing the generated vertices.
         virtual MeshPtr generateMesh() const = 0;
+
+        /// @brief Generate the vertex data at a reduced level of detail, put
+        /// it in a new mesh object and return it. Generators which do not 
+        /// support reduced resolutions only provide level 0.
+        ///
+        /// @param level Level of detail to generate. Level 0 is the full 
+        /// resolution mesh, each subsequent level being roughly half as 
+        /// detailed as the previous one along each dimension.
+        /// @param[out] error Will receive an estimate of the largest distance
+        /// (in object space units) between the generated surface and the full
+        /// resolution one.
+        ///
+        /// @return A pointer to the mesh containing the generated vertices, or
+        /// nullptr if the generator cannot go any coarser.
+        virtual MeshPtr generateLodMesh(unsigned int level, float& error) const
+        {
+            error = 0.f;
+            return (level == 0) ? generateMesh() : nullptr;
+        }
 };
 
 }//namespace Renderboi
@@ -1,5 +1,6 @@
 #include "plane_generator.hpp"
 
+#include <algorithm>
 #include <vector>
 #include <memory>
 #include <glm/glm.hpp>
@@ -120,4 +121,37 @@ MeshPtr PlaneGenerator::generateMesh() const
     return std::make_shared<Mesh>(GL_TRIANGLE_STRIP, vertices, indices, primitiveSizes, primitiveOffsets);
 }
 
+MeshPtr PlaneGenerator::generateLodMesh(unsigned int level, float& error) const
+{
+    const unsigned int shift = std::min(level, 31u);
+    const unsigned int tileAmountX = std::max(parameters.tileAmountX >> shift, 1u);
+    const unsigned int tileAmountY = std::max(parameters.tileAmountY >> shift, 1u);
+
+    // Stop the chain once halving no longer changes anything
+    if (level > 0 &&
+        tileAmountX == std::max(parameters.tileAmountX >> (shift - 1), 1u) &&
+        tileAmountY == std::max(parameters.tileAmountY >> (shift - 1), 1u))
+    {
+        error = 0.f;
+        return nullptr;
+    }
+
+    // Keep the overall extent of the plane (and thus its texture mapping) 
+    // intact by growing the tiles as their amount decreases
+    Parameters p = parameters;
+    p.tileSizeX = parameters.tileSizeX * parameters.tileAmountX / tileAmountX;
+    p.tileSizeY = parameters.tileSizeY * parameters.tileAmountY / tileAmountY;
+    p.tileAmountX = tileAmountX;
+    p.tileAmountY = tileAmountY;
+
+    // The plane is flat, so no geometric error is introduced. What is lost is
+    // the density at which per-vertex data is sampled, measured as the growth
+    // of the tile half-diagonal.
+    const float fullHalfDiagonal = 0.5f * glm::length(glm::vec2(parameters.tileSizeX, parameters.tileSizeY));
+    const float halfDiagonal = 0.5f * glm::length(glm::vec2(p.tileSizeX, p.tileSizeY));
+    error = halfDiagonal - fullHalfDiagonal;
+
+    return PlaneGenerator(p).generateMesh();
+}
+
 }//namespace Renderboi
@@ -86,6 +86,19 @@ public:
     ///
     /// @return A pointer to the mesh containing the generated vertices.
     MeshPtr generateMesh() const override;
+
+    /// @brief Generate the vertex data at a reduced level of detail, put
+    /// it in a new mesh object and return it.
+    ///
+    /// @param level Level of detail to generate. Level 0 is the full 
+    /// resolution mesh, each subsequent level halving the tile amounts of the plane.
+    /// @param[out] error Will receive an estimate of the largest distance
+    /// (in object space units) between the generated surface and the full
+    /// resolution one.
+    ///
+    /// @return A pointer to the mesh containing the generated vertices, or
+    /// nullptr if the generator cannot go any coarser.
+    MeshPtr generateLodMesh(unsigned int level, float& error) const override;
 };
 
 }//namespace Renderboi
@@ -1,5 +1,6 @@
 #include "torus_generator.hpp"
 
+#include <algorithm>
 #include <vector>
 #include <cmath>
 #include <memory>
@@ -16,6 +17,21 @@ namespace Renderboi
 
 constexpr double Pi = glm::pi<double>();
 
+namespace
+{
+    // Below 3 vertices, a circle degenerates into a line
+    unsigned int resolutionAtLevel(unsigned int fullResolution, unsigned int level)
+    {
+        return std::max(fullResolution >> std::min(level, 31u), 3u);
+    }
+
+    // Largest gap between a circle and a regular polygon inscribed in it
+    double sagitta(double radius, unsigned int sides)
+    {
+        return radius * (1.0 - cos(Pi / sides));
+    }
+}
+
 TorusGenerator::TorusGenerator() :
     TorusGenerator(DefaultToroidalRadius, DefaultPoloidalRadius, DefaultToroidalVertexResolution, DefaultPoloidalVertexResolution)
 {
@@ -124,4 +140,28 @@ MeshPtr TorusGenerator::generateMesh() const
     return std::make_shared<Mesh>(GL_TRIANGLE_STRIP, vertices, indices);
 }
 
+MeshPtr TorusGenerator::generateLodMesh(unsigned int level, float& error) const
+{
+    Parameters p = parameters;
+    p.toroidalVertexRes = resolutionAtLevel(parameters.toroidalVertexRes, level);
+    p.poloidalVertexRes = resolutionAtLevel(parameters.poloidalVertexRes, level);
+
+    // Stop the chain once halving no longer changes anything
+    if (level > 0 &&
+        p.toroidalVertexRes == resolutionAtLevel(parameters.toroidalVertexRes, level - 1) &&
+        p.poloidalVertexRes == resolutionAtLevel(parameters.poloidalVertexRes, level - 1))
+    {
+        error = 0.f;
+        return nullptr;
+    }
+
+    // The outer equator is where toroidal faceting deviates the most
+    const double outerRadius = p.toroidalRadius + p.poloidalRadius;
+    const double toroidalError = sagitta(outerRadius, p.toroidalVertexRes) - sagitta(outerRadius, parameters.toroidalVertexRes);
+    const double poloidalError = sagitta(p.poloidalRadius, p.poloidalVertexRes) - sagitta(p.poloidalRadius, parameters.poloidalVertexRes);
+    error = (float)std::max({toroidalError, poloidalError, 0.0});
+
+    return TorusGenerator(p).generateMesh();
+}
+
 }//namespace Renderboi
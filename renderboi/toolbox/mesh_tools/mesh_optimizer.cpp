@@ -0,0 +1,244 @@
+#include "mesh_optimizer.hpp"
+
+#include <cmath>
+#include <utility>
+#include <memory>
+#include <vector>
+
+#include <glad/gl.h>
+
+#include <renderboi/core/mesh.hpp>
+#include <renderboi/core/vertex.hpp>
+
+#include "triangle_list.hpp"
+
+namespace Renderboi
+{
+
+namespace
+{
+    /// @brief Size of the LRU cache modelled by the vertex scoring function.
+    constexpr unsigned int CacheSize = 32;
+
+    /// @brief Scoring parameters, as suggested by Tom Forsyth.
+    constexpr float CacheDecayPower = 1.5f;
+    constexpr float LastTriangleScore = 0.75f;
+    constexpr float ValenceBoostScale = 2.f;
+    constexpr float ValenceBoostPower = 0.5f;
+
+    float vertexScore(int cachePosition, unsigned int remainingTriangles)
+    {
+        // Vertices no longer used by any triangle are worthless
+        if (remainingTriangles == 0) return -1.f;
+
+        float score = 0.f;
+        if (cachePosition >= 0)
+        {
+            // Vertices of the last triangle get a fixed score, so as not to 
+            // favour reusing the exact same edge over and over
+            if (cachePosition < 3)
+            {
+                score = LastTriangleScore;
+            }
+            else
+            {
+                const float scale = 1.f / (CacheSize - 3);
+                score = std::pow(1.f - (cachePosition - 3) * scale, CacheDecayPower);
+            }
+        }
+
+        // Boost vertices with few triangles left, so that they get retired
+        // early rather than leaving lone triangles behind
+        score += ValenceBoostScale * std::pow((float)remainingTriangles, -ValenceBoostPower);
+        return score;
+    }
+}
+
+std::vector<unsigned int> optimizeVertexCache(const std::vector<unsigned int>& indices, const size_t vertexCount)
+{
+    const size_t triangleCount = indices.size() / 3;
+
+    // Build vertex to triangle adjacency in compressed form
+    std::vector<unsigned int> remaining(vertexCount, 0);
+    for (unsigned int index : indices) remaining[index]++;
+
+    std::vector<unsigned int> adjacencyOffsets(vertexCount + 1, 0);
+    for (size_t v = 0; v < vertexCount; v++) adjacencyOffsets[v + 1] = adjacencyOffsets[v] + remaining[v];
+
+    std::vector<unsigned int> adjacency(indices.size());
+    std::vector<unsigned int> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+    for (unsigned int t = 0; t < triangleCount; t++)
+    {
+        for (unsigned int k = 0; k < 3; k++)
+        {
+            adjacency[fill[indices[3*t + k]]++] = t;
+        }
+    }
+
+    std::vector<int> cachePosition(vertexCount, -1);
+    std::vector<float> vScore(vertexCount);
+    for (size_t v = 0; v < vertexCount; v++) vScore[v] = vertexScore(-1, remaining[v]);
+
+    std::vector<float> tScore(triangleCount);
+    for (unsigned int t = 0; t < triangleCount; t++)
+    {
+        tScore[t] = vScore[indices[3*t]] + vScore[indices[3*t + 1]] + vScore[indices[3*t + 2]];
+    }
+
+    std::vector<bool> emitted(triangleCount, false);
+    std::vector<unsigned int> result;
+    result.reserve(indices.size());
+
+    // Cache holds 3 extra slots for vertices pushed out by the last triangle
+    std::vector<unsigned int> cache;
+    std::vector<unsigned int> newCache;
+    cache.reserve(CacheSize + 3);
+    newCache.reserve(CacheSize + 3);
+
+    unsigned int scanCursor = 0;
+    int best = -1;
+
+    for (size_t emittedCount = 0; emittedCount < triangleCount; emittedCount++)
+    {
+        // Nothing good in the cache, fall back to the next unemitted triangle
+        if (best < 0)
+        {
+            while (emitted[scanCursor]) scanCursor++;
+            best = (int)scanCursor;
+        }
+
+        const unsigned int* tri = &indices[3 * best];
+        emitted[best] = true;
+
+        // Emit triangle and retire it from its vertices' adjacency
+        newCache.assign(tri, tri + 3);
+        for (unsigned int k = 0; k < 3; k++)
+        {
+            const unsigned int v = tri[k];
+            result.push_back(v);
+
+            unsigned int* first = &adjacency[adjacencyOffsets[v]];
+            unsigned int* last = first + remaining[v];
+            for (unsigned int* it = first; it != last; it++)
+            {
+                if (*it == (unsigned int)best)
+                {
+                    std::swap(*it, *(last - 1));
+                    break;
+                }
+            }
+            remaining[v]--;
+        }
+
+        // Move the triangle's vertices to the front of the LRU cache
+        for (unsigned int v : cache)
+        {
+            if (v != tri[0] && v != tri[1] && v != tri[2]) newCache.push_back(v);
+        }
+        for (size_t i = CacheSize; i < newCache.size(); i++) cachePosition[newCache[i]] = -1;
+        if (newCache.size() > CacheSize) newCache.resize(CacheSize);
+        cache.swap(newCache);
+
+        // Rescore vertices in the cache and the triangles around them
+        for (size_t i = 0; i < cache.size(); i++)
+        {
+            cachePosition[cache[i]] = (int)i;
+        }
+        for (unsigned int v : newCache)
+        {
+            // Rescore vertices which fell out of the cache (the previous cache
+            // now lives in newCache)
+            if (cachePosition[v] >= 0) continue;
+
+            const float newScore = vertexScore(-1, remaining[v]);
+            const float delta = newScore - vScore[v];
+            vScore[v] = newScore;
+
+            for (unsigned int a = adjacencyOffsets[v]; a < adjacencyOffsets[v] + remaining[v]; a++)
+            {
+                tScore[adjacency[a]] += delta;
+            }
+        }
+
+        best = -1;
+        float bestScore = -1.f;
+        for (unsigned int v : cache)
+        {
+            const float newScore = vertexScore(cachePosition[v], remaining[v]);
+            const float delta = newScore - vScore[v];
+            vScore[v] = newScore;
+
+            for (unsigned int a = adjacencyOffsets[v]; a < adjacencyOffsets[v] + remaining[v]; a++)
+            {
+                tScore[adjacency[a]] += delta;
+            }
+        }
+        for (unsigned int v : cache)
+        {
+            for (unsigned int a = adjacencyOffsets[v]; a < adjacencyOffsets[v] + remaining[v]; a++)
+            {
+                const unsigned int t = adjacency[a];
+                if (tScore[t] > bestScore)
+                {
+                    bestScore = tScore[t];
+                    best = (int)t;
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+void optimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices)
+{
+    std::vector<unsigned int> remap(vertices.size(), (unsigned int)-1);
+    std::vector<Vertex> reordered;
+    reordered.reserve(vertices.size());
+
+    for (unsigned int& index : indices)
+    {
+        if (remap[index] == (unsigned int)-1)
+        {
+            remap[index] = (unsigned int)reordered.size();
+            reordered.push_back(vertices[index]);
+        }
+        index = remap[index];
+    }
+
+    vertices.swap(reordered);
+}
+
+MeshPtr optimizeMesh(const Mesh& mesh)
+{
+    std::vector<Vertex> vertices = mesh.getVertices();
+    std::vector<unsigned int> indices = optimizeVertexCache(triangleListFromMesh(mesh), vertices.size());
+    optimizeVertexFetch(vertices, indices);
+
+    return std::make_shared<Mesh>(GL_TRIANGLES, vertices, indices);
+}
+
+float averageCacheMissRatio(const std::vector<unsigned int>& indices, const size_t vertexCount, const unsigned int cacheSize)
+{
+    const size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0) return 0.f;
+
+    // Simulate a FIFO cache: each vertex remembers when it was last inserted
+    std::vector<size_t> insertionStamp(vertexCount, 0);
+    size_t stamp = 0;
+    size_t misses = 0;
+
+    for (unsigned int index : indices)
+    {
+        const bool cached = insertionStamp[index] != 0 && (stamp - insertionStamp[index]) < cacheSize;
+        if (!cached)
+        {
+            insertionStamp[index] = ++stamp;
+            misses++;
+        }
+    }
+
+    return (float)misses / (float)triangleCount;
+}
+
+}//namespace Renderboi
@@ -0,0 +1,59 @@
+#ifndef RENDERBOI__TOOLBOX__MESH_TOOLS__MESH_OPTIMIZER_HPP
+#define RENDERBOI__TOOLBOX__MESH_TOOLS__MESH_OPTIMIZER_HPP
+
+#include <vector>
+
+#include <renderboi/core/mesh.hpp>
+#include <renderboi/core/vertex.hpp>
+
+namespace Renderboi
+{
+
+/// @brief Reorder the triangles of an independent triangle list so as to 
+/// maximize hits in the post-transform vertex cache of the GPU (Forsyth's 
+/// linear-speed vertex cache optimisation).
+///
+/// @param indices Vertex indices of the triangles to reorder, three per 
+/// triangle.
+/// @param vertexCount How many vertices the indices refer to.
+///
+/// @return An array filled with the same triangles, in optimized order.
+std::vector<unsigned int> optimizeVertexCache(const std::vector<unsigned int>& indices, const size_t vertexCount);
+
+/// @brief Reorder vertices in the order in which they are first referenced by
+/// the indices, so that vertex fetching walks memory linearly. Unreferenced
+/// vertices are discarded and indices are remapped accordingly.
+///
+/// @param[in,out] vertices Vertices to reorder.
+/// @param[in,out] indices Indices to remap.
+void optimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices);
+
+/// @brief Produce a version of a mesh optimized for vertex processing: its
+/// primitives are unrolled into an independent triangle list, triangles are
+/// reordered for vertex cache efficiency, and vertices are then reordered for
+/// vertex fetch locality.
+///
+/// @param mesh The mesh to optimize. Its draw mode must be one of 
+/// GL_TRIANGLES, GL_TRIANGLE_STRIP or GL_TRIANGLE_FAN.
+///
+/// @return A pointer to a new mesh drawn with GL_TRIANGLES.
+///
+/// @exception If the draw mode of the mesh is not made of triangles, the 
+/// function will throw a std::runtime_error.
+MeshPtr optimizeMesh(const Mesh& mesh);
+
+/// @brief Compute the average amount of vertex shader invocations per 
+/// triangle (ACMR) which drawing a triangle list would incur with a FIFO
+/// post-transform cache of a given size. Lower is better, 0.5 being the 
+/// theoretical optimum for a regular grid.
+///
+/// @param indices Vertex indices of the triangles, three per triangle.
+/// @param vertexCount How many vertices the indices refer to.
+/// @param cacheSize Size of the simulated vertex cache.
+///
+/// @return The average cache miss ratio of the triangle list.
+float averageCacheMissRatio(const std::vector<unsigned int>& indices, const size_t vertexCount, const unsigned int cacheSize = 16);
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__TOOLBOX__MESH_TOOLS__MESH_OPTIMIZER_HPP
@@ -0,0 +1,296 @@
+#include "mesh_simplifier.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+#include <glad/gl.h>
+#include <glm/glm.hpp>
+
+#include <renderboi/core/mesh.hpp>
+#include <renderboi/core/vertex.hpp>
+
+#include "triangle_list.hpp"
+
+namespace Renderboi
+{
+
+namespace
+{
+    /// @brief Symmetric 4x4 matrix measuring the weighted sum of squared
+    /// distances of a point to a set of planes. Only the upper triangle is
+    /// stored, along with the sum of the weights of the planes.
+    struct Quadric
+    {
+        double a2, ab, ac, ad;
+        double     b2, bc, bd;
+        double         c2, cd;
+        double             d2;
+        double weight;
+
+        void addPlane(const glm::dvec3& n, double d, double weight)
+        {
+            a2 += weight * n.x * n.x; ab += weight * n.x * n.y; ac += weight * n.x * n.z; ad += weight * n.x * d;
+            b2 += weight * n.y * n.y; bc += weight * n.y * n.z; bd += weight * n.y * d;
+            c2 += weight * n.z * n.z; cd += weight * n.z * d;
+            d2 += weight * d * d;
+            this->weight += weight;
+        }
+
+        Quadric& operator+=(const Quadric& o)
+        {
+            a2 += o.a2; ab += o.ab; ac += o.ac; ad += o.ad;
+            b2 += o.b2; bc += o.bc; bd += o.bd;
+            c2 += o.c2; cd += o.cd;
+            d2 += o.d2;
+            weight += o.weight;
+            return *this;
+        }
+
+        double evaluate(const glm::dvec3& p) const
+        {
+            return a2 * p.x * p.x + 2 * ab * p.x * p.y + 2 * ac * p.x * p.z + 2 * ad * p.x
+                 + b2 * p.y * p.y + 2 * bc * p.y * p.z + 2 * bd * p.y
+                 + c2 * p.z * p.z + 2 * cd * p.z
+                 + d2;
+        }
+
+        /// @brief Get the squared distance of a point to the planes, averaged
+        /// over their weights, which is expressed in object space units
+        /// regardless of how finely the surface is tessellated.
+        double meanSquaredDistance(const glm::dvec3& p) const
+        {
+            return (weight > 0.0) ? std::max(0.0, evaluate(p)) / weight : 0.0;
+        }
+    };
+
+    /// @brief Candidate collapse of vertex "from" onto vertex "to".
+    struct Collapse
+    {
+        double cost;
+        double squaredError;
+        unsigned int from;
+        unsigned int to;
+        unsigned int fromVersion;
+        unsigned int toVersion;
+
+        bool operator>(const Collapse& other) const
+        {
+            return cost > other.cost;
+        }
+    };
+
+    struct PositionHash
+    {
+        size_t operator()(const glm::vec3& p) const
+        {
+            std::hash<float> h;
+            return h(p.x) ^ (h(p.y) << 1) ^ (h(p.z) << 2);
+        }
+    };
+}
+
+MeshPtr simplifyMesh(const Mesh& mesh, const float targetRatio, float& error)
+{
+    const std::vector<Vertex>& vertices = mesh.getVertices();
+    std::vector<unsigned int> triangles = triangleListFromMesh(mesh);
+
+    const size_t vertexCount = vertices.size();
+    const size_t triangleCount = triangles.size() / 3;
+    const size_t targetCount = (size_t)(std::clamp(targetRatio, 0.f, 1.f) * (float)triangleCount);
+
+    error = 0.f;
+
+    // Accumulate area-weighted plane quadrics on vertices
+    std::vector<Quadric> quadrics(vertexCount, Quadric{});
+    std::vector<std::vector<unsigned int>> vertexTriangles(vertexCount);
+    for (unsigned int t = 0; t < triangleCount; t++)
+    {
+        const glm::dvec3 p0 = vertices[triangles[3*t]].position;
+        const glm::dvec3 p1 = vertices[triangles[3*t + 1]].position;
+        const glm::dvec3 p2 = vertices[triangles[3*t + 2]].position;
+
+        glm::dvec3 n = glm::cross(p1 - p0, p2 - p0);
+        const double doubleArea = glm::length(n);
+        if (doubleArea > 0.0) n /= doubleArea;
+
+        const double d = -glm::dot(n, p0);
+        for (unsigned int k = 0; k < 3; k++)
+        {
+            quadrics[triangles[3*t + k]].addPlane(n, d, doubleArea * 0.5);
+            vertexTriangles[triangles[3*t + k]].push_back(t);
+        }
+    }
+
+    // Lock vertices sharing their position with another vertex (attribute
+    // seams), as collapsing them independently would tear the surface
+    std::vector<bool> locked(vertexCount, false);
+    std::unordered_map<glm::vec3, unsigned int, PositionHash> firstAtPosition;
+    for (unsigned int v = 0; v < vertexCount; v++)
+    {
+        auto [it, inserted] = firstAtPosition.insert({vertices[v].position, v});
+        if (!inserted)
+        {
+            locked[v] = true;
+            locked[it->second] = true;
+        }
+    }
+
+    // Lock vertices on open borders: border edges belong to a single triangle
+    std::unordered_map<uint64_t, unsigned int> edgeUseCount;
+    auto edgeKey = [](unsigned int a, unsigned int b) -> uint64_t
+    {
+        if (a > b) std::swap(a, b);
+        return ((uint64_t)a << 32) | b;
+    };
+    for (unsigned int t = 0; t < triangleCount; t++)
+    {
+        for (unsigned int k = 0; k < 3; k++)
+        {
+            edgeUseCount[edgeKey(triangles[3*t + k], triangles[3*t + (k + 1) % 3])]++;
+        }
+    }
+    for (const auto& [key, count] : edgeUseCount)
+    {
+        if (count == 1)
+        {
+            locked[(unsigned int)(key >> 32)] = true;
+            locked[(unsigned int)(key & 0xFFFFFFFF)] = true;
+        }
+    }
+
+    std::vector<unsigned int> version(vertexCount, 0);
+    std::vector<bool> triangleAlive(triangleCount, true);
+    std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> queue;
+
+    auto pushCollapse = [&](unsigned int from, unsigned int to)
+    {
+        if (locked[from]) return;
+
+        Quadric q = quadrics[from];
+        q += quadrics[to];
+        const double cost = std::max(0.0, q.evaluate(vertices[to].position));
+        queue.push({cost, q.meanSquaredDistance(vertices[to].position), from, to, version[from], version[to]});
+    };
+
+    for (const auto& [key, count] : edgeUseCount)
+    {
+        const unsigned int a = (unsigned int)(key >> 32);
+        const unsigned int b = (unsigned int)(key & 0xFFFFFFFF);
+        pushCollapse(a, b);
+        pushCollapse(b, a);
+    }
+
+    // Collapsing "from" onto "to" must not flip any surviving triangle
+    auto collapseFlipsTriangles = [&](unsigned int from, unsigned int to) -> bool
+    {
+        for (unsigned int t : vertexTriangles[from])
+        {
+            if (!triangleAlive[t]) continue;
+
+            const unsigned int* tri = &triangles[3*t];
+            if (tri[0] == to || tri[1] == to || tri[2] == to) continue;
+
+            glm::vec3 before[3], after[3];
+            for (unsigned int k = 0; k < 3; k++)
+            {
+                before[k] = vertices[tri[k]].position;
+                after[k] = (tri[k] == from) ? vertices[to].position : before[k];
+            }
+
+            const glm::vec3 nBefore = glm::cross(before[1] - before[0], before[2] - before[0]);
+            const glm::vec3 nAfter = glm::cross(after[1] - after[0], after[2] - after[0]);
+            if (glm::dot(nBefore, nAfter) <= 0.f) return true;
+        }
+
+        return false;
+    };
+
+    size_t liveTriangles = triangleCount;
+    double maxSquaredError = 0.0;
+
+    while (liveTriangles > targetCount && !queue.empty())
+    {
+        const Collapse c = queue.top();
+        queue.pop();
+
+        // Discard candidates made stale by earlier collapses
+        if (c.fromVersion != version[c.from] || c.toVersion != version[c.to]) continue;
+        if (collapseFlipsTriangles(c.from, c.to)) continue;
+
+        // Rewire triangles of "from" onto "to", killing those spanning the edge
+        for (unsigned int t : vertexTriangles[c.from])
+        {
+            if (!triangleAlive[t]) continue;
+
+            unsigned int* tri = &triangles[3*t];
+            if (tri[0] == c.to || tri[1] == c.to || tri[2] == c.to)
+            {
+                triangleAlive[t] = false;
+                liveTriangles--;
+                continue;
+            }
+
+            for (unsigned int k = 0; k < 3; k++)
+            {
+                if (tri[k] == c.from) tri[k] = c.to;
+            }
+            vertexTriangles[c.to].push_back(t);
+        }
+        vertexTriangles[c.from].clear();
+
+        quadrics[c.to] += quadrics[c.from];
+        maxSquaredError = std::max(maxSquaredError, c.squaredError);
+
+        // Invalidate and refresh every candidate around the surviving vertex
+        version[c.from]++;
+        version[c.to]++;
+        for (unsigned int t : vertexTriangles[c.to])
+        {
+            if (!triangleAlive[t]) continue;
+
+            for (unsigned int k = 0; k < 3; k++)
+            {
+                const unsigned int n = triangles[3*t + k];
+                if (n == c.to) continue;
+
+                pushCollapse(n, c.to);
+                pushCollapse(c.to, n);
+            }
+        }
+    }
+
+    // Costs are weighted by triangle area: report the error as a distance
+    error = (float)std::sqrt(maxSquaredError);
+
+    // Compact surviving vertices and triangles into a new mesh
+    std::vector<unsigned int> remap(vertexCount, (unsigned int)-1);
+    std::vector<Vertex> newVertices;
+    std::vector<unsigned int> newIndices;
+    newIndices.reserve(liveTriangles * 3);
+
+    for (unsigned int t = 0; t < triangleCount; t++)
+    {
+        if (!triangleAlive[t]) continue;
+
+        for (unsigned int k = 0; k < 3; k++)
+        {
+            const unsigned int v = triangles[3*t + k];
+            if (remap[v] == (unsigned int)-1)
+            {
+                remap[v] = (unsigned int)newVertices.size();
+                newVertices.push_back(vertices[v]);
+            }
+            newIndices.push_back(remap[v]);
+        }
+    }
+
+    return std::make_shared<Mesh>(GL_TRIANGLES, newVertices, newIndices);
+}
+
+}//namespace Renderboi
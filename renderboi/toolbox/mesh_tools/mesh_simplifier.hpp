@@ -0,0 +1,31 @@
+#ifndef RENDERBOI__TOOLBOX__MESH_TOOLS__MESH_SIMPLIFIER_HPP
+#define RENDERBOI__TOOLBOX__MESH_TOOLS__MESH_SIMPLIFIER_HPP
+
+#include <renderboi/core/mesh.hpp>
+
+namespace Renderboi
+{
+
+/// @brief Produce a simplified version of a mesh by collapsing its edges in
+/// order of increasing quadric error (Garland-Heckbert). Edges are always 
+/// collapsed onto one of their endpoints, so that surviving vertices keep
+/// their attributes untouched. Vertices lying on open borders or on attribute
+/// seams (several vertices sharing the same position) are never moved.
+///
+/// @param mesh The mesh to simplify. Its draw mode must be one of 
+/// GL_TRIANGLES, GL_TRIANGLE_STRIP or GL_TRIANGLE_FAN.
+/// @param targetRatio Fraction (between 0 and 1) of the original triangle 
+/// count which the simplified mesh should aim for. The target may not be 
+/// reached if no more edges can be collapsed safely.
+/// @param[out] error Will receive the largest approximate distance (in object
+/// space units) between the simplified surface and the original one.
+///
+/// @return A pointer to a new mesh drawn with GL_TRIANGLES.
+///
+/// @exception If the draw mode of the mesh is not made of triangles, the 
+/// function will throw a std::runtime_error.
+MeshPtr simplifyMesh(const Mesh& mesh, const float targetRatio, float& error);
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__TOOLBOX__MESH_TOOLS__MESH_SIMPLIFIER_HPP
@@ -0,0 +1,87 @@
+#include "triangle_list.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <glad/gl.h>
+
+#include <renderboi/core/mesh.hpp>
+
+namespace Renderboi
+{
+
+namespace
+{
+    void appendTriangle(std::vector<unsigned int>& list, unsigned int a, unsigned int b, unsigned int c)
+    {
+        // Degenerate triangles are only used to stitch strips together
+        if (a == b || b == c || c == a) return;
+
+        list.push_back(a);
+        list.push_back(b);
+        list.push_back(c);
+    }
+}
+
+std::vector<unsigned int> triangleListFromMesh(const Mesh& mesh)
+{
+    const unsigned int drawMode = mesh.getDrawMode();
+    if (drawMode != GL_TRIANGLES && drawMode != GL_TRIANGLE_STRIP && drawMode != GL_TRIANGLE_FAN)
+    {
+        throw std::runtime_error("triangleListFromMesh: mesh draw mode is not made of triangles.");
+    }
+
+    const std::vector<unsigned int>& indices = mesh.getIndices();
+    const std::vector<unsigned int>& sizes = mesh.getPrimitiveSizes();
+    const std::vector<void*>& offsets = mesh.getPrimitiveOffsets();
+
+    std::vector<unsigned int> result;
+    result.reserve(indices.size() * 3);
+
+    for (size_t p = 0; p < sizes.size(); p++)
+    {
+        // Primitive offsets are byte offsets into the index buffer
+        const size_t first = (size_t)((uintptr_t)offsets[p] / sizeof(unsigned int));
+        const size_t count = sizes[p];
+
+        if (first + count > indices.size())
+        {
+            throw std::runtime_error("triangleListFromMesh: primitive range exceeds index count.");
+        }
+
+        const unsigned int* prim = indices.data() + first;
+
+        switch (drawMode)
+        {
+            case GL_TRIANGLES:
+                for (size_t k = 0; k + 2 < count; k += 3)
+                {
+                    appendTriangle(result, prim[k], prim[k + 1], prim[k + 2]);
+                }
+                break;
+
+            case GL_TRIANGLE_STRIP:
+                // Every other triangle of a strip has reversed winding
+                for (size_t k = 2; k < count; k++)
+                {
+                    if (k % 2 == 0)
+                        appendTriangle(result, prim[k - 2], prim[k - 1], prim[k]);
+                    else
+                        appendTriangle(result, prim[k - 1], prim[k - 2], prim[k]);
+                }
+                break;
+
+            case GL_TRIANGLE_FAN:
+                for (size_t k = 2; k < count; k++)
+                {
+                    appendTriangle(result, prim[0], prim[k - 1], prim[k]);
+                }
+                break;
+        }
+    }
+
+    return result;
+}
+
+}//namespace Renderboi
@@ -0,0 +1,26 @@
+#ifndef RENDERBOI__TOOLBOX__MESH_TOOLS__TRIANGLE_LIST_HPP
+#define RENDERBOI__TOOLBOX__MESH_TOOLS__TRIANGLE_LIST_HPP
+
+#include <vector>
+
+#include <renderboi/core/mesh.hpp>
+
+namespace Renderboi
+{
+
+/// @brief Get the indices of a mesh rearranged as an independent triangle 
+/// list (as would be drawn with GL_TRIANGLES). Strips and fans are unrolled,
+/// and degenerate triangles are discarded.
+///
+/// @param mesh The mesh whose indices to rearrange.
+///
+/// @return An array filled with vertex indices, three per triangle.
+///
+/// @exception If the draw mode of the mesh is not one of GL_TRIANGLES, 
+/// GL_TRIANGLE_STRIP or GL_TRIANGLE_FAN, the function will throw a 
+/// std::runtime_error.
+std::vector<unsigned int> triangleListFromMesh(const Mesh& mesh);
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__TOOLBOX__MESH_TOOLS__TRIANGLE_LIST_HPP
@@ -5,13 +5,16 @@
 
 #include <glad/gl.h>
 
+#include <renderboi/core/render_stats.hpp>
+
 #include <renderboi/window/gl_window.hpp>
 #include <renderboi/window/enums.hpp>
 
 namespace Renderboi
 {
 
-BasicWindowManager::BasicWindowManager()
+BasicWindowManager::BasicWindowManager(const std::filesystem::path& renderStatsPath) :
+    _renderStatsPath(renderStatsPath)
 {
 
 }
@@ -38,6 +41,11 @@ void BasicWindowManager::triggerAction(const GLWindowPtr window, const BasicWind
         
     case BasicWindowManagerAction::ToggleFullscreen:
         _toggleFullscreen(window);
+        break;
+
+    case BasicWindowManagerAction::DumpRenderStats:
+        _dumpRenderStats();
+        break;
     }
 }
 
@@ -63,20 +71,16 @@ ControlSchemeManagerPtr<BasicWindowManagerAction> BasicWindowManager::getDefault
     schemeManager->bindControl(Control(Key::F2), BasicWindowManagerAction::PolygonLine);
     schemeManager->bindControl(Control(Key::F3), BasicWindowManagerAction::PolygonPoint);
     schemeManager->bindControl(Control(Key::F11), BasicWindowManagerAction::ToggleFullscreen);
+    schemeManager->bindControl(Control(Key::F12), BasicWindowManagerAction::DumpRenderStats);
 
     return schemeManager;
 }
 
 void BasicWindowManager::_toggleFullscreen(const GLWindowPtr window) const
 {
-    if (window->isFullscreen())
-    {
-        window->exitFullscreen();
-    }
-    else
-    {
-        window->goFullscreen(nullptr, true);
-    }
+    // Input may be processed off the main thread, which is the only one
+    // allowed to manage the window
+    window->queueEvent(Window::WindowEvent::ToggleFullscreen);
 }
 
 void BasicWindowManager::_setPolygonMode(const GLWindowPtr window, const PolygonMode mode) const
@@ -99,6 +103,19 @@ void BasicWindowManager::_setPolygonMode(const GLWindowPtr window, const Polygon
     }
 }
 
+void BasicWindowManager::_dumpRenderStats() const
+{
+    try
+    {
+        RenderStats::Export(_renderStatsPath);
+        std::cout << "Render statistics dumped to " << _renderStatsPath << "." << std::endl;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+    }
+}
+
 std::string to_string(const BasicWindowManagerAction& action)
 {
     static bool runOnce = false;
@@ -111,6 +128,7 @@ std::string to_string(const BasicWindowManagerAction& action)
         enumNames[BasicWindowManagerAction::PolygonLine]        = "PolygonLine";
         enumNames[BasicWindowManagerAction::PolygonPoint]       = "PolygonPoint";
         enumNames[BasicWindowManagerAction::ToggleFullscreen]   = "ToggleFullscreen";
+        enumNames[BasicWindowManagerAction::DumpRenderStats]    = "DumpRenderStats";
 
         runOnce = true;
     }
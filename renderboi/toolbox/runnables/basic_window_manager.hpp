@@ -1,6 +1,7 @@
 #ifndef RENDERBOI__TOOLBOX__RUNNABLES__BASIC_INPUT_MANAGER_HPP
 #define RENDERBOI__TOOLBOX__RUNNABLES__BASIC_INPUT_MANAGER_HPP
 
+#include <filesystem>
 #include <string>
 
 #include <renderboi/window/input_processor.hpp>
@@ -18,7 +19,8 @@ enum class BasicWindowManagerAction
     PolygonFill,
     PolygonLine,
     PolygonPoint,
-    ToggleFullscreen
+    ToggleFullscreen,
+    DumpRenderStats
 };
 
 enum class PolygonMode
@@ -38,16 +40,25 @@ private:
     BasicWindowManager(const BasicWindowManager& other) = delete;
     BasicWindowManager& operator=(const BasicWindowManager& other) = delete;
 
-    /// @brief Toggles the fullscreen state of the managed window.
+    /// @brief Path to the file render statistics are dumped to.
+    std::filesystem::path _renderStatsPath;
+
+    /// @brief Queues an event to toggle the fullscreen state of the managed
+    /// window on the main thread.
     void _toggleFullscreen(const GLWindowPtr window) const;
 
     /// @brief Queues an event to set the polygon mode of the render context.
     void _setPolygonMode(const GLWindowPtr window, const PolygonMode mode) const;
 
+    /// @brief Dumps render statistics to their file.
+    void _dumpRenderStats() const;
+
 public:
     using ActionType = BasicWindowManagerAction;
 
-    BasicWindowManager();
+    /// @param renderStatsPath Path to the file render statistics are
+    /// dumped to, as CSV if it has a .csv extension, or as JSON otherwise.
+    BasicWindowManager(const std::filesystem::path& renderStatsPath = "render_stats.json");
 
     /////////////////////////////////////////////////////////////////////////////
     ///                                                                       ///
@@ -31,6 +31,13 @@ void GamepadCameraManager::setSceneObject(const SceneObjectPtr sceneObject)
     }
 }
 
+Script::DataAccess GamepadCameraManager::getDataAccess() const
+{
+    DataAccess access;
+    access.write(_camera.get());
+    return access;
+}
+
 GamepadCameraManager* GamepadCameraManager::clone() const
 {
     return new GamepadCameraManager(_camera, _lookSensitivity);
@@ -54,6 +54,14 @@ void GamepadMovementScript::setSceneObject(const SceneObjectPtr sceneObject)
     _sceneObject = sceneObject;
 }
 
+Script::DataAccess GamepadMovementScript::getDataAccess() const
+{
+    DataAccess access;
+    access.write(_sceneObject.get());
+    access.read(_basisProvider.get());
+    return access;
+}
+
 GamepadMovementScript* GamepadMovementScript::clone() const
 {
     return new GamepadMovementScript(_basisProvider, _moveSpeed, _sprintMultiplier);
@@ -69,6 +69,12 @@ public:
     /// update.
     void update(float timeElapsed) override;
 
+    /// @brief Declare which data the script accesses when it is updated.
+    ///
+    /// @return A data access writing to the parent scene object and reading
+    /// from the basis provider.
+    DataAccess getDataAccess() const override;
+
     /// @brief Set the scene object which the camera script is attached to.
     /// Will also attempt to retrieve a camera from the scene object.
     ///
@@ -67,6 +67,14 @@ void KeyboardMovementScript::setSceneObject(const SceneObjectPtr sceneObject)
     _sceneObject = sceneObject;
 }
 
+Script::DataAccess KeyboardMovementScript::getDataAccess() const
+{
+    DataAccess access;
+    access.write(_sceneObject.get());
+    access.read(_basisProvider.get());
+    return access;
+}
+
 KeyboardMovementScript* KeyboardMovementScript::clone() const
 {
     return new KeyboardMovementScript(_basisProvider, _moveSpeed, _sprintMultiplier);
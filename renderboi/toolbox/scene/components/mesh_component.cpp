@@ -1,25 +1,29 @@
 #include "mesh_component.hpp"
 
-#include <renderboi/core/materials.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
 #include <renderboi/core/shader/shader_builder.hpp>
 
 namespace Renderboi
 {
 
 MeshComponent::MeshComponent(const SceneObjectPtr sceneObject, const MeshPtr mesh) :
-    MeshComponent(sceneObject, mesh, Materials::Default, ShaderBuilder::MinimalShaderProgram())
+    MeshComponent(sceneObject, mesh, MaterialRegistry::GetDefault(), ShaderProgramRegistry::Register(ShaderBuilder::MinimalShaderProgram()))
 {
 
 }
 
-MeshComponent::MeshComponent(const SceneObjectPtr sceneObject, const MeshPtr mesh, const Material material) :
-    MeshComponent(sceneObject, mesh, material, ShaderBuilder::MinimalShaderProgram())
+MeshComponent::MeshComponent(const SceneObjectPtr sceneObject, const MeshPtr mesh, const MaterialHandle material) :
+    MeshComponent(sceneObject, mesh, material, ShaderProgramRegistry::Register(ShaderBuilder::MinimalShaderProgram()))
 {
 
 }
 
 MeshComponent::MeshComponent(const SceneObjectPtr sceneObject, const MeshPtr mesh, const ShaderProgram shader) :
-    MeshComponent(sceneObject, mesh, Materials::Default, shader)
+    MeshComponent(sceneObject, mesh, MaterialRegistry::GetDefault(), ShaderProgramRegistry::Register(shader))
 {
 
 }
@@ -27,11 +31,23 @@ MeshComponent::MeshComponent(const SceneObjectPtr sceneObject, const MeshPtr mes
 MeshComponent::MeshComponent(
     const SceneObjectPtr sceneObject,
     const MeshPtr mesh,
-    const Material material,
+    const MaterialHandle material,
     const ShaderProgram shader
+) :
+    MeshComponent(sceneObject, mesh, material, ShaderProgramRegistry::Register(shader))
+{
+
+}
+
+MeshComponent::MeshComponent(
+    const SceneObjectPtr sceneObject,
+    const MeshPtr mesh,
+    const MaterialHandle material,
+    const ShaderProgramHandle shader
 ) :
     Component(ComponentType::Mesh, sceneObject),
-    _mesh(mesh),
+    _lodLevels{{mesh, 0.f}},
+    _lodErrorThreshold(DefaultLodErrorThreshold),
     _material(material),
     _shader(shader)
 {
@@ -48,7 +64,7 @@ MeshComponent::~MeshComponent()
 
 MeshPtr MeshComponent::getMesh() const
 {
-    return _mesh;
+    return _lodLevels[0].mesh;
 }
 
 void MeshComponent::setMesh(MeshPtr mesh)
@@ -58,35 +74,116 @@ void MeshComponent::setMesh(MeshPtr mesh)
         throw std::runtime_error("MeshComponent: cannot set mesh pointer to null.");
     }
 
-    _mesh = mesh;
+    _lodLevels = {{mesh, 0.f}};
 }
 
-Material MeshComponent::getMaterial() const
+void MeshComponent::addLodLevel(const MeshPtr mesh, const float error)
+{
+    if (!mesh)
+    {
+        throw std::runtime_error("MeshComponent: cannot add null mesh pointer as a level of detail.");
+    }
+
+    if (error < _lodLevels.back().error)
+    {
+        throw std::runtime_error("MeshComponent: levels of detail must be added from finest to coarsest.");
+    }
+
+    // Coarser levels are only drawn at a distance and can be uploaded again
+    // at any time: let them go first when over the GPU memory budget
+    mesh->setEvictable(true);
+    _lodLevels.push_back({mesh, error});
+}
+
+unsigned int MeshComponent::getLodLevelCount() const
+{
+    return (unsigned int)_lodLevels.size();
+}
+
+MeshComponent::LodLevel MeshComponent::getLodLevel(const unsigned int level) const
+{
+    if (level >= _lodLevels.size())
+    {
+        throw std::runtime_error("MeshComponent: level of detail " + std::to_string(level) + " does not exist.");
+    }
+
+    return _lodLevels[level];
+}
+
+float MeshComponent::getLodErrorThreshold() const
+{
+    return _lodErrorThreshold;
+}
+
+void MeshComponent::setLodErrorThreshold(const float threshold)
+{
+    _lodErrorThreshold = threshold;
+}
+
+const MeshPtr& MeshComponent::selectLodMesh(const float pixelsPerUnit) const
+{
+    // Walk from the coarsest level up, the first acceptable one wins
+    for (auto it = _lodLevels.crbegin(); it != _lodLevels.crend(); it++)
+    {
+        if (it->error * pixelsPerUnit <= _lodErrorThreshold)
+        {
+            return it->mesh;
+        }
+    }
+
+    return _lodLevels[0].mesh;
+}
+
+const Material& MeshComponent::getMaterial() const
+{
+    return MaterialRegistry::Get(_material);
+}
+
+MaterialHandle MeshComponent::getMaterialHandle() const
 {
     return _material;
 }
 
-void MeshComponent::setMaterial(const Material material)
+void MeshComponent::setMaterial(const MaterialHandle material)
 {
     _material = material;
 }
 
-ShaderProgram MeshComponent::getShader() const
+const ShaderProgram& MeshComponent::getShader() const
+{
+    return ShaderProgramRegistry::Get(_shader);
+}
+
+ShaderProgramHandle MeshComponent::getShaderHandle() const
 {
     return _shader;
 }
 
 void MeshComponent::setShader(const ShaderProgram shader)
+{
+    _shader = ShaderProgramRegistry::Register(shader);
+}
+
+void MeshComponent::setShader(const ShaderProgramHandle shader)
 {
     _shader = shader;
 }
 
 MeshComponent* MeshComponent::clone(const SceneObjectPtr newParent) const
 {
-    // By the time this shared pointer is destroyed (end of scope), responsibility will already have been shared with the cloned MeshComponent
-    MeshPtr clonedMesh = std::make_shared<Mesh>(*_mesh);
-    // Material and shader clones are automatically copy-constructed by the following call
-    return new MeshComponent(newParent, clonedMesh, _material, _shader);
+    // Meshes are shared with the clone rather than copied: a copy would share
+    // the GPU buffers anyway, and copying through the base class would slice
+    // derived meshes (a DynamicMesh would lose track of its buffer regions).
+    // Material and shader handles are shared as well.
+    MeshComponent* clone = new MeshComponent(newParent, _lodLevels[0].mesh, _material, _shader);
+
+    for (auto it = _lodLevels.cbegin() + 1; it != _lodLevels.cend(); it++)
+    {
+        clone->addLodLevel(it->mesh, it->error);
+    }
+    clone->setLodErrorThreshold(_lodErrorThreshold);
+
+    return clone;
 }
 
 template<>
@@ -2,10 +2,13 @@
 #define RENDERBOI__TOOLBOX__SCENE__COMPONENTS__MESH_COMPONENT_HPP
 
 #include <string>
+#include <vector>
 
 #include <renderboi/core/mesh.hpp>
 #include <renderboi/core/material.hpp>
+#include <renderboi/core/material_registry.hpp>
 #include <renderboi/core/shader/shader_program.hpp>
+#include <renderboi/core/shader/shader_program_registry.hpp>
 
 #include "../component.hpp"
 #include "../component_type.hpp"
@@ -16,18 +19,41 @@ namespace Renderboi
 /// @brief Component allowing to attach a mesh to a scene object.
 class MeshComponent : public Component
 {
+    public:
+        /// @brief Default largest on-screen error (in pixels) tolerated when
+        /// selecting which level of detail to render.
+        static constexpr float DefaultLodErrorThreshold = 1.f;
+
+        /// @brief Struct packing together a level of detail of the mesh and 
+        /// the error it introduces relative to the full resolution mesh.
+        struct LodLevel
+        {
+            /// @brief Pointer to the mesh data of the level.
+            MeshPtr mesh;
+
+            /// @brief Largest distance (in object space units) between the
+            /// surface of this level and that of the full resolution mesh.
+            float error;
+        };
+
     private:
         MeshComponent(MeshComponent& other) = delete;
         MeshComponent& operator=(const MeshComponent& other) = delete;
 
-        /// @brief Pointer to the mesh data of the object.
-        MeshPtr _mesh;
+        /// @brief Levels of detail of the mesh, ordered from finest to 
+        /// coarsest. The first one is the full resolution mesh and always
+        /// exists.
+        std::vector<LodLevel> _lodLevels;
+
+        /// @brief Largest on-screen error (in pixels) tolerated when 
+        /// selecting which level of detail to render.
+        float _lodErrorThreshold;
 
-        /// @brief Material to paint the mesh with.
-        Material _material;
+        /// @brief Handle to the material to paint the mesh with.
+        MaterialHandle _material;
         
-        /// @brief Shader program to render the mesh with.
-        ShaderProgram _shader;
+        /// @brief Handle to the shader program to render the mesh with.
+        ShaderProgramHandle _shader;
 
     public:
         /// @param sceneObject Pointer to the scene object which will be parent
@@ -41,11 +67,12 @@ class MeshComponent : public Component
         /// @param sceneObject Pointer to the scene object which will be parent
         /// to this component.
         /// @param mesh Pointer to the mesh which the component should use.
-        /// @param material Material which the mesh should be rendered with.
+        /// @param material Handle to a registered material which the mesh
+        /// should be rendered with.
         ///
         /// @exception If the provided mesh pointer is null, the constructor
         /// will throw a std::runtime_error.
-        MeshComponent(const SceneObjectPtr sceneObject, const MeshPtr mesh, const Material material);
+        MeshComponent(const SceneObjectPtr sceneObject, const MeshPtr mesh, const MaterialHandle material);
 
         /// @param sceneObject Pointer to the scene object which will be parent
         /// to this component.
@@ -59,21 +86,36 @@ class MeshComponent : public Component
         /// @param sceneObject Pointer to the scene object which will be parent
         /// to this component.
         /// @param mesh Pointer to the mesh which the component should use.
-        /// @param material Material which the mesh should be rendered with.
+        /// @param material Handle to a registered material which the mesh
+        /// should be rendered with.
         /// @param shader Shader program which the mesh should be rendred by.
         ///
         /// @exception If the provided mesh pointer is null, the constructor
         /// will throw a std::runtime_error.
-        MeshComponent(const SceneObjectPtr sceneObject, const MeshPtr mesh, const Material material, const ShaderProgram shader);
+        MeshComponent(const SceneObjectPtr sceneObject, const MeshPtr mesh, const MaterialHandle material, const ShaderProgram shader);
+
+        /// @param sceneObject Pointer to the scene object which will be parent
+        /// to this component.
+        /// @param mesh Pointer to the mesh which the component should use.
+        /// @param material Handle to a registered material which the mesh 
+        /// should be rendered with.
+        /// @param shader Handle to a registered shader program which the mesh
+        /// should be rendred by.
+        ///
+        /// @exception If the provided mesh pointer is null, the constructor
+        /// will throw a std::runtime_error.
+        MeshComponent(const SceneObjectPtr sceneObject, const MeshPtr mesh, const MaterialHandle material, const ShaderProgramHandle shader);
 
         ~MeshComponent();
 
-        /// @brief Get a pointer to the mesh used by the component.
+        /// @brief Get a pointer to the full resolution mesh used by the 
+        /// component.
         ///
         /// @return A pointer to the mesh used by the component.
         MeshPtr getMesh() const;
 
-        /// @brief Set the mesh used by the component.
+        /// @brief Set the full resolution mesh used by the component. Any 
+        /// coarser level of detail previously added is discarded.
         ///
         /// @param mesh The new mesh to be used by the component.
         ///
@@ -81,26 +123,95 @@ class MeshComponent : public Component
         /// throw a std::runtime_error.
         void setMesh(const MeshPtr mesh);
 
+        /// @brief Append a coarser level of detail to the mesh used by the 
+        /// component. The mesh of the new level is made evictable from the
+        /// GPU when over the memory budget.
+        ///
+        /// @param mesh Pointer to the mesh data of the new level.
+        /// @param error Largest distance (in object space units) between the
+        /// surface of the new level and that of the full resolution mesh.
+        ///
+        /// @exception If the provided mesh pointer is null, or if the provided
+        /// error is lower than that of the current coarsest level, the 
+        /// function will throw a std::runtime_error.
+        void addLodLevel(const MeshPtr mesh, const float error);
+
+        /// @brief Get how many levels of detail the component holds, the full
+        /// resolution mesh included.
+        ///
+        /// @return How many levels of detail the component holds.
+        unsigned int getLodLevelCount() const;
+
+        /// @brief Get a level of detail of the mesh used by the component.
+        ///
+        /// @param level Index of the level to get, 0 being the full 
+        /// resolution mesh.
+        ///
+        /// @return The requested level of detail.
+        ///
+        /// @exception If the provided index is out of bounds, the function 
+        /// will throw a std::runtime_error.
+        LodLevel getLodLevel(const unsigned int level) const;
+
+        /// @brief Get the largest on-screen error (in pixels) tolerated when
+        /// selecting which level of detail to render.
+        ///
+        /// @return The error threshold of the component.
+        float getLodErrorThreshold() const;
+
+        /// @brief Set the largest on-screen error (in pixels) tolerated when
+        /// selecting which level of detail to render.
+        ///
+        /// @param threshold The new error threshold of the component.
+        void setLodErrorThreshold(const float threshold);
+
+        /// @brief Get the coarsest level of detail whose projected error stays
+        /// under the error threshold of the component.
+        ///
+        /// @param pixelsPerUnit How many pixels an object space unit spans on
+        /// screen at the location of the object.
+        ///
+        /// @return A reference to the pointer to the mesh data of the 
+        /// selected level.
+        const MeshPtr& selectLodMesh(const float pixelsPerUnit) const;
+
         /// @brief Get the material used by the component.
         ///
-        /// @return The material used by the component.
-        Material getMaterial() const;
+        /// @return A const reference to the material used by the component.
+        const Material& getMaterial() const;
+
+        /// @brief Get a handle to the material used by the component.
+        ///
+        /// @return A handle to the material used by the component.
+        MaterialHandle getMaterialHandle() const;
 
         /// @brief Set the material used by the component.
         ///
-        /// @param material The new material to be used by the component.
-        void setMaterial(const Material material);
+        /// @param material Handle to the registered material to be used by
+        /// the component.
+        void setMaterial(const MaterialHandle material);
 
         /// @brief Get the shader used by the component.
         ///
-        /// @return The shader used by the component.
-        ShaderProgram getShader() const;
+        /// @return A const reference to the shader used by the component.
+        const ShaderProgram& getShader() const;
+
+        /// @brief Get a handle to the shader used by the component.
+        ///
+        /// @return A handle to the shader used by the component.
+        ShaderProgramHandle getShaderHandle() const;
 
         /// @brief Set the shader used by the component.
         ///
         /// @param shader The new shader to be used by the component.
         void setShader(const ShaderProgram shader);
 
+        /// @brief Set the shader used by the component.
+        ///
+        /// @param shader Handle to the registered shader to be used by the
+        /// component.
+        void setShader(const ShaderProgramHandle shader);
+
         /////////////////////////////////////////
         ///                                   ///
         /// Methods overridden from Component ///
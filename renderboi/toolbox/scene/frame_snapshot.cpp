@@ -0,0 +1,16 @@
+#include "frame_snapshot.hpp"
+
+namespace Renderboi
+{
+
+void FrameSnapshot::clear()
+{
+    hasCamera = false;
+    meshes.clear();
+    lodLevels.clear();
+    pointLights.clear();
+    spotLights.clear();
+    directionalLights.clear();
+}
+
+}//namespace Renderboi
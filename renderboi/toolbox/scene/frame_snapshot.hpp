@@ -0,0 +1,110 @@
+#ifndef RENDERBOI__TOOLBOX__SCENE__FRAME_SNAPSHOT_HPP
+#define RENDERBOI__TOOLBOX__SCENE__FRAME_SNAPSHOT_HPP
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <renderboi/core/material_registry.hpp>
+#include <renderboi/core/mesh.hpp>
+#include <renderboi/core/transform.hpp>
+#include <renderboi/core/lights/directional_light.hpp>
+#include <renderboi/core/lights/point_light.hpp>
+#include <renderboi/core/lights/spot_light.hpp>
+#include <renderboi/core/shader/shader_program_registry.hpp>
+
+namespace Renderboi
+{
+
+/// @brief Self-contained copy of everything needed to render a frame of a
+/// scene: camera matrices, light data and the list of meshes to draw,
+/// along with their world transforms. Rendering a snapshot does not touch
+/// the scene it was captured from, which may thus be updated concurrently
+/// (see SceneRenderer::captureSnapshot() and FramePipeline).
+///
+/// @note Snapshots are meant to be reused from one frame to the next, so
+/// that their storage is only allocated once.
+struct FrameSnapshot
+{
+    /// @brief Level of detail of a mesh to draw.
+    struct LodLevel
+    {
+        /// @brief Pointer to the mesh data of the level.
+        MeshPtr mesh;
+
+        /// @brief Largest distance (in object space units) between the
+        /// surface of this level and that of the full resolution mesh.
+        float error;
+    };
+
+    /// @brief Mesh to draw and how to draw it.
+    struct MeshEntry
+    {
+        /// @brief World transform to draw the mesh with.
+        Transform worldTransform;
+
+        /// @brief Index of the first level of detail of the mesh in the
+        /// snapshot LOD levels. It is the full resolution mesh.
+        std::size_t firstLodLevel;
+
+        /// @brief How many levels of detail the mesh has, ordered from
+        /// finest to coarsest.
+        std::size_t lodLevelCount;
+
+        /// @brief Largest on-screen error (in pixels) tolerated when
+        /// selecting which level of detail to draw.
+        float lodErrorThreshold;
+
+        /// @brief Handle to the shader program to draw the mesh with.
+        ShaderProgramHandle shader;
+
+        /// @brief Handle to the material to draw the mesh with.
+        MaterialHandle material;
+    };
+
+    /// @brief Copy of a light, along with its position.
+    ///
+    /// @tparam T Type of the concrete light.
+    template<typename T>
+    struct LightEntry
+    {
+        /// @brief Copy of the light.
+        T light;
+
+        /// @brief Position of the light in world space.
+        glm::vec3 worldPosition;
+    };
+
+    /// @brief Whether the scene had a camera to render it with.
+    bool hasCamera = false;
+
+    /// @brief View matrix of the scene camera.
+    glm::mat4 view = glm::mat4(1.f);
+
+    /// @brief Projection matrix of the scene camera.
+    glm::mat4 projection = glm::mat4(1.f);
+
+    /// @brief Meshes to draw.
+    std::vector<MeshEntry> meshes;
+
+    /// @brief Levels of detail of all meshes to draw, stored contiguously.
+    std::vector<LodLevel> lodLevels;
+
+    /// @brief Point lights of the scene.
+    std::vector<LightEntry<PointLight>> pointLights;
+
+    /// @brief Spot lights of the scene.
+    std::vector<LightEntry<SpotLight>> spotLights;
+
+    /// @brief Directional lights of the scene.
+    std::vector<LightEntry<DirectionalLight>> directionalLights;
+
+    /// @brief Empty the snapshot, keeping its storage around.
+    void clear();
+};
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__TOOLBOX__SCENE__FRAME_SNAPSHOT_HPP
@@ -4,11 +4,14 @@
 #include <chrono>
 #include <functional>
 #include <memory>
+#include <typeindex>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <glm/glm.hpp>
 
+#include <renderboi/utilities/profiler.hpp>
 #include <renderboi/utilities/to_string.hpp>
 
 #include <cpptools/container/tree.hpp>
@@ -31,7 +34,13 @@ Scene::Scene() :
     _outdatedTransformNodes(0),
     _objectMetadata(),
     _scripts(),
-    _lastTime(std::chrono::system_clock::now())
+    _scriptBatches(),
+    _exclusiveScripts(),
+    _scriptScheduleOutdated(false),
+    _lastTime(std::chrono::steady_clock::now()),
+    _previousWorldTransforms(),
+    _saveCount(0),
+    _jobSystem(nullptr)
 {
     
 }
@@ -129,7 +138,7 @@ void Scene::moveObject(const unsigned int id, const unsigned int newParentId, co
 {
     // Retrieve IDs of both nodes in all graphs
     const SceneObjectMetadata meta = _findObjectMetaOrThrow(id, "cannot move this object");
-    const SceneObjectMetadata parentMeta = _findObjectMetaOrThrow(id, "cannot move to this object");
+    const SceneObjectMetadata parentMeta = _findObjectMetaOrThrow(newParentId, "cannot move to this object");
 
     // Fetch the world transform of moved object, updating if necessary
     const Transform worldTransform = getWorldTransform(id);
@@ -138,6 +147,7 @@ void Scene::moveObject(const unsigned int id, const unsigned int newParentId, co
     _objects.moveBranch(meta.objectNodeId, parentMeta.objectNodeId);
     _transforms.moveBranch(meta.transformNodeId, parentMeta.transformNodeId);
     _updateMarkers.moveBranch(meta.updateNodeId, parentMeta.updateNodeId);
+    _objectMetadata[id].parentId = newParentId;
 
     if (worldPositionStays)
     {
@@ -166,16 +176,32 @@ SceneObjectPtr Scene::getParent(const unsigned int id) const
 
 void Scene::updateAllTransforms()
 {
+    RB_PROFILE_ZONE("Scene::updateAllTransforms");
+
     if (_outdatedTransformNodes)
     {
         const ObjectTree::NodePtr objectRootNode = _objects.getRoot();
         const std::vector<ObjectTree::NodePtr> childNodes = objectRootNode->getChildren();
 
-        // Start the DFS routine on each of the root children
-        for(auto it = childNodes.begin(); it != childNodes.end(); it++)
+        // Start the DFS routine on each of the root children, branches 
+        // being independent from one another
+        if (_jobSystem && childNodes.size() > 1)
         {
-            SceneObjectPtr object = (*it)->value;
-            _worldTransformDFSUpdate(object->id);
+            _jobSystem->parallelFor(childNodes.size(), 1, [this, &childNodes](const std::size_t begin, const std::size_t end)
+            {
+                for (std::size_t i = begin; i < end; i++)
+                {
+                    _worldTransformDFSUpdate(childNodes[i]->value->id);
+                }
+            });
+        }
+        else
+        {
+            for(auto it = childNodes.begin(); it != childNodes.end(); it++)
+            {
+                SceneObjectPtr object = (*it)->value;
+                _worldTransformDFSUpdate(object->id);
+            }
         }
 
         _outdatedTransformNodes = 0;
@@ -256,26 +282,177 @@ void Scene::registerScript(const ScriptPtr script)
     }
 
     _scripts[script->id] = script;
+    _scriptScheduleOutdated = true;
 }
 
 void Scene::detachScript(const unsigned int id)
 {
     _scripts.erase(id);
+    _scriptScheduleOutdated = true;
 }
 
 void Scene::triggerUpdate()
 {
+    RB_PROFILE_ZONE("Scene::triggerUpdate");
+
     // Get time delta (in seconds) and upate last update time
-    const std::chrono::time_point<std::chrono::system_clock> now = std::chrono::system_clock::now();
+    const std::chrono::time_point<std::chrono::steady_clock> now = std::chrono::steady_clock::now();
     const std::chrono::duration<double> delta = now - _lastTime;
     _lastTime = now;
 
-    // Update all registered scripts
+    _updateScripts((float)(delta.count()));
+}
+
+void Scene::triggerUpdate(const float timeElapsed)
+{
+    RB_PROFILE_ZONE("Scene::triggerUpdate");
+
+    _lastTime = std::chrono::steady_clock::now();
+
+    _saveWorldTransforms();
+    _updateScripts(timeElapsed);
+}
+
+Transform Scene::getInterpolatedWorldTransform(const unsigned int id, const float factor) const
+{
+    const Transform current = getWorldTransform(id);
+    if (factor >= 1.f) return current;
+
+    // Objects registered since the last save have no previous state, and
+    // objects whose transform was not captured since then did not move
+    const SceneObjectMetadata meta = _findObjectMetaOrThrow(id, "cannot retrieve interpolated world transform of this object");
+    const PreviousWorldTransform& previous = _previousWorldTransforms[meta.transformNodeId];
+    if (previous.registrationSaveIndex == _saveCount || previous.saveIndex != _saveCount) return current;
+
+    return previous.transform.interpolateTowards(current, factor);
+}
+
+void Scene::setJobSystem(const JobSystemPtr jobSystem)
+{
+    _jobSystem = jobSystem;
+}
+
+JobSystemPtr Scene::getJobSystem() const
+{
+    return _jobSystem;
+}
+
+void Scene::_scheduleScripts()
+{
+    _scriptBatches.clear();
+    _exclusiveScripts.clear();
+
+    // Data read and written by the scripts of each batch
+    std::vector<std::unordered_set<const void*>> batchReads;
+    std::vector<std::unordered_set<const void*>> batchWrites;
+
     for (const auto& [_, script] : _scripts)
     {
-        script->update((float)(delta.count()));
+        const Script::DataAccess access = script->getDataAccess();
+        if (access.exclusive)
+        {
+            _exclusiveScripts.push_back(script);
+            continue;
+        }
+
+        // Find the first batch in which no other script writes data that
+        // this script accesses, or accesses data that this script writes
+        std::size_t batch = 0;
+        for (; batch < _scriptBatches.size(); batch++)
+        {
+            const auto conflicts = [&](const void* data)
+            {
+                return batchWrites[batch].contains(data) || batchReads[batch].contains(data);
+            };
+
+            const bool writeConflict = std::any_of(access.writes.begin(), access.writes.end(), conflicts);
+            const bool readConflict = std::any_of(access.reads.begin(), access.reads.end(), [&](const void* data)
+            {
+                return batchWrites[batch].contains(data);
+            });
+
+            if (!writeConflict && !readConflict) break;
+        }
+
+        if (batch == _scriptBatches.size())
+        {
+            _scriptBatches.emplace_back();
+            batchReads.emplace_back();
+            batchWrites.emplace_back();
+        }
+
+        _scriptBatches[batch].push_back(script);
+        batchReads[batch].insert(access.reads.begin(), access.reads.end());
+        batchWrites[batch].insert(access.writes.begin(), access.writes.end());
+    }
+
+    // Group scripts of the same type together, so that consecutive updates
+    // run the same code
+    for (auto& batch : _scriptBatches)
+    {
+        std::sort(batch.begin(), batch.end(), [](const ScriptPtr& left, const ScriptPtr& right)
+        {
+            const std::type_index leftType = typeid(*left);
+            const std::type_index rightType = typeid(*right);
+            return (leftType == rightType) ? (left->id < right->id) : (leftType < rightType);
+        });
     }
+
+    std::sort(_exclusiveScripts.begin(), _exclusiveScripts.end(), [](const ScriptPtr& left, const ScriptPtr& right)
+    {
+        return left->id < right->id;
+    });
+
+    _scriptScheduleOutdated = false;
 }
+
+void Scene::_updateScripts(const float timeElapsed)
+{
+    if (_scriptScheduleOutdated)
+    {
+        _scheduleScripts();
+    }
+
+    // Update non-exclusive scripts batch after batch, in parallel within a
+    // batch if possible...
+    for (const auto& batch : _scriptBatches)
+    {
+        const auto updateRange = [&batch, timeElapsed](const std::size_t begin, const std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; i++)
+            {
+                batch[i]->update(timeElapsed);
+            }
+        };
+
+        if (_jobSystem)
+        {
+            _jobSystem->parallelFor(batch.size(), ScriptBatchSize, updateRange);
+        }
+        else
+        {
+            updateRange(0, batch.size());
+        }
+    }
+
+    // ...then exclusive scripts on this thread
+    for (const auto& script : _exclusiveScripts)
+    {
+        script->update(timeElapsed);
+    }
+}
+
+void Scene::_saveWorldTransforms()
+{
+    // Pending updates must be applied before the save so that they are not
+    // captured as the previous state
+    updateAllTransforms();
+
+    // Invalidate all captured transforms at once: world transforms will be
+    // captured again as they get updated
+    _saveCount++;
+}
+
 void Scene::_init()
 {
     const ObjectTree::NodePtr objectRootNode = _objects.getRoot();
@@ -296,6 +473,9 @@ void Scene::_init()
         _MaxUInt                     // ID of the subscription to the transform notifier of the object
     };
     _objectMetadata[meta.id] = meta;
+
+    _previousWorldTransforms.resize(transformRootNode->id + 1);
+    _previousWorldTransforms[transformRootNode->id] = {transformRootNode->value, _saveCount, _saveCount};
 }
 
 void Scene::_terminate()
@@ -315,6 +495,11 @@ void Scene::_terminate()
     // Clear metadata, scripts, inputProcessors
     _objectMetadata.clear();
     _scripts.clear();
+    _scriptBatches.clear();
+    _exclusiveScripts.clear();
+    _scriptScheduleOutdated = false;
+    _previousWorldTransforms.clear();
+    _saveCount = 0;
 }
 
 void Scene::_objectTransformModified(const unsigned int id)
@@ -407,6 +592,13 @@ void Scene::_performObjectRegistration(const SceneObjectPtr object, const SceneO
     };
     const unsigned int transformSubscriberId = object->transform.getNotifier().addSubscriber(callback);
 
+    // Make room for the previous world transform of the object
+    if (transformNodeId >= _previousWorldTransforms.size())
+    {
+        _previousWorldTransforms.resize(transformNodeId + 1);
+    }
+    _previousWorldTransforms[transformNodeId] = {newTransform, _saveCount, _saveCount};
+
     // Create metadata
     const SceneObjectMetadata meta = {
         object->id,             // ID of the object this metadata refers to
@@ -513,6 +705,16 @@ void Scene::_worldTransformUpdateNoCascade(const unsigned int id) const
     const TransformTree::NodePtr transformNode = _transforms[meta.transformNodeId];
     const TransformTree::NodePtr parentTransformNode = transformNode->getParent();
 
+    // Capture the world transform as it was when transforms were last saved,
+    // if not done yet. Each object has its own entry, so this is safe to do
+    // from concurrent branch updates.
+    PreviousWorldTransform& previous = _previousWorldTransforms[meta.transformNodeId];
+    if (previous.saveIndex != _saveCount)
+    {
+        previous.transform = transformNode->value;
+        previous.saveIndex = _saveCount;
+    }
+
     if (parentTransformNode != nullptr)
     {
         // Apply the parent world transform to the object transform, and save it to the object world transform node
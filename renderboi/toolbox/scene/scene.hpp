@@ -2,6 +2,7 @@
 #define RENDERBOI__TOOLBOX__SCENE__SCENE_HPP
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <limits>
@@ -14,6 +15,8 @@
 
 #include <cpptools/container/tree.hpp>
 
+#include <renderboi/utilities/job_system.hpp>
+
 #include "../script.hpp"
 #include "scene_object.hpp"
 #include "scene_object_metadata.hpp"
@@ -35,7 +38,26 @@ public:
     using TransformTree = cpptools::Tree<Transform>;
     using BoolTree = cpptools::Tree<bool>;
 
+    /// @brief Maximum amount of non-exclusive scripts updated by a single
+    /// job.
+    static constexpr unsigned int ScriptBatchSize = 64;
+
 private:
+    /// @brief World transform an object had when world transforms were last
+    /// saved, captured lazily the first time it changes afterwards.
+    struct PreviousWorldTransform
+    {
+        /// @brief The world transform the object had when world transforms
+        /// were last saved. Only meaningful if captured since then.
+        Transform transform;
+
+        /// @brief Value of the save counter when the transform was captured.
+        unsigned int saveIndex;
+
+        /// @brief Value of the save counter when the object was registered.
+        unsigned int registrationSaveIndex;
+    };
+
     /// @brief Scene graph. Contains all objects in the scene, 
     /// hierarchically organised in a tree.
     ObjectTree _objects;
@@ -49,7 +71,7 @@ private:
     BoolTree _updateMarkers;
 
     /// @brief Tells whether all transforms in the scene are up to date.
-    mutable unsigned int _outdatedTransformNodes;
+    mutable std::atomic<unsigned int> _outdatedTransformNodes;
 
     /// @brief Map scene object IDs to object metadata structs.
     std::unordered_map<unsigned int, SceneObjectMetadata> _objectMetadata;
@@ -57,13 +79,53 @@ private:
     /// @brief Map script IDs to script pointers.
     std::unordered_map<unsigned int, ScriptPtr> _scripts;
 
+    /// @brief Non-exclusive scripts, split in batches of scripts whose data
+    /// accesses do not conflict with one another (see Script::DataAccess).
+    /// Within a batch, scripts are grouped by concrete type.
+    std::vector<std::vector<ScriptPtr>> _scriptBatches;
+
+    /// @brief Scripts which must be updated one at a time, ordered by ID.
+    std::vector<ScriptPtr> _exclusiveScripts;
+
+    /// @brief Whether scripts were registered or detached since the script
+    /// batches were last worked out.
+    bool _scriptScheduleOutdated;
+
     /// @brief Last time a scene update was triggered.
-    std::chrono::time_point<std::chrono::system_clock> _lastTime;
+    std::chrono::time_point<std::chrono::steady_clock> _lastTime;
+
+    /// @brief World transforms which objects had before the last 
+    /// fixed-timestep update, indexed by the ID of their node in the 
+    /// transform tree.
+    mutable std::vector<PreviousWorldTransform> _previousWorldTransforms;
+
+    /// @brief How many times world transforms were saved.
+    unsigned int _saveCount;
+
+    /// @brief Job system used to spread scene work over several threads.
+    /// If null, all work is done on the calling thread.
+    JobSystemPtr _jobSystem;
 
     /// @brief Initialize the root of object tree in the scene, as well as
     /// the first scene object metadata entry.
     void _init();
 
+    /// @brief Split registered scripts in batches of scripts which can be
+    /// updated concurrently, from their declared data accesses.
+    void _scheduleScripts();
+
+    /// @brief Send an update signal to all registered scripts.
+    ///
+    /// @param timeElapsed How much time passed (in seconds) since the last
+    /// update.
+    void _updateScripts(const float timeElapsed);
+
+    /// @brief Save the current world transforms of all objects so that 
+    /// they can be interpolated with later on. Transforms are not copied
+    /// right away: the one of an object is captured when it is first
+    /// updated afterwards, so that objects which do not move cost nothing.
+    void _saveWorldTransforms();
+
     /// @brief Prepares the scene for destruction, by releasing strong 
     /// references in its scene objects, and delting the contents of all
     /// trees.
@@ -283,7 +345,9 @@ public:
     /// present in the scene, the function will throw a std::runtime_error.
     SceneObjectPtr getParent(const unsigned int id) const;
     
-    /// @brief Update all world transforms of objects marked for update.
+    /// @brief Update all world transforms of objects marked for update. If
+    /// a job system was provided, the branches below the scene root are
+    /// updated in parallel.
     void updateAllTransforms();
 
     /// @brief Get the world transform of the object with provided ID.
@@ -321,10 +385,52 @@ public:
     /// @param id ID of the script to detach from the scene.
     void detachScript(const unsigned int id);
 
+    /// @brief Set the job system used to spread scene work over several 
+    /// threads.
+    ///
+    /// @param jobSystem Pointer to the job system to use. Pass nullptr to
+    /// do all work on the calling thread.
+    void setJobSystem(const JobSystemPtr jobSystem);
+
+    /// @brief Get the job system used to spread scene work over several
+    /// threads.
+    ///
+    /// @return A pointer to the job system, or nullptr if none was set.
+    JobSystemPtr getJobSystem() const;
+
     /// @brief Trigger a scene update, which will send an update signal to 
-    /// all registered scripts.
+    /// all registered scripts. If a job system was provided, scripts whose
+    /// declared data accesses do not conflict are updated in parallel, 
+    /// before exclusive scripts are updated on the calling thread.
     void triggerUpdate();
 
+    /// @brief Trigger a scene update of fixed duration, which will send an
+    /// update signal to all registered scripts. World transforms are saved
+    /// beforehand, so that rendering can interpolate between the states of
+    /// the scene before and after the update (see 
+    /// getInterpolatedWorldTransform()).
+    ///
+    /// @param timeElapsed How much time (in seconds) the update should
+    /// account for.
+    void triggerUpdate(const float timeElapsed);
+
+    /// @brief Get the world transform of the object with provided ID, 
+    /// interpolated between its state before and after the last 
+    /// fixed-duration update.
+    ///
+    /// @param id ID of the object whose world transform to get.
+    /// @param factor How far to interpolate towards the current world
+    /// transform of the object, 0 yielding the world transform it had 
+    /// before the last fixed-duration update.
+    ///
+    /// @return The interpolated world transform of the object, or its 
+    /// current world transform if it was not present in the scene before
+    /// the last fixed-duration update.
+    ///
+    /// @exception If the provided ID does not match that of an object 
+    /// present in the scene, the function will throw a std::runtime_error.
+    Transform getInterpolatedWorldTransform(const unsigned int id, const float factor) const;
+
     /// @brief Get pointers to all scene objects which have a certain 
     /// component.
     ///
@@ -1,19 +1,29 @@
 #include "scene_renderer.hpp"
 
-#include <chrono>
+#include <array>
+#include <cstdint>
 #include <iostream>
 #include <memory>
-#include <thread>
 #include <vector>
 
+#include <glad/gl.h>
+
+#include <renderboi/core/camera.hpp>
+#include <renderboi/core/gl_resource_registry.hpp>
+#include <renderboi/core/gpu_memory.hpp>
 #include <renderboi/core/lights/light.hpp>
 #include <renderboi/core/material.hpp>
+#include <renderboi/core/material_registry.hpp>
 #include <renderboi/core/mesh.hpp>
+#include <renderboi/core/render_stats.hpp>
 #include <renderboi/core/shader/shader_program.hpp>
+#include <renderboi/core/shader/shader_program_registry.hpp>
 #include <renderboi/core/transform.hpp>
 #include <renderboi/core/ubo/matrix_ubo.hpp>
 #include <renderboi/core/ubo/light_ubo.hpp>
 
+#include <renderboi/utilities/profiler.hpp>
+
 #include "scene.hpp"
 #include "scene_object.hpp"
 #include "component.hpp"
@@ -24,17 +34,71 @@
 namespace Renderboi
 {
 
-SceneRenderer::SceneRenderer(const unsigned int framerateLimit) :
+namespace
+{
+
+/// @brief Extract the planes of the frustum of a projection matrix, with
+/// normals pointing inward.
+std::array<glm::vec4, 6> extractFrustumPlanes(const glm::mat4& projection)
+{
+    const glm::mat4 rows = glm::transpose(projection);
+    std::array<glm::vec4, 6> planes = {
+        rows[3] + rows[0],  // Left
+        rows[3] - rows[0],  // Right
+        rows[3] + rows[1],  // Bottom
+        rows[3] - rows[1],  // Top
+        rows[3] + rows[2],  // Near
+        rows[3] - rows[2]   // Far
+    };
+
+    for (auto& plane : planes)
+    {
+        plane /= glm::length(glm::vec3(plane));
+    }
+
+    return planes;
+}
+
+/// @brief Tell whether a sphere intersects a frustum.
+bool sphereIntersectsFrustum(const std::array<glm::vec4, 6>& planes, const glm::vec3& center, const float radius)
+{
+    for (const auto& plane : planes)
+    {
+        if (glm::dot(glm::vec3(plane), center) + plane.w < -radius)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}//namespace
+
+SceneRenderer::SceneRenderer(const JobSystemPtr jobSystem) :
     _matrixUbo(),
     _lightUbo(),
-    _frameIntervalUs((int64_t)(1000000.f/framerateLimit)),
-    _lastTimestamp(std::chrono::system_clock::now())
+    _snapshot(),
+    _gpuProfiler(),
+    _jobSystem(jobSystem),
+    _drawCommands()
+{
+
+}
+
+void SceneRenderer::renderScene(const ScenePtr scene, const float interpolationFactor) const
 {
+    RB_PROFILE_ZONE("SceneRenderer::renderScene");
 
+    captureSnapshot(scene, _snapshot, interpolationFactor);
+    renderSnapshot(_snapshot);
 }
 
-void SceneRenderer::renderScene(const ScenePtr scene) const
+void SceneRenderer::captureSnapshot(const ScenePtr scene, FrameSnapshot& snapshot, const float interpolationFactor) const
 {
+    RB_PROFILE_ZONE("SceneRenderer::captureSnapshot");
+
+    snapshot.clear();
     scene->updateAllTransforms();
 
     // Get pointers to meshes, lights, and the scene camera
@@ -53,120 +117,200 @@ void SceneRenderer::renderScene(const ScenePtr scene) const
             "the first one will be used for rendering." << std::endl;
     }
 
-    // Get the actual camera
+    // Get the actual camera, placed where it lies in between the last two
+    // simulation steps
     const SceneObjectPtr cameraObj = cameraObjects[0];
     const std::shared_ptr<CameraComponent> cameraComp = cameraObj->getComponent<CameraComponent>();
+    const CameraPtr camera = cameraComp->getCamera();
+    camera->setParentTransform(scene->getInterpolatedWorldTransform(cameraObj->id, interpolationFactor));
 
-    // Set up matrices in their UBO
-    const glm::mat4 view = cameraComp->getViewMatrix();
-    const glm::mat4 projection = cameraComp->getProjectionMatrix();
-    _matrixUbo.setView(view);
-    _matrixUbo.setProjection(projection);
-
-    // Preprocess lights
-    std::vector<LightPtr> lights;
-    std::vector<Transform> worldTransforms;
+    snapshot.hasCamera = true;
+    snapshot.view = camera->getViewMatrix();
+    snapshot.projection = cameraComp->getProjectionMatrix();
+
+    // Copy lights, so that they can be rendered while the originals change
     for (const auto& lightObj : lightObjects)
     {
-        std::shared_ptr<LightComponent> lightComp = lightObj->getComponent<LightComponent>();
-        // Get the actual light and its world model matrix (needed to compute its world position)
-        lights.push_back(lightComp->getLight());
-        worldTransforms.push_back(scene->getWorldTransform(lightObj->id));
-    }
-    _sendLightData(lights, worldTransforms, view);
+        const LightPtr light = lightObj->getComponent<LightComponent>()->getLight();
+        const glm::vec3 position = scene->getInterpolatedWorldTransform(lightObj->id, interpolationFactor).getPosition();
 
-    // Compute time elapsed between frames and limit framerate if necessary
-    const std::chrono::time_point<std::chrono::system_clock> newTimestamp = std::chrono::system_clock::now();
-    const std::chrono::duration<double> duration = newTimestamp - _lastTimestamp;
-    _lastTimestamp = newTimestamp;
-    const int64_t gap = _frameIntervalUs - std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
-    std::this_thread::sleep_for(std::chrono::microseconds(gap));
+        switch (light->lightType)
+        {
+            case LightType::PointLight:
+                snapshot.pointLights.push_back({*std::static_pointer_cast<PointLight>(light), position});
+                break;
+            case LightType::SpotLight:
+                snapshot.spotLights.push_back({*std::static_pointer_cast<SpotLight>(light), position});
+                break;
+            case LightType::DirectionalLight:
+                snapshot.directionalLights.push_back({*std::static_pointer_cast<DirectionalLight>(light), position});
+                break;
+        }
+    }
 
+    // Record meshes along with all their levels of detail, selection 
+    // depending on the viewport which is only known at render time
+    snapshot.meshes.reserve(meshObjects.size());
     for (const auto& meshObj : meshObjects)
     {
-        // Draw the mesh
-        drawMesh(meshObj, cameraComp->getViewMatrix());
+        const std::shared_ptr<MeshComponent> meshComp = meshObj->getComponent<MeshComponent>();
+        const unsigned int lodLevelCount = meshComp->getLodLevelCount();
+
+        snapshot.meshes.push_back({
+            scene->getInterpolatedWorldTransform(meshObj->id, interpolationFactor),
+            snapshot.lodLevels.size(),
+            lodLevelCount,
+            meshComp->getLodErrorThreshold(),
+            meshComp->getShaderHandle(),
+            meshComp->getMaterialHandle()
+        });
+
+        for (unsigned int i = 0; i < lodLevelCount; i++)
+        {
+            const MeshComponent::LodLevel level = meshComp->getLodLevel(i);
+            snapshot.lodLevels.push_back({level.mesh, level.error});
+        }
     }
 }
 
-void SceneRenderer::setFramerateLimit(const unsigned int framerateLimit)
+void SceneRenderer::renderSnapshot(const FrameSnapshot& snapshot) const
 {
-    _frameIntervalUs = (int64_t)(1000000.f / framerateLimit);
-}
+    RB_PROFILE_ZONE("SceneRenderer::renderSnapshot");
 
-void SceneRenderer::_sendLightData(
-    const std::vector<LightPtr>& lights,
-    const std::vector<Transform>& worldTransforms,
-    const glm::mat4& view
-) const
-{
-    // Light counts need to be kept track of
-    unsigned int pLightIndex = 0;
-    unsigned int sLightIndex = 0;
-    unsigned int dLightIndex = 0;
+    // Read back GPU timings of previous frames which are available by now
+    _gpuProfiler.collect();
+
+    // Free GPU resources which were released since the last frame, possibly
+    // from other threads
+    GLResourceRegistry::ProcessPendingDeletions();
+    // Evict resources left unused if over the GPU memory budget
+    GPUMemory::EnforceBudget();
+
+    if (!snapshot.hasCamera) return;
+
+    // Set up matrices in their UBO
+    _matrixUbo.setView(snapshot.view);
+    _matrixUbo.setProjection(snapshot.projection);
+
+    _sendLightData(snapshot);
+
+    // Scale factor to project object space errors on screen, used for LOD 
+    // selection: for a perspective projection, the vertical focal length
+    // times half the viewport height
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    const float lodScale = snapshot.projection[1][1] * (float)viewport[3] * 0.5f;
 
-    for (unsigned int i = 0; i < lights.size(); i++)
+    const std::array<glm::vec4, 6> frustumPlanes = extractFrustumPlanes(snapshot.projection);
+
+    // Work out matrices, culling and levels of detail away from the GL
+    // context, possibly in parallel
+    _drawCommands.resize(snapshot.meshes.size());
+    const auto buildCommands = [&](const std::size_t begin, const std::size_t end)
     {
-        LightPtr light = lights[i];
-        glm::vec3 position = glm::vec3(view * glm::vec4(worldTransforms[i].getPosition(), 1.f));
+        for (std::size_t i = begin; i < end; i++)
+        {
+            _BuildDrawCommand(_drawCommands[i], snapshot, snapshot.meshes[i], frustumPlanes, lodScale);
+        }
+    };
 
-        switch (light->lightType)
+    if (_jobSystem)
+    {
+        _jobSystem->parallelFor(snapshot.meshes.size(), DrawCommandBatchSize, buildCommands);
+    }
+    else
+    {
+        buildCommands(0, snapshot.meshes.size());
+    }
+
+    // Then issue the draw calls, in order
+    RB_PROFILE_GPU_ZONE(_gpuProfiler, "SceneRenderer::renderSnapshot");
+    uint64_t drawnCount = 0;
+    uint64_t programSwitchCount = 0;
+    unsigned int lastShader = ~0u;
+    for (const auto& command : _drawCommands)
+    {
+        if (command.visible)
         {
-            case LightType::PointLight:
-                if (pLightIndex < LightUBO::PointLightMaxCount)
-                {
-                    // Retrieve the light as a PointLight
-                    std::shared_ptr<PointLight> pLight = std::static_pointer_cast<PointLight>(light);
-                    // Send it to the UBO
-                    _lightUbo.setPoint(pLightIndex++, *pLight, position);
-                }
-                else
-                {
-                    throw std::runtime_error("SceneRenderer: PointLight max count exceeded, cannot send more lights to UBO.");
-                }
-                
-                break;
-            case LightType::SpotLight:
-                if (sLightIndex < LightUBO::SpotLightMaxCount)
-                {
-                    // Retrieve the light as a SpotLight
-                    std::shared_ptr<SpotLight> sLight = std::static_pointer_cast<SpotLight>(light);
-                    // Send it to the UBO
-                    _lightUbo.setSpot(sLightIndex++, *sLight, position);
-                }
-                else
-                {
-                    throw std::runtime_error("SceneRenderer: SpotLight max count exceeded, cannot send more lights to UBO.");
-                }
-                
-                break;
-            case LightType::DirectionalLight:
-                if (dLightIndex < LightUBO::DirectionalLightMaxCount)
-                {
-                    // Retrieve the light as a DirectionalLight
-                    std::shared_ptr<DirectionalLight> dLight = std::static_pointer_cast<DirectionalLight>(light);
-                    // Send it to the UBO
-                    _lightUbo.setDirectional(dLightIndex++, *dLight);
-                }
-                else
-                {
-                    throw std::runtime_error("SceneRenderer: DirectionalLight max count exceeded, cannot send more lights to UBO.");
-                }
-                
-                break;
+            // Only switch programs when the shader changes from the last draw
+            const bool useProgram = command.shader.index != lastShader;
+            if (useProgram)
+            {
+                programSwitchCount++;
+                lastShader = command.shader.index;
+            }
+
+            _submitDrawCommand(command, useProgram);
+            drawnCount++;
         }
     }
 
+    RenderStats::Count(RenderCounter::DrawnObjects, drawnCount);
+    RenderStats::Count(RenderCounter::CulledObjects, _drawCommands.size() - drawnCount);
+    RenderStats::Count(RenderCounter::ProgramSwitches, programSwitchCount);
+}
+
+void SceneRenderer::_sendLightData(const FrameSnapshot& snapshot) const
+{
+    if (snapshot.pointLights.size() > LightUBO::PointLightMaxCount)
+    {
+        throw std::runtime_error("SceneRenderer: PointLight max count exceeded, cannot send more lights to UBO.");
+    }
+    if (snapshot.spotLights.size() > LightUBO::SpotLightMaxCount)
+    {
+        throw std::runtime_error("SceneRenderer: SpotLight max count exceeded, cannot send more lights to UBO.");
+    }
+    if (snapshot.directionalLights.size() > LightUBO::DirectionalLightMaxCount)
+    {
+        throw std::runtime_error("SceneRenderer: DirectionalLight max count exceeded, cannot send more lights to UBO.");
+    }
+
+    // Positions are sent in view space
+    for (unsigned int i = 0; i < snapshot.pointLights.size(); i++)
+    {
+        const auto& entry = snapshot.pointLights[i];
+        _lightUbo.setPoint(i, entry.light, glm::vec3(snapshot.view * glm::vec4(entry.worldPosition, 1.f)));
+    }
+    for (unsigned int i = 0; i < snapshot.spotLights.size(); i++)
+    {
+        const auto& entry = snapshot.spotLights[i];
+        _lightUbo.setSpot(i, entry.light, glm::vec3(snapshot.view * glm::vec4(entry.worldPosition, 1.f)));
+    }
+    for (unsigned int i = 0; i < snapshot.directionalLights.size(); i++)
+    {
+        _lightUbo.setDirectional(i, snapshot.directionalLights[i].light);
+    }
+
     // Set light counts
-    _lightUbo.setPointCount(pLightIndex);
-    _lightUbo.setSpotCount(sLightIndex);
-    _lightUbo.setDirectionalCount(dLightIndex);
+    _lightUbo.setPointCount((unsigned int)snapshot.pointLights.size());
+    _lightUbo.setSpotCount((unsigned int)snapshot.spotLights.size());
+    _lightUbo.setDirectionalCount((unsigned int)snapshot.directionalLights.size());
 }
 
-void SceneRenderer::drawMesh(const SceneObjectPtr meshObject, const glm::mat4& viewMatrix) const
+void SceneRenderer::_BuildDrawCommand(
+    DrawCommand& command,
+    const FrameSnapshot& snapshot,
+    const FrameSnapshot::MeshEntry& entry,
+    const std::array<glm::vec4, 6>& frustumPlanes,
+    const float lodScale
+)
 {
-    const Transform objectTransform = meshObject->getWorldTransform();
+    const FrameSnapshot::LodLevel* lodLevels = snapshot.lodLevels.data() + entry.firstLodLevel;
+    const MeshPtr& baseMesh = lodLevels[0].mesh;
+    const Transform& objectTransform = entry.worldTransform;
     const glm::mat4 modelMatrix = objectTransform.getModelMatrix();
+    const glm::mat4 modelViewMatrix = snapshot.view * modelMatrix;
+    const glm::vec3 scale = glm::abs(objectTransform.getScale());
+    const float maxScale = glm::max(scale.x, glm::max(scale.y, scale.z));
+
+    // Cull the mesh if its bounding sphere lies outside of the view frustum
+    const glm::vec3 center = glm::vec3(modelViewMatrix * glm::vec4(baseMesh->getBoundingSphereCenter(), 1.f));
+    command.visible = sphereIntersectsFrustum(frustumPlanes, center, baseMesh->getBoundingSphereRadius() * maxScale);
+    if (!command.visible)
+    {
+        command.mesh = nullptr;
+        return;
+    }
 
     // Detect non uniform scaling: compute the dot product of the world scale
     // of the object and a uniform scale along all three axes. If the dot 
@@ -175,31 +319,55 @@ void SceneRenderer::drawMesh(const SceneObjectPtr meshObject, const glm::mat4& v
     const float dot = glm::dot(scaling, glm::normalize(glm::vec3(1.f, 1.f, 1.f)));
 
     // Compute normal matrix
-    glm::mat4 normalMatrix = viewMatrix * modelMatrix;
+    glm::mat4 normalMatrix = modelViewMatrix;
     if (1.f - glm::abs(dot) > 1.e-6)
     {
         // Restore normals if a non-uniform scaling was detected
         normalMatrix = glm::transpose(glm::inverse(normalMatrix));
     }
 
+    command.modelMatrix = modelMatrix;
+    command.normalMatrix = normalMatrix;
+    command.shader = entry.shader;
+    command.material = entry.material;
+
+    // Pick the level of detail from how large an object space unit appears
+    // on screen at the distance of the object: walk from the coarsest level
+    // up, the first acceptable one wins
+    const float distance = glm::max(glm::length(glm::vec3(modelViewMatrix[3])), 1.e-3f);
+    const float pixelsPerUnit = lodScale * maxScale / distance;
+
+    command.mesh = baseMesh;
+    for (std::size_t i = entry.lodLevelCount; i-- > 1;)
+    {
+        if (lodLevels[i].error * pixelsPerUnit <= entry.lodErrorThreshold)
+        {
+            command.mesh = lodLevels[i].mesh;
+            break;
+        }
+    }
+}
+
+void SceneRenderer::_submitDrawCommand(const DrawCommand& command, const bool useProgram) const
+{
+    RB_PROFILE_ZONE("SceneRenderer::_submitDrawCommand");
+
     // Set up matrices in UBO
-    _matrixUbo.setModel(modelMatrix);
-    _matrixUbo.setNormal(normalMatrix);
-
-    const std::shared_ptr<MeshComponent> meshComponent = meshObject->getComponent<MeshComponent>();
-    
-    // Set up shader and material
-    const Material material = meshComponent->getMaterial();
-    ShaderProgram shader = meshComponent->getShader();
-    shader.use();
+    _matrixUbo.setModel(command.modelMatrix);
+    _matrixUbo.setNormal(command.normalMatrix);
+
+    // Set up shader and material, straight from their registries
+    const Material& material = MaterialRegistry::Get(command.material);
+    ShaderProgram& shader = ShaderProgramRegistry::Get(command.shader);
+    if (useProgram) shader.use();
     material.bindTextures();
 
     if (shader.supports(ShaderFeature::FragmentMeshMaterial))
     {
-        shader.setMaterial("material", material);
+        shader.setMaterial(ShaderProgramRegistry::GetMaterialUniformLocations(command.shader), material);
     }
 
-    meshComponent->getMesh()->draw();
+    command.mesh->draw();
 }
 
 }//namespace Renderboi
@@ -1,18 +1,25 @@
 #ifndef RENDERBOI__TOOLBOX__SCENE__SCENE_RENDERER_HPP
 #define RENDERBOI__TOOLBOX__SCENE__SCENE_RENDERER_HPP
 
-#include <cstdint>
-#include <chrono>
+#include <array>
 #include <memory>
 #include <vector>
 
+#include <glm/glm.hpp>
+
+#include <renderboi/core/gpu_profiler.hpp>
 #include <renderboi/core/lights/light.hpp>
 #include <renderboi/core/material.hpp>
+#include <renderboi/core/material_registry.hpp>
 #include <renderboi/core/mesh.hpp>
+#include <renderboi/core/shader/shader_program_registry.hpp>
 #include <renderboi/core/transform.hpp>
 #include <renderboi/core/ubo/matrix_ubo.hpp>
 #include <renderboi/core/ubo/light_ubo.hpp>
 
+#include <renderboi/utilities/job_system.hpp>
+
+#include "frame_snapshot.hpp"
 #include "scene.hpp"
 #include "scene_object.hpp"
 #include "component.hpp"
@@ -30,54 +37,124 @@ private:
     /// @brief Handle to a UBO for lights on the GPU.
     mutable LightUBO _lightUbo;
 
-    /// @brief Last recorded render timestamp. Used to limit the framerate.
-    mutable std::chrono::time_point<std::chrono::system_clock> _lastTimestamp;
+    /// @brief Snapshot used to render scenes directly (see renderScene()).
+    mutable FrameSnapshot _snapshot;
+
+    /// @brief Measures the GPU time spent rendering snapshots.
+    mutable GpuProfiler _gpuProfiler;
 
-    /// @brief Minimum time interval to keep between rendered frames.
-    int64_t _frameIntervalUs;
-    
-    /// @brief Send the scene lights to the GPU.
+    /// @brief Send the lights of a snapshot to the GPU.
     ///
-    /// @param lights An array filled with pointer to the lights in the 
-    /// scene.
-    /// @param worldTransforms An array filled with the world transforms of
-    /// the lights to send.
-    /// @param view The view matrix, provided by the scene camera.
+    /// @param snapshot Snapshot whose lights to send.
     ///
     /// @exception If there are too many lights of any type and they end up
     /// exceeding the per-type limit defined by the light UBO, the function
     /// will throw a std::runtime_error.
-    void _sendLightData(
-        const std::vector<LightPtr>& lights,
-        const std::vector<Transform>& worldTransforms,
-        const glm::mat4& view
-    ) const;
+    void _sendLightData(const FrameSnapshot& snapshot) const;
+
+    /// @brief Everything needed to draw a mesh, worked out ahead of
+    /// issuing any draw call.
+    struct DrawCommand
+    {
+        /// @brief Whether the mesh lies within the view frustum at all.
+        bool visible;
+
+        /// @brief Model matrix to draw the mesh with.
+        glm::mat4 modelMatrix;
+
+        /// @brief Normal matrix to draw the mesh with.
+        glm::mat4 normalMatrix;
+
+        /// @brief Mesh to draw, at the selected level of detail.
+        MeshPtr mesh;
+
+        /// @brief Handle to the shader program to draw the mesh with.
+        ShaderProgramHandle shader;
+
+        /// @brief Handle to the material to draw the mesh with.
+        MaterialHandle material;
+    };
 
-    /// @brief Issue draw commands for a single mesh.
+    /// @brief Job system to build draw commands with. If null, draw
+    /// commands are built on the rendering thread.
+    JobSystemPtr _jobSystem;
+
+    /// @brief Draw commands of the frame being rendered, kept around so
+    /// that their storage is reused from one frame to the next.
+    mutable std::vector<DrawCommand> _drawCommands;
+
+    /// @brief Work out the draw command for a single mesh. The level of
+    /// detail of the mesh is selected from the distance of the object to
+    /// the camera. Does not issue any GL call, and may thus run on any
+    /// thread.
     /// 
-    /// @param meshComponent A pointer to the object whose mesh is to render.
-    /// @param viewMatrix The view matrix, provided by the scene camera.
-    void drawMesh(const SceneObjectPtr meshComponent, const glm::mat4& viewMatrix) const;
+    /// @param command Draw command to fill in.
+    /// @param snapshot Snapshot the mesh to draw belongs to.
+    /// @param entry Entry of the mesh to draw in the snapshot.
+    /// @param frustumPlanes Planes of the view frustum, in view space.
+    /// @param lodScale How many pixels an object space unit spans on screen
+    /// when located at unit distance from the camera.
+    static void _BuildDrawCommand(
+        DrawCommand& command,
+        const FrameSnapshot& snapshot,
+        const FrameSnapshot::MeshEntry& entry,
+        const std::array<glm::vec4, 6>& frustumPlanes,
+        const float lodScale
+    );
+
+    /// @brief Issue the draw calls of a draw command. Must be called from
+    /// the thread owning the GL context.
+    ///
+    /// @param command Draw command to submit.
+    /// @param useProgram Whether to make the shader program of the command
+    /// current, false meaning it already is.
+    void _submitDrawCommand(const DrawCommand& command, const bool useProgram) const;
 
 public:
-    /// @param framerateLimit How many frames per second the SceneRenderer
-    /// should seek to render.
-    SceneRenderer(const unsigned int framerateLimit = 60);
+    /// @brief How many draw commands are built within a single job.
+    static constexpr unsigned int DrawCommandBatchSize = 128;
+
+    /// @param jobSystem Job system to build draw commands with, in
+    /// parallel. If null, draw commands are built on the rendering thread.
+    SceneRenderer(const JobSystemPtr jobSystem = nullptr);
 
-    /// @brief Render the provided scene.
+    /// @brief Render the provided scene, by capturing a snapshot of it and
+    /// rendering the snapshot right away. Meshes lying outside of the view
+    /// frustum are culled. Frame pacing is left to the caller (see 
+    /// FrameScheduler).
     ///
     /// @param scene A pointer to the scene which should be rendered.
+    /// @param interpolationFactor How far in between the last two 
+    /// fixed-duration updates of the scene the rendered frame lies (see
+    /// Scene::getInterpolatedWorldTransform()). 1 renders the current state
+    /// of the scene.
     ///
     /// @exception If the scene has too many lights of any type for the 
     /// light UBO to handle, the function will throw a std::runtime_error.
-    void renderScene(const ScenePtr scene) const;
+    void renderScene(const ScenePtr scene, const float interpolationFactor = 1.f) const;
 
-    /// @brief Set the framerate limit (in frames per second) of the 
-    /// renderer.
+    /// @brief Capture everything needed to render the current state of a
+    /// scene into a snapshot. Does not issue any GL call, and may thus be 
+    /// called from the thread updating the scene.
     ///
-    /// @param framerateLimit How many frames per second the SceneRenderer
-    /// should seek to render.
-    void setFramerateLimit(const unsigned int framerateLimit);
+    /// @param scene A pointer to the scene to capture.
+    /// @param snapshot Snapshot to capture the scene into. Its previous
+    /// content is discarded.
+    /// @param interpolationFactor How far in between the last two 
+    /// fixed-duration updates of the scene the captured state lies (see
+    /// Scene::getInterpolatedWorldTransform()). 1 captures the current 
+    /// state of the scene.
+    void captureSnapshot(const ScenePtr scene, FrameSnapshot& snapshot, const float interpolationFactor = 1.f) const;
+
+    /// @brief Render a snapshot of a scene. Meshes lying outside of the
+    /// view frustum are culled. Must be called from the thread owning the
+    /// GL context.
+    ///
+    /// @param snapshot Snapshot to render.
+    ///
+    /// @exception If the snapshot has too many lights of any type for the
+    /// light UBO to handle, the function will throw a std::runtime_error.
+    void renderSnapshot(const FrameSnapshot& snapshot) const;
 };
 
 using SceneRendererPtr = std::shared_ptr<SceneRenderer>;
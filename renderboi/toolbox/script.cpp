@@ -16,6 +16,11 @@ Script::~Script()
 
 }
 
+Script::DataAccess Script::getDataAccess() const
+{
+    return DataAccess();
+}
+
 SceneObjectPtr Script::getSceneObject() const
 {
     return _sceneObject;
@@ -2,6 +2,8 @@
 #define RENDERBOI__TOOLBOX__SCENE__SCRIPT_HPP
 
 #include <memory>
+#include <type_traits>
+#include <vector>
 
 #include "scene/scene_object.hpp"
 
@@ -26,6 +28,55 @@ class Script
         SceneObjectPtr _sceneObject;
 
     public:
+        /// @brief Declaration of the data a script accesses when it is 
+        /// updated, allowing the scene to update scripts whose accesses do 
+        /// not conflict concurrently. Data is identified by the address of
+        /// the object holding it: a script moving a scene object should 
+        /// declare it writes to the scene object itself.
+        struct DataAccess
+        {
+            /// @brief Whether the script may access any data. Exclusive 
+            /// scripts are updated one at a time, on the thread triggering
+            /// the scene update, after all other scripts.
+            bool exclusive = true;
+
+            /// @brief Addresses of objects the script reads from.
+            std::vector<const void*> reads;
+
+            /// @brief Addresses of objects the script writes to.
+            std::vector<const void*> writes;
+
+            /// @brief Declare that the script reads from an object, making
+            /// the access non-exclusive.
+            ///
+            /// @tparam T Type of the object which is read from.
+            ///
+            /// @param object Pointer to the object which is read from.
+            template<typename T>
+            void read(const T* object);
+
+            /// @brief Declare that the script writes to an object, making
+            /// the access non-exclusive.
+            ///
+            /// @tparam T Type of the object which is written to.
+            ///
+            /// @param object Pointer to the object which is written to.
+            template<typename T>
+            void write(const T* object);
+
+            /// @brief Get the address of the most derived object an object
+            /// is part of, so that it is identified the same whatever the 
+            /// type it is accessed through.
+            ///
+            /// @tparam T Type of the object to identify.
+            ///
+            /// @param object Pointer to the object to identify.
+            ///
+            /// @return The address of the most derived object.
+            template<typename T>
+            static const void* Identify(const T* object);
+        };
+
         Script();
 
         virtual ~Script();
@@ -36,6 +87,15 @@ class Script
         /// update.
         virtual void update(float timeElapsed) = 0;
 
+        /// @brief Declare which data the script accesses when it is updated.
+        /// Scripts declaring non-exclusive access may be updated 
+        /// concurrently with other scripts, on a thread other than the one
+        /// triggering the scene update. The scene queries the declaration 
+        /// whenever the set of registered scripts changes.
+        ///
+        /// @return The data access of the script. Exclusive by default.
+        virtual DataAccess getDataAccess() const;
+
         /// @brief Get a pointer to the parent scene object, if any.
         ///
         /// @return A pointer to the parent scene object, or nullptr.
@@ -58,6 +118,33 @@ class Script
         const unsigned int id;
 };
 
+template<typename T>
+void Script::DataAccess::read(const T* object)
+{
+    exclusive = false;
+    reads.push_back(Identify(object));
+}
+
+template<typename T>
+void Script::DataAccess::write(const T* object)
+{
+    exclusive = false;
+    writes.push_back(Identify(object));
+}
+
+template<typename T>
+const void* Script::DataAccess::Identify(const T* object)
+{
+    if constexpr (std::is_polymorphic_v<T>)
+    {
+        return dynamic_cast<const void*>(object);
+    }
+    else
+    {
+        return static_cast<const void*>(object);
+    }
+}
+
 using ScriptPtr = std::shared_ptr<Script>;
 using ScriptWPtr = std::weak_ptr<Script>;
 
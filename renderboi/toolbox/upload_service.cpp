@@ -0,0 +1,170 @@
+#include "upload_service.hpp"
+
+#include <stdexcept>
+
+namespace Renderboi
+{
+
+UploadService::Upload::Upload(UploadFunction function) :
+    _function(std::move(function)),
+    _state(State::Queued),
+    _fence(nullptr),
+    _exception()
+{
+
+}
+
+UploadService::Upload::State UploadService::Upload::getState() const
+{
+    return _state.load(std::memory_order_acquire);
+}
+
+UploadService::UploadService(const Window::GLWindowPtr window) :
+    _window(window),
+    _queue(),
+    _running(true),
+    _mutex(),
+    _queueChanged(),
+    _uploadSubmitted(),
+    _thread()
+{
+    if (!_window)
+    {
+        throw std::runtime_error("UploadService: cannot upload resources from null window pointer.");
+    }
+
+    _thread = std::thread(&UploadService::_uploadLoop, this);
+}
+
+UploadService::~UploadService()
+{
+    {
+        std::unique_lock lock(_mutex);
+        _running = false;
+
+        // Queued functions may hold references to their own upload
+        for (const auto& upload : _queue)
+        {
+            upload->_function = nullptr;
+        }
+        _queue.clear();
+    }
+    _queueChanged.notify_all();
+    _thread.join();
+}
+
+UploadService::UploadPtr UploadService::submit(UploadFunction function)
+{
+    const UploadPtr upload = std::make_shared<Upload>(std::move(function));
+    {
+        std::unique_lock lock(_mutex);
+        _queue.push_back(upload);
+    }
+    _queueChanged.notify_one();
+
+    return upload;
+}
+
+bool UploadService::poll(const UploadPtr& upload) const
+{
+    switch (upload->getState())
+    {
+        case Upload::State::Queued:
+            return false;
+        case Upload::State::Submitted:
+            return _CheckFence(*upload, 0);
+        case Upload::State::Complete:
+        default:
+            return true;
+    }
+}
+
+void UploadService::wait(const UploadPtr& upload)
+{
+    {
+        std::unique_lock lock(_mutex);
+        _uploadSubmitted.wait(lock, [&upload]()
+        {
+            return upload->getState() != Upload::State::Queued;
+        });
+    }
+
+    // Wait for the fence a second at a time
+    static constexpr GLuint64 Timeout = 1000000000;
+    while (!_CheckFence(*upload, Timeout));
+}
+
+bool UploadService::_CheckFence(Upload& upload, const GLuint64 timeout)
+{
+    // Only the rendering thread checks fences, no synchronisation needed
+    if (upload.getState() == Upload::State::Complete) return true;
+
+    if (upload._fence)
+    {
+        const GLenum status = glClientWaitSync(upload._fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+        if (status == GL_TIMEOUT_EXPIRED) return false;
+
+        glDeleteSync(upload._fence);
+        upload._fence = nullptr;
+    }
+
+    upload._state.store(Upload::State::Complete, std::memory_order_release);
+
+    if (upload._exception)
+    {
+        std::rethrow_exception(upload._exception);
+    }
+
+    return true;
+}
+
+void UploadService::_uploadLoop()
+{
+    _window->makeContextCurrent(nullptr);
+
+    while (true)
+    {
+        UploadPtr upload;
+        {
+            std::unique_lock lock(_mutex);
+            _queueChanged.wait(lock, [this]()
+            {
+                return !_running || !_queue.empty();
+            });
+
+            if (!_running) break;
+
+            upload = _queue.front();
+            _queue.pop_front();
+        }
+
+        try
+        {
+            upload->_function();
+        }
+        catch (...)
+        {
+            upload->_exception = std::current_exception();
+        }
+
+        // Release the resources held by the function right away
+        upload->_function = nullptr;
+
+        // Have the GL calls sent to the GPU, and signal when they complete
+        if (!upload->_exception)
+        {
+            upload->_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        }
+        glFlush();
+
+        {
+            std::unique_lock lock(_mutex);
+            upload->_state.store(Upload::State::Submitted, std::memory_order_release);
+        }
+        _uploadSubmitted.notify_all();
+    }
+
+    _window->releaseContext();
+}
+
+}//namespace Renderboi
@@ -0,0 +1,231 @@
+#ifndef RENDERBOI__TOOLBOX__UPLOAD_SERVICE_HPP
+#define RENDERBOI__TOOLBOX__UPLOAD_SERVICE_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <glad/gl.h>
+
+#include <renderboi/window/gl_window.hpp>
+
+namespace Renderboi
+{
+
+/// @brief Runs uploads of GPU resources (buffers, textures, and anything
+/// else that can be shared between GL contexts) on a thread of its own,
+/// using the context of a hidden window which shares objects with the
+/// rendering context. Completion of an upload is signaled to the rendering
+/// thread through a fence, so that resources are never used before the GPU
+/// is done receiving them. Meant to be used as follows:
+///
+/// @code
+/// // Main thread, windows may only be created there
+/// WindowCreationParameters params = DefaultWindowCreationParameters;
+/// params.visible = false;
+/// params.shareContext = window;
+/// UploadService uploadService(WindowFactory<Backend>::MakeWindow(params));
+///
+/// // Any thread
+/// auto texture = uploadService.make<Texture2D>("wood.png", PixelSpace::sRGB);
+///
+/// // Rendering thread, every frame
+/// if (uploadService.poll(texture->upload))
+/// {
+///     // texture->resource is ready to be used
+/// }
+/// @endcode
+///
+/// @note Vertex array objects cannot be shared between contexts, and must
+/// still be created on the rendering thread (see Mesh).
+class UploadService
+{
+public:
+    /// @brief Function performing GL calls on the upload context.
+    using UploadFunction = std::function<void()>;
+
+    /// @brief Progress of an upload.
+    class Upload
+    {
+        friend UploadService;
+
+    public:
+        /// @brief Collection of litterals describing the progress of an
+        /// upload.
+        enum class State
+        {
+            /// @brief The upload is waiting to be run.
+            Queued,
+            /// @brief The upload was run and its GL calls were submitted,
+            /// but the GPU may still be processing them.
+            Submitted,
+            /// @brief The GPU is done processing the GL calls of the
+            /// upload.
+            Complete
+        };
+
+    private:
+        /// @brief Function performing the upload.
+        UploadFunction _function;
+
+        /// @brief Progress of the upload.
+        std::atomic<State> _state;
+
+        /// @brief Fence signaled once the GPU is done processing the GL
+        /// calls of the upload.
+        GLsync _fence;
+
+        /// @brief Exception thrown by the function of the upload, if any.
+        std::exception_ptr _exception;
+
+    public:
+        /// @param function Function performing the upload.
+        Upload(UploadFunction function);
+
+        /// @brief Get the progress of the upload, as last observed.
+        ///
+        /// @return The progress of the upload.
+        State getState() const;
+    };
+
+    using UploadPtr = std::shared_ptr<Upload>;
+
+    /// @brief Resource being constructed on the upload thread.
+    ///
+    /// @tparam T Type of the resource.
+    template<typename T>
+    struct PendingResource
+    {
+        /// @brief Upload constructing the resource.
+        UploadPtr upload;
+
+        /// @brief Pointer to the resource. May only be accessed once the
+        /// upload is complete.
+        std::shared_ptr<T> resource;
+    };
+
+    template<typename T>
+    using PendingResourcePtr = std::shared_ptr<PendingResource<T>>;
+
+private:
+    UploadService(const UploadService& other) = delete;
+    UploadService& operator=(const UploadService& other) = delete;
+
+    /// @brief Hidden window whose context is used to upload resources.
+    Window::GLWindowPtr _window;
+
+    /// @brief Uploads waiting to be run.
+    std::deque<UploadPtr> _queue;
+
+    /// @brief Whether the upload thread should keep running.
+    bool _running;
+
+    /// @brief Mutex protecting the queue, the running flag and the state
+    /// transition of uploads to submitted.
+    std::mutex _mutex;
+
+    /// @brief Condition signaled when uploads are queued or when the
+    /// service shuts down.
+    std::condition_variable _queueChanged;
+
+    /// @brief Condition signaled when uploads are submitted.
+    std::condition_variable _uploadSubmitted;
+
+    /// @brief Thread running the uploads.
+    std::thread _thread;
+
+    /// @brief Routine run by the upload thread.
+    void _uploadLoop();
+
+    /// @brief Check whether the fence of a submitted upload was signaled,
+    /// and mark the upload complete if so.
+    ///
+    /// @param upload Upload to check.
+    /// @param timeout How long (in nanoseconds) to wait for the fence.
+    ///
+    /// @return Whether the upload is complete.
+    static bool _CheckFence(Upload& upload, const GLuint64 timeout);
+
+public:
+    /// @param window Hidden window whose context shares objects with the
+    /// rendering context. Its context is made current on the upload thread
+    /// for the lifetime of the service, and must not be current on any
+    /// other thread.
+    ///
+    /// @exception If the provided window pointer is null, the function will
+    /// throw a std::runtime_error.
+    UploadService(const Window::GLWindowPtr window);
+
+    /// @brief Wait for the upload being run, if any, and stop the upload
+    /// thread. Queued uploads are discarded.
+    ~UploadService();
+
+    /// @brief Queue an upload. May be called from any thread.
+    ///
+    /// @param function Function performing the upload, to be run on the
+    /// upload thread.
+    ///
+    /// @return A pointer to the queued upload.
+    UploadPtr submit(UploadFunction function);
+
+    /// @brief Queue the construction of a resource on the upload thread.
+    /// May be called from any thread.
+    ///
+    /// @tparam T Type of the resource to construct.
+    /// @tparam ArgTypes Types of the arguments to construct the resource
+    /// with.
+    ///
+    /// @param args Arguments to construct the resource with. They are
+    /// copied.
+    ///
+    /// @return A pointer to the pending resource.
+    template<typename T, typename... ArgTypes>
+    PendingResourcePtr<T> make(const ArgTypes&... args);
+
+    /// @brief Check whether an upload is complete, without blocking. Must
+    /// be called from a thread whose current context shares objects with
+    /// the upload context.
+    ///
+    /// @param upload Upload to check.
+    ///
+    /// @return Whether the upload is complete.
+    ///
+    /// @exception If the function of the upload threw an exception, it is
+    /// rethrown by this function.
+    bool poll(const UploadPtr& upload) const;
+
+    /// @brief Block until an upload is complete. Must be called from a
+    /// thread whose current context shares objects with the upload context.
+    ///
+    /// @param upload Upload to wait for.
+    ///
+    /// @exception If the function of the upload threw an exception, it is
+    /// rethrown by this function.
+    void wait(const UploadPtr& upload);
+};
+
+template<typename T, typename... ArgTypes>
+UploadService::PendingResourcePtr<T> UploadService::make(const ArgTypes&... args)
+{
+    const PendingResourcePtr<T> pending = std::make_shared<PendingResource<T>>();
+
+    // The function is released as soon as it has run, which breaks the
+    // reference cycle between the pending resource and its upload
+    pending->upload = submit([pending, args...]()
+    {
+        pending->resource = std::make_shared<T>(args...);
+    });
+
+    return pending;
+}
+
+using UploadServicePtr = std::shared_ptr<UploadService>;
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__TOOLBOX__UPLOAD_SERVICE_HPP
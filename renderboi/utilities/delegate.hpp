@@ -0,0 +1,267 @@
+#ifndef RENDERBOI__UTILITIES__DELEGATE_HPP
+#define RENDERBOI__UTILITIES__DELEGATE_HPP
+
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace Renderboi
+{
+
+template<typename Signature>
+class Delegate;
+
+/// @brief Type-erased callable, much like std::function, but which stores
+/// small callables (up to BufferSize bytes, such as lambdas capturing a
+/// couple of pointers) inline rather than on the heap, and invokes them
+/// through a single function pointer. Larger callables are stored on the
+/// heap. Stored callables must be copy constructible.
+///
+/// @tparam R Return type of the callable.
+/// @tparam Args Types of the parameters of the callable.
+template<typename R, typename... Args>
+class Delegate<R(Args...)>
+{
+public:
+    /// @brief Size of the buffer in which callables are stored inline.
+    static constexpr std::size_t BufferSize = 4 * sizeof(void*);
+
+private:
+    /// @brief Collection of litterals describing the operations performed
+    /// by a manager function on a stored callable.
+    enum class Operation
+    {
+        Copy,
+        Move,
+        Destroy
+    };
+
+    using Invoker = R(*)(const void*, Args&&...);
+    using Manager = void(*)(const Operation, void*, void*);
+
+    /// @brief Whether a callable of some type is stored inline.
+    template<typename F>
+    static constexpr bool _IsInline =
+        sizeof(F) <= BufferSize &&
+        alignof(F) <= alignof(std::max_align_t) &&
+        std::is_nothrow_move_constructible_v<F>;
+
+    /// @brief Storage for the callable, or for a pointer to it if it is
+    /// stored on the heap.
+    alignas(std::max_align_t) unsigned char _buffer[BufferSize];
+
+    /// @brief Function invoking the stored callable. Null if the delegate
+    /// is empty.
+    Invoker _invoker;
+
+    /// @brief Function copying, moving or destroying the stored callable.
+    /// Null if the delegate is empty.
+    Manager _manager;
+
+    /// @brief Get the callable stored in a buffer.
+    template<typename F>
+    static F* _Get(const void* buffer);
+
+    /// @brief Invoke the callable stored in a buffer.
+    template<typename F>
+    static R _Invoke(const void* buffer, Args&&... args);
+
+    /// @brief Copy, move or destroy the callable stored in a buffer.
+    template<typename F>
+    static void _Manage(const Operation operation, void* dest, void* src);
+
+public:
+    Delegate();
+
+    /// @param callable Callable to store.
+    template<typename F, typename = std::enable_if_t<
+        !std::is_same_v<std::decay_t<F>, Delegate<R(Args...)>> &&
+        std::is_invocable_r_v<R, std::decay_t<F>&, Args...>
+    >>
+    Delegate(F&& callable);
+
+    Delegate(const Delegate<R(Args...)>& other);
+    Delegate(Delegate<R(Args...)>&& other) noexcept;
+    Delegate<R(Args...)>& operator=(const Delegate<R(Args...)>& other);
+    Delegate<R(Args...)>& operator=(Delegate<R(Args...)>&& other) noexcept;
+
+    ~Delegate();
+
+    /// @brief Invoke the stored callable.
+    ///
+    /// @param args Arguments to invoke the callable with.
+    ///
+    /// @return What the callable returned.
+    ///
+    /// @exception If the delegate is empty, the function will throw a
+    /// std::runtime_error.
+    R operator()(Args... args) const;
+
+    /// @brief Tell whether a callable is stored.
+    ///
+    /// @return Whether a callable is stored.
+    explicit operator bool() const;
+};
+
+template<typename R, typename... Args>
+Delegate<R(Args...)>::Delegate() :
+    _buffer(),
+    _invoker(nullptr),
+    _manager(nullptr)
+{
+
+}
+
+template<typename R, typename... Args>
+template<typename F, typename>
+Delegate<R(Args...)>::Delegate(F&& callable) :
+    _invoker(&_Invoke<std::decay_t<F>>),
+    _manager(&_Manage<std::decay_t<F>>)
+{
+    using Callable = std::decay_t<F>;
+    if constexpr (_IsInline<Callable>)
+    {
+        new (_buffer) Callable(std::forward<F>(callable));
+    }
+    else
+    {
+        *reinterpret_cast<Callable**>(_buffer) = new Callable(std::forward<F>(callable));
+    }
+}
+
+template<typename R, typename... Args>
+Delegate<R(Args...)>::Delegate(const Delegate<R(Args...)>& other) :
+    _invoker(other._invoker),
+    _manager(other._manager)
+{
+    if (_manager) _manager(Operation::Copy, _buffer, const_cast<unsigned char*>(other._buffer));
+}
+
+template<typename R, typename... Args>
+Delegate<R(Args...)>::Delegate(Delegate<R(Args...)>&& other) noexcept :
+    _invoker(other._invoker),
+    _manager(other._manager)
+{
+    if (_manager) _manager(Operation::Move, _buffer, other._buffer);
+    other._invoker = nullptr;
+    other._manager = nullptr;
+}
+
+template<typename R, typename... Args>
+Delegate<R(Args...)>& Delegate<R(Args...)>::operator=(const Delegate<R(Args...)>& other)
+{
+    if (this != &other)
+    {
+        Delegate<R(Args...)> copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+template<typename R, typename... Args>
+Delegate<R(Args...)>& Delegate<R(Args...)>::operator=(Delegate<R(Args...)>&& other) noexcept
+{
+    if (this != &other)
+    {
+        if (_manager) _manager(Operation::Destroy, _buffer, nullptr);
+
+        _invoker = other._invoker;
+        _manager = other._manager;
+        if (_manager) _manager(Operation::Move, _buffer, other._buffer);
+        other._invoker = nullptr;
+        other._manager = nullptr;
+    }
+    return *this;
+}
+
+template<typename R, typename... Args>
+Delegate<R(Args...)>::~Delegate()
+{
+    if (_manager) _manager(Operation::Destroy, _buffer, nullptr);
+}
+
+template<typename R, typename... Args>
+R Delegate<R(Args...)>::operator()(Args... args) const
+{
+    if (!_invoker)
+    {
+        throw std::runtime_error("Delegate: cannot invoke empty delegate.");
+    }
+
+    return _invoker(_buffer, std::forward<Args>(args)...);
+}
+
+template<typename R, typename... Args>
+Delegate<R(Args...)>::operator bool() const
+{
+    return _invoker != nullptr;
+}
+
+template<typename R, typename... Args>
+template<typename F>
+F* Delegate<R(Args...)>::_Get(const void* buffer)
+{
+    if constexpr (_IsInline<F>)
+    {
+        return std::launder(reinterpret_cast<F*>(const_cast<void*>(buffer)));
+    }
+    else
+    {
+        return *reinterpret_cast<F* const*>(buffer);
+    }
+}
+
+template<typename R, typename... Args>
+template<typename F>
+R Delegate<R(Args...)>::_Invoke(const void* buffer, Args&&... args)
+{
+    return (*_Get<F>(buffer))(std::forward<Args>(args)...);
+}
+
+template<typename R, typename... Args>
+template<typename F>
+void Delegate<R(Args...)>::_Manage(const Operation operation, void* dest, void* src)
+{
+    switch (operation)
+    {
+        case Operation::Copy:
+            if constexpr (_IsInline<F>)
+            {
+                new (dest) F(*_Get<F>(src));
+            }
+            else
+            {
+                *reinterpret_cast<F**>(dest) = new F(*_Get<F>(src));
+            }
+            break;
+        case Operation::Move:
+            if constexpr (_IsInline<F>)
+            {
+                F* callable = _Get<F>(src);
+                new (dest) F(std::move(*callable));
+                callable->~F();
+            }
+            else
+            {
+                // Heap-stored callables are moved by handing over the pointer
+                *reinterpret_cast<F**>(dest) = _Get<F>(src);
+            }
+            break;
+        case Operation::Destroy:
+            if constexpr (_IsInline<F>)
+            {
+                _Get<F>(dest)->~F();
+            }
+            else
+            {
+                delete _Get<F>(dest);
+            }
+            break;
+    }
+}
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__UTILITIES__DELEGATE_HPP
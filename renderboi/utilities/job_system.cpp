@@ -0,0 +1,277 @@
+#include "job_system.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace Renderboi
+{
+
+thread_local JobSystem* JobSystem::_CurrentSystem = nullptr;
+thread_local std::size_t JobSystem::_CurrentQueueIndex = 0;
+
+JobSystem::JobSystem(const unsigned int threadCount) :
+    _workers(),
+    _queues(),
+    _queuedJobCount(0),
+    _running(true),
+    _sleepMutex(),
+    _wakeCondition()
+{
+    // One queue per worker, plus one for external threads
+    for (unsigned int i = 0; i <= threadCount; i++)
+    {
+        _queues.push_back(std::make_unique<JobQueue>());
+    }
+
+    for (unsigned int i = 0; i < threadCount; i++)
+    {
+        _workers.emplace_back(&JobSystem::_workerLoop, this, i);
+    }
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::unique_lock lock(_sleepMutex);
+        _running = false;
+    }
+    _wakeCondition.notify_all();
+
+    for (auto& worker : _workers)
+    {
+        worker.join();
+    }
+}
+
+JobSystem::JobPtr JobSystem::schedule(JobFunction function, const std::vector<JobPtr>& dependencies)
+{
+    JobPtr job = std::make_shared<Job>();
+    job->function = std::move(function);
+    job->finished = false;
+
+    // Hold an extra dependency while registering against the others, so
+    // that the job cannot be queued before all of them are accounted for
+    job->pendingDependencies = (unsigned int)dependencies.size() + 1;
+
+    for (const auto& dependency : dependencies)
+    {
+        std::unique_lock lock(dependency->continuationMutex);
+        if (dependency->finished)
+        {
+            lock.unlock();
+            _releaseDependency(job);
+        }
+        else
+        {
+            dependency->continuations.push_back(job);
+        }
+    }
+
+    _releaseDependency(job);
+    return job;
+}
+
+void JobSystem::wait(const JobPtr& job)
+{
+    while (!job->finished.load(std::memory_order_acquire))
+    {
+        // Help with queued jobs rather than idling
+        JobPtr other = _takeJob();
+        if (other)
+        {
+            _run(other);
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    if (job->exception)
+    {
+        std::rethrow_exception(job->exception);
+    }
+}
+
+void JobSystem::wait(const std::vector<JobPtr>& jobs)
+{
+    std::exception_ptr exception;
+    for (const auto& job : jobs)
+    {
+        try
+        {
+            wait(job);
+        }
+        catch (...)
+        {
+            if (!exception) exception = std::current_exception();
+        }
+    }
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+
+bool JobSystem::finished(const JobPtr& job) const
+{
+    return job->finished.load(std::memory_order_acquire);
+}
+
+void JobSystem::parallelFor(const std::size_t count, const std::size_t batchSize, const RangeFunction& function)
+{
+    if (!count) return;
+    if (!batchSize)
+    {
+        throw std::runtime_error("JobSystem: cannot split work in batches of size 0.");
+    }
+
+    // Run everything in place if there is a single batch
+    if (count <= batchSize)
+    {
+        function(0, count);
+        return;
+    }
+
+    std::vector<JobPtr> jobs;
+    jobs.reserve((count + batchSize - 1) / batchSize);
+    for (std::size_t begin = 0; begin < count; begin += batchSize)
+    {
+        const std::size_t end = std::min(begin + batchSize, count);
+        jobs.push_back(schedule([&function, begin, end]() { function(begin, end); }));
+    }
+
+    wait(jobs);
+}
+
+unsigned int JobSystem::getThreadCount() const
+{
+    return (unsigned int)_workers.size();
+}
+
+unsigned int JobSystem::DefaultThreadCount()
+{
+    const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+    return hardwareThreads ? hardwareThreads - 1 : 0;
+}
+
+void JobSystem::_workerLoop(const std::size_t index)
+{
+    _CurrentSystem = this;
+    _CurrentQueueIndex = index;
+
+    while (true)
+    {
+        JobPtr job = _takeJob();
+        if (job)
+        {
+            _run(job);
+            continue;
+        }
+
+        // Sleep until jobs are queued or the system shuts down
+        std::unique_lock lock(_sleepMutex);
+        _wakeCondition.wait(lock, [this]()
+        {
+            return !_running || _queuedJobCount.load(std::memory_order_acquire) > 0;
+        });
+
+        if (!_running) return;
+    }
+}
+
+std::size_t JobSystem::_ownQueueIndex() const
+{
+    // Threads foreign to the job system share the last queue
+    return (_CurrentSystem == this) ? _CurrentQueueIndex : _queues.size() - 1;
+}
+
+void JobSystem::_enqueue(const JobPtr& job)
+{
+    JobQueue& queue = *_queues[_ownQueueIndex()];
+    {
+        std::unique_lock lock(queue.mutex);
+        queue.jobs.push_back(job);
+    }
+
+    {
+        // Increment under the sleep mutex so that no worker misses the
+        // wake-up between checking the count and going to sleep
+        std::unique_lock lock(_sleepMutex);
+        _queuedJobCount.fetch_add(1, std::memory_order_release);
+    }
+    _wakeCondition.notify_one();
+}
+
+JobSystem::JobPtr JobSystem::_takeJob()
+{
+    if (!_queuedJobCount.load(std::memory_order_acquire)) return nullptr;
+
+    // Own queue first, most recent job first as its data is likely warm
+    const std::size_t ownIndex = _ownQueueIndex();
+    {
+        JobQueue& queue = *_queues[ownIndex];
+        std::unique_lock lock(queue.mutex);
+        if (!queue.jobs.empty())
+        {
+            JobPtr job = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+            _queuedJobCount.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+
+    // Then steal the oldest job of another queue
+    for (std::size_t i = 1; i < _queues.size(); i++)
+    {
+        JobQueue& queue = *_queues[(ownIndex + i) % _queues.size()];
+        std::unique_lock lock(queue.mutex);
+        if (!queue.jobs.empty())
+        {
+            JobPtr job = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+            _queuedJobCount.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+
+    return nullptr;
+}
+
+void JobSystem::_run(const JobPtr& job)
+{
+    try
+    {
+        job->function();
+    }
+    catch (...)
+    {
+        job->exception = std::current_exception();
+    }
+
+    // Release the resources held by the function right away
+    job->function = nullptr;
+
+    std::vector<JobPtr> continuations;
+    {
+        std::unique_lock lock(job->continuationMutex);
+        job->finished.store(true, std::memory_order_release);
+        continuations.swap(job->continuations);
+    }
+
+    for (const auto& continuation : continuations)
+    {
+        _releaseDependency(continuation);
+    }
+}
+
+void JobSystem::_releaseDependency(const JobPtr& job)
+{
+    if (job->pendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        _enqueue(job);
+    }
+}
+
+}//namespace Renderboi
@@ -0,0 +1,209 @@
+#ifndef RENDERBOI__UTILITIES__JOB_SYSTEM_HPP
+#define RENDERBOI__UTILITIES__JOB_SYSTEM_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Renderboi
+{
+
+/// @brief Pool of worker threads running jobs, which may depend on other
+/// jobs. Every worker has its own queue of jobs, and steals jobs from the
+/// queues of other workers when it runs out of work. Threads waiting on
+/// jobs help running queued jobs in the meantime, so that a job system
+/// without any worker thread runs all jobs on the waiting threads.
+class JobSystem
+{
+private:
+    struct Job;
+
+public:
+    /// @brief Function run by a job.
+    using JobFunction = std::function<void()>;
+
+    /// @brief Function run by a job over a range of indices.
+    using RangeFunction = std::function<void(const std::size_t begin, const std::size_t end)>;
+
+    /// @brief Handle to a scheduled job.
+    using JobPtr = std::shared_ptr<Job>;
+
+private:
+    /// @brief A unit of work and its dependency bookkeeping.
+    struct Job
+    {
+        /// @brief Function to run.
+        JobFunction function;
+
+        /// @brief How many jobs must finish before this one can be queued,
+        /// plus one while the job is being scheduled.
+        std::atomic<unsigned int> pendingDependencies;
+
+        /// @brief Whether the job has finished running.
+        std::atomic<bool> finished;
+
+        /// @brief Exception thrown by the function of the job, if any.
+        std::exception_ptr exception;
+
+        /// @brief Jobs depending on this one and which were scheduled before
+        /// it finished.
+        std::vector<JobPtr> continuations;
+
+        /// @brief Mutex protecting the continuations and the transition to
+        /// the finished state.
+        std::mutex continuationMutex;
+    };
+
+    /// @brief Queue of jobs ready to run.
+    struct JobQueue
+    {
+        /// @brief Jobs ready to run. The owner of the queue pushes and pops
+        /// at the back, other threads steal from the front.
+        std::deque<JobPtr> jobs;
+
+        /// @brief Mutex protecting the jobs.
+        std::mutex mutex;
+    };
+
+    /// @brief Worker threads of the job system.
+    std::vector<std::thread> _workers;
+
+    /// @brief One job queue per worker thread, plus one last queue for jobs
+    /// scheduled from other threads.
+    std::vector<std::unique_ptr<JobQueue>> _queues;
+
+    /// @brief How many jobs are sitting in queues.
+    std::atomic<unsigned int> _queuedJobCount;
+
+    /// @brief Whether worker threads should keep running.
+    std::atomic<bool> _running;
+
+    /// @brief Mutex used by idle worker threads to wait for work.
+    std::mutex _sleepMutex;
+
+    /// @brief Condition signaled when jobs are queued or when the job
+    /// system shuts down.
+    std::condition_variable _wakeCondition;
+
+    /// @brief Job system which the calling thread is a worker of, if any.
+    static thread_local JobSystem* _CurrentSystem;
+
+    /// @brief Index of the queue of the calling worker thread.
+    static thread_local std::size_t _CurrentQueueIndex;
+
+    /// @brief Routine run by worker threads.
+    ///
+    /// @param index Index of the queue of the worker.
+    void _workerLoop(const std::size_t index);
+
+    /// @brief Get the index of the queue which the calling thread should
+    /// push jobs to.
+    ///
+    /// @return The index of the queue of the calling thread.
+    std::size_t _ownQueueIndex() const;
+
+    /// @brief Queue a job whose dependencies are all finished.
+    ///
+    /// @param job Job to queue.
+    void _enqueue(const JobPtr& job);
+
+    /// @brief Take a job to run, from the own queue of the calling thread
+    /// first, or else from the queue of another thread.
+    ///
+    /// @return The job to run, or nullptr if there was none.
+    JobPtr _takeJob();
+
+    /// @brief Run a job, then queue the jobs depending on it which are
+    /// ready to run.
+    ///
+    /// @param job Job to run.
+    void _run(const JobPtr& job);
+
+    /// @brief Remove one pending dependency from a job, queuing it if it
+    /// was the last.
+    ///
+    /// @param job Job to remove a pending dependency from.
+    void _releaseDependency(const JobPtr& job);
+
+public:
+    /// @param threadCount How many worker threads to start. Defaults to one
+    /// less than the amount of hardware threads, as the thread waiting on
+    /// jobs helps running them.
+    JobSystem(const unsigned int threadCount = DefaultThreadCount());
+
+    JobSystem(const JobSystem& other) = delete;
+    JobSystem& operator=(const JobSystem& other) = delete;
+
+    /// @brief Wait for workers to finish running their current job and
+    /// stop them. Jobs still queued are not run.
+    ~JobSystem();
+
+    /// @brief Schedule a job to run once all of its dependencies finished.
+    /// May be called from any thread, including from within a job.
+    ///
+    /// @param function Function for the job to run.
+    /// @param dependencies Jobs which must finish before this one runs.
+    ///
+    /// @return A handle to the scheduled job.
+    JobPtr schedule(JobFunction function, const std::vector<JobPtr>& dependencies = {});
+
+    /// @brief Block until a job finished running, running other queued jobs
+    /// in the meantime.
+    ///
+    /// @param job Handle to the job to wait for.
+    ///
+    /// @exception If the function of the job threw an exception, it is
+    /// rethrown by this function.
+    void wait(const JobPtr& job);
+
+    /// @brief Block until several jobs finished running, running other
+    /// queued jobs in the meantime.
+    ///
+    /// @param jobs Handles to the jobs to wait for.
+    ///
+    /// @exception If the function of any of the jobs threw an exception,
+    /// the first one of them is rethrown by this function.
+    void wait(const std::vector<JobPtr>& jobs);
+
+    /// @brief Tell whether a job finished running.
+    ///
+    /// @param job Handle to the job to check.
+    ///
+    /// @return Whether the job finished running.
+    bool finished(const JobPtr& job) const;
+
+    /// @brief Split a range of indices in batches, run a function over
+    /// every batch in parallel and wait for all of them.
+    ///
+    /// @param count How many indices to process, starting from 0.
+    /// @param batchSize Maximum amount of indices to process in a job.
+    /// @param function Function to run over every batch of indices.
+    ///
+    /// @exception If the function threw an exception for any batch, the
+    /// first one of them is rethrown by this function.
+    void parallelFor(const std::size_t count, const std::size_t batchSize, const RangeFunction& function);
+
+    /// @brief Get how many worker threads the job system runs.
+    ///
+    /// @return How many worker threads the job system runs.
+    unsigned int getThreadCount() const;
+
+    /// @brief Get the default amount of worker threads to start.
+    ///
+    /// @return One less than the amount of hardware threads, or 0 if it
+    /// cannot be determined.
+    static unsigned int DefaultThreadCount();
+};
+
+using JobSystemPtr = std::shared_ptr<JobSystem>;
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__UTILITIES__JOB_SYSTEM_HPP
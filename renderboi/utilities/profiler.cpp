@@ -0,0 +1,221 @@
+#include "profiler.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+
+namespace
+{
+
+/// @brief Write a string as a JSON string litteral.
+void writeJsonString(std::ofstream& stream, const std::string& str)
+{
+    stream << '"';
+    for (const char c : str)
+    {
+        switch (c)
+        {
+            case '"':  stream << "\\\""; break;
+            case '\\': stream << "\\\\"; break;
+            case '\n': stream << "\\n";  break;
+            case '\t': stream << "\\t";  break;
+            default:   stream << c;      break;
+        }
+    }
+    stream << '"';
+}
+
+}//namespace
+
+namespace Renderboi
+{
+
+std::atomic<bool> Profiler::_enabled = false;
+std::mutex Profiler::_tracksMutex = std::mutex();
+std::vector<std::unique_ptr<Profiler::Track>> Profiler::_tracks = std::vector<std::unique_ptr<Profiler::Track>>();
+
+Profiler::Track::Track(const std::string& name, const unsigned int index) :
+    _name(name),
+    _index(index),
+    _slots(std::make_unique<Slot[]>(TrackCapacity)),
+    _written(0),
+    _clearedCount(0)
+{
+
+}
+
+void Profiler::Track::record(const Zone& zone)
+{
+    // Overwrite the oldest zone once the ring is full
+    const std::size_t written = _written.load(std::memory_order_relaxed);
+    Slot& slot = _slots[written % TrackCapacity];
+
+    slot.sequence.store(2 * written + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.name.store(zone.name, std::memory_order_relaxed);
+    slot.start.store(zone.start.time_since_epoch().count(), std::memory_order_relaxed);
+    slot.duration.store(zone.duration.count(), std::memory_order_relaxed);
+
+    slot.sequence.store(2 * written + 2, std::memory_order_release);
+    _written.store(written + 1, std::memory_order_release);
+}
+
+std::size_t Profiler::Track::getOverwrittenCount() const
+{
+    const std::size_t written = _written.load(std::memory_order_acquire);
+    const std::size_t cleared = _clearedCount.load(std::memory_order_relaxed);
+    const std::size_t recorded = written - std::min(cleared, written);
+    return (recorded > TrackCapacity) ? recorded - TrackCapacity : 0;
+}
+
+std::vector<Profiler::Zone> Profiler::Track::_snapshot() const
+{
+    const std::size_t written = _written.load(std::memory_order_acquire);
+    const std::size_t cleared = _clearedCount.load(std::memory_order_relaxed);
+    std::size_t first = (written > TrackCapacity) ? written - TrackCapacity : 0;
+    if (cleared > first) first = std::min(cleared, written);
+
+    std::vector<Zone> zones;
+    zones.reserve(written - first);
+    for (std::size_t i = first; i < written; i++)
+    {
+        const Slot& slot = _slots[i % TrackCapacity];
+
+        const std::size_t before = slot.sequence.load(std::memory_order_acquire);
+        const Zone zone = {
+            slot.name.load(std::memory_order_relaxed),
+            Clock::time_point(Clock::duration(slot.start.load(std::memory_order_relaxed))),
+            Clock::duration(slot.duration.load(std::memory_order_relaxed))
+        };
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const std::size_t after = slot.sequence.load(std::memory_order_relaxed);
+
+        // Discard the zone if the owning thread overwrote it in the meantime
+        if (before != 2 * i + 2 || after != before) continue;
+
+        zones.push_back(zone);
+    }
+
+    return zones;
+}
+
+void Profiler::SetEnabled(const bool enabled)
+{
+    _enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool Profiler::Enabled()
+{
+    return _enabled.load(std::memory_order_relaxed);
+}
+
+Profiler::Track& Profiler::ThreadTrack()
+{
+    thread_local Track* track = nullptr;
+    if (!track)
+    {
+        std::lock_guard lock(_tracksMutex);
+        const unsigned int index = (unsigned int)_tracks.size();
+        _tracks.push_back(std::unique_ptr<Track>(new Track("Thread " + std::to_string(index), index)));
+        track = _tracks.back().get();
+    }
+
+    return *track;
+}
+
+Profiler::Track& Profiler::CreateTrack(const std::string& name)
+{
+    std::lock_guard lock(_tracksMutex);
+    const unsigned int index = (unsigned int)_tracks.size();
+    _tracks.push_back(std::unique_ptr<Track>(new Track(name, index)));
+    return *_tracks.back();
+}
+
+void Profiler::Clear()
+{
+    std::lock_guard lock(_tracksMutex);
+    for (const auto& track : _tracks)
+    {
+        // The write counter belongs to the owning thread: only move the
+        // start of the exported range past what was written so far
+        track->_clearedCount.store(track->_written.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+}
+
+void Profiler::ExportChromeTrace(const std::filesystem::path& path)
+{
+    std::ofstream stream(path);
+    if (!stream)
+    {
+        throw std::runtime_error("Profiler: could not open \"" + path.string() + "\" for writing.");
+    }
+
+    using Microseconds = std::chrono::duration<double, std::micro>;
+
+    std::lock_guard lock(_tracksMutex);
+
+    std::vector<std::vector<Zone>> trackZones;
+    trackZones.reserve(_tracks.size());
+    for (const auto& track : _tracks)
+    {
+        trackZones.push_back(track->_snapshot());
+    }
+
+    // Timestamps are made relative to the earliest zone
+    Clock::time_point origin = Clock::time_point::max();
+    for (const auto& zones : trackZones)
+    {
+        for (const Zone& zone : zones)
+        {
+            if (zone.start < origin) origin = zone.start;
+        }
+    }
+
+    stream << std::fixed << std::setprecision(3);
+    stream << "{\"traceEvents\":[";
+    bool first = true;
+    for (std::size_t t = 0; t < _tracks.size(); t++)
+    {
+        const auto& track = _tracks[t];
+
+        // Name the track after its thread
+        stream << (first ? "\n" : ",\n");
+        stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << track->_index << ",\"args\":{\"name\":";
+        writeJsonString(stream, track->_name);
+        stream << "}}";
+        first = false;
+
+        for (const Zone& zone : trackZones[t])
+        {
+            stream << ",\n{\"name\":";
+            writeJsonString(stream, zone.name);
+            stream << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << track->_index
+                   << ",\"ts\":" << Microseconds(zone.start - origin).count()
+                   << ",\"dur\":" << Microseconds(zone.duration).count() << "}";
+        }
+    }
+    stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    if (!stream)
+    {
+        throw std::runtime_error("Profiler: failed to write \"" + path.string() + "\".");
+    }
+}
+
+ProfilerScope::ProfilerScope(const char* name) :
+    _name(name),
+    _start(Profiler::Enabled() ? Profiler::Clock::now() : Profiler::Clock::time_point())
+{
+
+}
+
+ProfilerScope::~ProfilerScope()
+{
+    if (_start == Profiler::Clock::time_point()) return;
+
+    Profiler::ThreadTrack().record({_name, _start, Profiler::Clock::now() - _start});
+}
+
+}//namespace Renderboi
@@ -0,0 +1,205 @@
+#ifndef RENDERBOI__UTILITIES__PROFILER_HPP
+#define RENDERBOI__UTILITIES__PROFILER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Renderboi
+{
+
+/// @brief Records timed zones on tracks, one track per thread by default,
+/// and exports them in the Chrome trace event format (to be opened with
+/// chrome://tracing or Perfetto). Each track is only written by a single
+/// thread, without locking; tracks are rings of fixed capacity, in which
+/// the latest zones overwrite the oldest ones, so that exports always cover
+/// the end of the session. Recording is disabled until enabled with
+/// SetEnabled().
+///
+/// Zones are best recorded with the RB_PROFILE_ZONE macro, which compiles
+/// to nothing unless RENDERBOI_PROFILING is defined (which it is in debug
+/// builds, or when configuring with -DRENDERBOI_PROFILING=ON).
+class Profiler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief Record of a timed zone.
+    struct Zone
+    {
+        /// @brief Name of the zone. Must have static storage duration.
+        const char* name;
+
+        /// @brief Point in time at which the zone started.
+        Clock::time_point start;
+
+        /// @brief Time elapsed in the zone.
+        Clock::duration duration;
+    };
+
+    /// @brief Sequence of zones recorded by a single thread.
+    class Track
+    {
+    private:
+        friend Profiler;
+
+        /// @brief Name under which the track is exported.
+        std::string _name;
+
+        /// @brief Index of the track, exported as a thread ID.
+        unsigned int _index;
+
+        /// @brief Slot of the ring in which a zone is stored. Fields are
+        /// relaxed atomics so that they may be copied while being
+        /// overwritten, the sequence number telling whether the copy is
+        /// consistent.
+        struct Slot
+        {
+            /// @brief 2n + 1 while zone n is being written to the slot,
+            /// 2n + 2 once it is.
+            std::atomic<std::size_t> sequence;
+
+            /// @brief Name of the zone.
+            std::atomic<const char*> name;
+
+            /// @brief Start of the zone, in clock ticks since its epoch.
+            std::atomic<Clock::rep> start;
+
+            /// @brief Duration of the zone, in clock ticks.
+            std::atomic<Clock::rep> duration;
+        };
+
+        /// @brief Ring storage for the zones of the track. The zone of
+        /// index i is stored at i % TrackCapacity.
+        std::unique_ptr<Slot[]> _slots;
+
+        /// @brief How many zones were ever recorded on the track, published
+        /// to readers. Only ever written by the thread owning the track.
+        std::atomic<std::size_t> _written;
+
+        /// @brief Index of the first zone which was not cleared. Zones of
+        /// lower indices are not exported.
+        std::atomic<std::size_t> _clearedCount;
+
+        /// @brief Copy the zones which are still held by the track and were
+        /// not cleared. May be called from any thread, concurrently with
+        /// record().
+        ///
+        /// @return The zones held by the track, from oldest to latest.
+        std::vector<Zone> _snapshot() const;
+
+        Track(const std::string& name, const unsigned int index);
+
+    public:
+        Track(const Track& other) = delete;
+        Track& operator=(const Track& other) = delete;
+
+        /// @brief Record a zone. Must only be called by the thread owning
+        /// the track.
+        ///
+        /// @param zone Zone to record.
+        void record(const Zone& zone);
+
+        /// @brief Get how many zones recorded since the last clear were
+        /// overwritten by later zones because the track was full.
+        ///
+        /// @return How many zones were overwritten.
+        std::size_t getOverwrittenCount() const;
+    };
+
+    /// @brief How many zones a track can hold.
+    static constexpr std::size_t TrackCapacity = 1 << 16;
+
+private:
+    /// @brief Whether zones are being recorded.
+    static std::atomic<bool> _enabled;
+
+    /// @brief Guards the array of tracks.
+    static std::mutex _tracksMutex;
+
+    /// @brief All tracks created so far. Tracks are never destroyed, so
+    /// that the zones of threads which exited can still be exported.
+    static std::vector<std::unique_ptr<Track>> _tracks;
+
+public:
+    /// @brief Enable or disable the recording of zones.
+    ///
+    /// @param enabled Whether zones should be recorded.
+    static void SetEnabled(const bool enabled);
+
+    /// @brief Tell whether zones are being recorded.
+    ///
+    /// @return Whether zones are being recorded.
+    static bool Enabled();
+
+    /// @brief Get the track of the calling thread, creating it on first
+    /// use.
+    ///
+    /// @return A reference to the track of the calling thread.
+    static Track& ThreadTrack();
+
+    /// @brief Create a track which is not tied to a thread, such as one to
+    /// record GPU timings to.
+    ///
+    /// @param name Name under which the track is exported.
+    ///
+    /// @return A reference to the new track.
+    static Track& CreateTrack(const std::string& name);
+
+    /// @brief Discard all zones recorded so far. May be called while zones
+    /// are being recorded.
+    static void Clear();
+
+    /// @brief Write the zones held by all tracks to a file, in the Chrome
+    /// trace event format. That is, the latest TrackCapacity zones of each
+    /// track recorded since the last clear. May be called while zones are
+    /// being recorded.
+    ///
+    /// @param path Path to the file to write.
+    ///
+    /// @exception If the file cannot be written, the function will throw a
+    /// std::runtime_error.
+    static void ExportChromeTrace(const std::filesystem::path& path);
+};
+
+/// @brief Records the time elapsed between its construction and its
+/// destruction as a zone on the track of the calling thread.
+class ProfilerScope
+{
+private:
+    /// @brief Name of the zone.
+    const char* _name;
+
+    /// @brief Point in time at which the zone started, or the epoch if the
+    /// profiler was disabled at construction.
+    Profiler::Clock::time_point _start;
+
+public:
+    /// @param name Name of the zone. Must have static storage duration.
+    ProfilerScope(const char* name);
+
+    ~ProfilerScope();
+
+    ProfilerScope(const ProfilerScope& other) = delete;
+    ProfilerScope& operator=(const ProfilerScope& other) = delete;
+};
+
+}//namespace Renderboi
+
+#define RB_PROFILE_CONCAT_IMPL(a, b) a##b
+#define RB_PROFILE_CONCAT(a, b) RB_PROFILE_CONCAT_IMPL(a, b)
+
+#ifdef RENDERBOI_PROFILING
+    /// @brief Record the rest of the enclosing scope as a zone of the
+    /// provided name (a string litteral).
+    #define RB_PROFILE_ZONE(name) ::Renderboi::ProfilerScope RB_PROFILE_CONCAT(_rbProfilerScope, __LINE__)(name)
+#else
+    #define RB_PROFILE_ZONE(name) ((void)0)
+#endif
+
+#endif//RENDERBOI__UTILITIES__PROFILER_HPP
@@ -0,0 +1,108 @@
+#ifndef RENDERBOI__UTILITIES__SEQLOCK_HPP
+#define RENDERBOI__UTILITIES__SEQLOCK_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace Renderboi
+{
+
+/// @brief Holds a value written by exactly one writer thread and read by any
+/// amount of reader threads, without locking. Writers never wait; readers
+/// retry in the rare case a write happened while they were copying the
+/// value. The value is stored in relaxed atomic words so that concurrent
+/// copies are well-defined.
+///
+/// @tparam T Type of the value to hold. Must be trivially copyable and
+/// default constructible.
+template<typename T>
+class SeqLock
+{
+    static_assert(std::is_trivially_copyable_v<T>, "SeqLock: value type must be trivially copyable.");
+
+private:
+    /// @brief Type of the words the value is stored in.
+    using Word = std::uint64_t;
+
+    /// @brief How many words are needed to store the value.
+    static constexpr std::size_t WordCount = (sizeof(T) + sizeof(Word) - 1) / sizeof(Word);
+
+    /// @brief Sequence number, odd while a write is in progress.
+    std::atomic<std::uint32_t> _sequence;
+
+    /// @brief Storage for the value.
+    std::atomic<Word> _words[WordCount];
+
+public:
+    /// @param value Value to hold initially.
+    SeqLock(const T& value = T());
+
+    SeqLock(const SeqLock<T>& other) = delete;
+    SeqLock<T>& operator=(const SeqLock<T>& other) = delete;
+
+    /// @brief Replace the value. Must only be called by the writer.
+    ///
+    /// @param value New value to hold.
+    void store(const T& value);
+
+    /// @brief Get a consistent copy of the value. May be called from any
+    /// thread.
+    ///
+    /// @return A copy of the value, as last stored.
+    T load() const;
+};
+
+template<typename T>
+SeqLock<T>::SeqLock(const T& value) :
+    _sequence(0),
+    _words()
+{
+    store(value);
+}
+
+template<typename T>
+void SeqLock<T>::store(const T& value)
+{
+    Word words[WordCount] = {};
+    std::memcpy(words, &value, sizeof(T));
+
+    const std::uint32_t sequence = _sequence.load(std::memory_order_relaxed);
+    _sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (std::size_t i = 0; i < WordCount; i++)
+    {
+        _words[i].store(words[i], std::memory_order_relaxed);
+    }
+
+    _sequence.store(sequence + 2, std::memory_order_release);
+}
+
+template<typename T>
+T SeqLock<T>::load() const
+{
+    Word words[WordCount];
+    std::uint32_t before, after;
+    do
+    {
+        before = _sequence.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i < WordCount; i++)
+        {
+            words[i] = _words[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        after = _sequence.load(std::memory_order_relaxed);
+    }
+    while ((before & 1) || before != after);
+
+    T value;
+    std::memcpy(&value, words, sizeof(T));
+    return value;
+}
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__UTILITIES__SEQLOCK_HPP
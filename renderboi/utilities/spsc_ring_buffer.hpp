@@ -0,0 +1,161 @@
+#ifndef RENDERBOI__UTILITIES__SPSC_RING_BUFFER_HPP
+#define RENDERBOI__UTILITIES__SPSC_RING_BUFFER_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace Renderboi
+{
+
+/// @brief Bounded lock-free queue, safe to use from exactly one producer
+/// thread and exactly one consumer thread at the same time.
+///
+/// @tparam T Type of the elements to queue. Must be default constructible
+/// and copy assignable.
+/// @tparam Capacity Maximum amount of elements the queue can hold. Must be
+/// a power of two.
+template<typename T, std::size_t Capacity>
+class SpscRingBuffer
+{
+    static_assert(Capacity && !(Capacity & (Capacity - 1)), "SpscRingBuffer: capacity must be a power of two.");
+
+private:
+    /// @brief Size of a cache line, used to keep data written by the
+    /// producer and data written by the consumer apart.
+    static constexpr std::size_t CacheLineSize = 64;
+
+    /// @brief Mask turning a position into an index in the buffer.
+    static constexpr std::size_t IndexMask = Capacity - 1;
+
+    /// @brief Storage for the queued elements.
+    std::array<T, Capacity> _buffer;
+
+    // Each side only writes to its own cache line: the consumer writes the
+    // head and its cached tail, the producer writes the tail and its cached
+    // head.
+
+    /// @brief Position of the next element to pop. Only written by the
+    /// consumer.
+    alignas(CacheLineSize) std::atomic<std::size_t> _head;
+
+    /// @brief Last value of the tail seen by the consumer.
+    std::size_t _cachedTail;
+
+    /// @brief Position of the next element to push. Only written by the
+    /// producer.
+    alignas(CacheLineSize) std::atomic<std::size_t> _tail;
+
+    /// @brief Last value of the head seen by the producer.
+    std::size_t _cachedHead;
+
+public:
+    SpscRingBuffer();
+
+    SpscRingBuffer(const SpscRingBuffer<T, Capacity>& other) = delete;
+    SpscRingBuffer<T, Capacity>& operator=(const SpscRingBuffer<T, Capacity>& other) = delete;
+
+    /// @brief Queue an element. Must only be called by the producer.
+    ///
+    /// @param element The element to queue.
+    ///
+    /// @return Whether the element was queued, false if the queue was full.
+    bool push(const T& element);
+
+    /// @brief Dequeue the oldest element. Must only be called by the
+    /// consumer.
+    ///
+    /// @param element Reference to write the dequeued element to.
+    ///
+    /// @return Whether an element was dequeued, false if the queue was
+    /// empty.
+    bool pop(T& element);
+
+    /// @brief Get a pointer to the oldest element without dequeuing it.
+    /// Must only be called by the consumer.
+    ///
+    /// @return A pointer to the oldest element, nullptr if the queue was
+    /// empty.
+    const T* front();
+
+    /// @brief Get an approximation of how many elements are queued. The
+    /// value may be outdated as soon as it is returned.
+    ///
+    /// @return How many elements are queued.
+    std::size_t size() const;
+
+    /// @brief Get the maximum amount of elements the queue can hold.
+    ///
+    /// @return The maximum amount of elements the queue can hold.
+    static constexpr std::size_t capacity();
+};
+
+template<typename T, std::size_t Capacity>
+SpscRingBuffer<T, Capacity>::SpscRingBuffer() :
+    _buffer(),
+    _head(0),
+    _cachedTail(0),
+    _tail(0),
+    _cachedHead(0)
+{
+
+}
+
+template<typename T, std::size_t Capacity>
+bool SpscRingBuffer<T, Capacity>::push(const T& element)
+{
+    const std::size_t tail = _tail.load(std::memory_order_relaxed);
+
+    // Only reload the head when the queue looks full
+    if (tail - _cachedHead == Capacity)
+    {
+        _cachedHead = _head.load(std::memory_order_acquire);
+        if (tail - _cachedHead == Capacity) return false;
+    }
+
+    _buffer[tail & IndexMask] = element;
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+template<typename T, std::size_t Capacity>
+bool SpscRingBuffer<T, Capacity>::pop(T& element)
+{
+    const T* oldest = front();
+    if (!oldest) return false;
+
+    element = *oldest;
+    _head.store(_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    return true;
+}
+
+template<typename T, std::size_t Capacity>
+const T* SpscRingBuffer<T, Capacity>::front()
+{
+    const std::size_t head = _head.load(std::memory_order_relaxed);
+
+    // Only reload the tail when the queue looks empty
+    if (head == _cachedTail)
+    {
+        _cachedTail = _tail.load(std::memory_order_acquire);
+        if (head == _cachedTail) return nullptr;
+    }
+
+    return &_buffer[head & IndexMask];
+}
+
+template<typename T, std::size_t Capacity>
+std::size_t SpscRingBuffer<T, Capacity>::size() const
+{
+    return _tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire);
+}
+
+template<typename T, std::size_t Capacity>
+constexpr std::size_t SpscRingBuffer<T, Capacity>::capacity()
+{
+    return Capacity;
+}
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__UTILITIES__SPSC_RING_BUFFER_HPP
@@ -0,0 +1,318 @@
+#include "buffered_input_processor.hpp"
+
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include "gl_window.hpp"
+#include "gamepad/gamepad.hpp"
+
+namespace
+{
+
+/// @brief Get the index of a source in an append-only array of sources,
+/// appending it if needed. The last source looked up is cached, so that
+/// the array is only locked when a new source shows up.
+template<typename T>
+unsigned int sourceIndex(
+    const std::shared_ptr<T>& source,
+    std::weak_ptr<T>& last,
+    unsigned int& lastIndex,
+    std::vector<std::weak_ptr<T>>& sources,
+    std::mutex& mutex
+)
+{
+    // Compare control blocks, which stay alive as long as the cached weak
+    // pointer does, so that a new source at a recycled address is told apart
+    if (!last.owner_before(source) && !source.owner_before(last))
+    {
+        return lastIndex;
+    }
+
+    std::unique_lock lock(mutex);
+    unsigned int index = 0;
+    while (index < sources.size() && (sources[index].owner_before(source) || source.owner_before(sources[index])))
+    {
+        index++;
+    }
+    if (index == sources.size())
+    {
+        sources.push_back(source);
+    }
+
+    last = source;
+    lastIndex = index;
+    return index;
+}
+
+/// @brief Get a pointer to a source from its index, or nullptr if the
+/// source was destroyed. The known sources are a copy of the source array,
+/// only refreshed (under lock) when an index is not found in it.
+template<typename T>
+std::shared_ptr<T> resolveSource(
+    const unsigned int index,
+    std::vector<std::weak_ptr<T>>& known,
+    const std::vector<std::weak_ptr<T>>& sources,
+    std::mutex& mutex
+)
+{
+    if (index >= known.size())
+    {
+        std::unique_lock lock(mutex);
+        known = sources;
+    }
+
+    return (index < known.size()) ? known[index].lock() : nullptr;
+}
+
+}//namespace
+
+namespace Renderboi
+{
+
+namespace Window
+{
+
+BufferedInputProcessor::BufferedInputProcessor(const InputProcessorPtr target, const GamepadInputProcessorPtr gamepadTarget) :
+    InputProcessor(),
+    GamepadInputProcessor(),
+    _target(target),
+    _gamepadTarget(gamepadTarget),
+    _windowEvents(),
+    _gamepadEvents(),
+    _droppedEventCount(0),
+    _sourcesMutex(),
+    _windowSources(),
+    _gamepadSources(),
+    _lastWindow(),
+    _lastWindowIndex(0),
+    _lastGamepad(),
+    _lastGamepadIndex(0),
+    _knownWindows(),
+    _knownGamepads(),
+    _currentEventTimestamp()
+{
+    if (!_target)
+    {
+        throw std::runtime_error("BufferedInputProcessor: cannot forward events to null input processor pointer.");
+    }
+}
+
+void BufferedInputProcessor::_record(EventQueue& queue, InputEvent& event)
+{
+    event.timestamp = InputEvent::Clock::now();
+    if (!queue.push(event))
+    {
+        _droppedEventCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+unsigned int BufferedInputProcessor::_windowIndex(const GLWindowPtr window)
+{
+    return sourceIndex(window, _lastWindow, _lastWindowIndex, _windowSources, _sourcesMutex);
+}
+
+unsigned int BufferedInputProcessor::_gamepadIndex(const GamepadPtr gamepad)
+{
+    return sourceIndex(gamepad, _lastGamepad, _lastGamepadIndex, _gamepadSources, _sourcesMutex);
+}
+
+void BufferedInputProcessor::_dispatch(const InputEvent& event)
+{
+    _currentEventTimestamp = event.timestamp;
+
+    GLWindowPtr window = nullptr;
+    GamepadPtr gamepad = nullptr;
+    switch (event.type)
+    {
+        case InputEvent::Type::FramebufferResize:
+        case InputEvent::Type::Keyboard:
+        case InputEvent::Type::MouseButton:
+        case InputEvent::Type::MouseCursor:
+            // Drop events of windows which no longer exist
+            window = resolveSource(event.source, _knownWindows, _windowSources, _sourcesMutex);
+            if (!window) return;
+            break;
+        default:
+            // Drop events of gamepads which no longer exist
+            if (!_gamepadTarget) return;
+            gamepad = resolveSource(event.source, _knownGamepads, _gamepadSources, _sourcesMutex);
+            if (!gamepad) return;
+            break;
+    }
+
+    switch (event.type)
+    {
+        case InputEvent::Type::FramebufferResize:
+            _target->processFramebufferResize(window,
+                event.framebufferResize.width, event.framebufferResize.height);
+            break;
+        case InputEvent::Type::Keyboard:
+            _target->processKeyboard(window,
+                event.keyboard.key, event.keyboard.scancode, event.keyboard.action, event.keyboard.mods);
+            break;
+        case InputEvent::Type::MouseButton:
+            _target->processMouseButton(window,
+                event.mouseButton.button, event.mouseButton.action, event.mouseButton.mods);
+            break;
+        case InputEvent::Type::MouseCursor:
+            _target->processMouseCursor(window,
+                event.mouseCursor.xpos, event.mouseCursor.ypos);
+            break;
+        case InputEvent::Type::GamepadConnected:
+            _gamepadTarget->processConnected(gamepad);
+            break;
+        case InputEvent::Type::GamepadDisconnected:
+            _gamepadTarget->processDisconnected(gamepad);
+            break;
+        case InputEvent::Type::GamepadButton:
+            _gamepadTarget->processButton(gamepad,
+                event.gamepadButton.button, event.gamepadButton.action);
+            break;
+        case InputEvent::Type::GamepadAxis:
+            _gamepadTarget->processAxis(gamepad,
+                event.gamepadAxis.axis, event.gamepadAxis.value);
+            break;
+        case InputEvent::Type::GamepadStateChange:
+            _gamepadTarget->processStateChange(gamepad,
+                event.gamepadStateChange);
+            break;
+    }
+}
+
+unsigned int BufferedInputProcessor::processPendingEvents()
+{
+    // Events captured from now on are left for the next call
+    const InputEvent::Clock::time_point cutoff = InputEvent::Clock::now();
+    unsigned int count = 0;
+
+    InputEvent event;
+    while (true)
+    {
+        const InputEvent* windowEvent = _windowEvents.front();
+        const InputEvent* gamepadEvent = _gamepadEvents.front();
+        if (windowEvent && windowEvent->timestamp > cutoff) windowEvent = nullptr;
+        if (gamepadEvent && gamepadEvent->timestamp > cutoff) gamepadEvent = nullptr;
+
+        // Merge both queues by order of capture
+        if (windowEvent && (!gamepadEvent || windowEvent->timestamp <= gamepadEvent->timestamp))
+        {
+            _windowEvents.pop(event);
+        }
+        else if (gamepadEvent)
+        {
+            _gamepadEvents.pop(event);
+        }
+        else
+        {
+            break;
+        }
+
+        _dispatch(event);
+        count++;
+    }
+
+    return count;
+}
+
+InputEvent::Clock::time_point BufferedInputProcessor::getCurrentEventTimestamp() const
+{
+    return _currentEventTimestamp;
+}
+
+unsigned int BufferedInputProcessor::getDroppedEventCount() const
+{
+    return _droppedEventCount.load(std::memory_order_relaxed);
+}
+
+void BufferedInputProcessor::processFramebufferResize(const GLWindowPtr window, const unsigned int width, const unsigned int height)
+{
+    InputEvent event;
+    event.type = InputEvent::Type::FramebufferResize;
+    event.source = _windowIndex(window);
+    event.framebufferResize = {width, height};
+
+    _record(_windowEvents, event);
+}
+
+void BufferedInputProcessor::processKeyboard(const GLWindowPtr window, const Key key, const int scancode, const Action action, const int mods)
+{
+    InputEvent event;
+    event.type = InputEvent::Type::Keyboard;
+    event.source = _windowIndex(window);
+    event.keyboard = {key, scancode, action, mods};
+
+    _record(_windowEvents, event);
+}
+
+void BufferedInputProcessor::processMouseButton(const GLWindowPtr window, const MButton button, const Action action, const int mods)
+{
+    InputEvent event;
+    event.type = InputEvent::Type::MouseButton;
+    event.source = _windowIndex(window);
+    event.mouseButton = {button, action, mods};
+
+    _record(_windowEvents, event);
+}
+
+void BufferedInputProcessor::processMouseCursor(const GLWindowPtr window, const double xpos, const double ypos)
+{
+    InputEvent event;
+    event.type = InputEvent::Type::MouseCursor;
+    event.source = _windowIndex(window);
+    event.mouseCursor = {xpos, ypos};
+
+    _record(_windowEvents, event);
+}
+
+void BufferedInputProcessor::processConnected(const GamepadPtr gamepad)
+{
+    InputEvent event;
+    event.type = InputEvent::Type::GamepadConnected;
+    event.source = _gamepadIndex(gamepad);
+
+    _record(_gamepadEvents, event);
+}
+
+void BufferedInputProcessor::processDisconnected(const GamepadPtr gamepad)
+{
+    InputEvent event;
+    event.type = InputEvent::Type::GamepadDisconnected;
+    event.source = _gamepadIndex(gamepad);
+
+    _record(_gamepadEvents, event);
+}
+
+void BufferedInputProcessor::processButton(const GamepadPtr gamepad, const GButton button, const Action action)
+{
+    InputEvent event;
+    event.type = InputEvent::Type::GamepadButton;
+    event.source = _gamepadIndex(gamepad);
+    event.gamepadButton = {button, action};
+
+    _record(_gamepadEvents, event);
+}
+
+void BufferedInputProcessor::processAxis(const GamepadPtr gamepad, const Axis axis, const float value)
+{
+    InputEvent event;
+    event.type = InputEvent::Type::GamepadAxis;
+    event.source = _gamepadIndex(gamepad);
+    event.gamepadAxis = {axis, value};
+
+    _record(_gamepadEvents, event);
+}
+
+void BufferedInputProcessor::processStateChange(const GamepadPtr gamepad, const GamepadStateChange& change)
+{
+    InputEvent event;
+    event.type = InputEvent::Type::GamepadStateChange;
+    event.source = _gamepadIndex(gamepad);
+    event.gamepadStateChange = change;
+
+    _record(_gamepadEvents, event);
+}
+
+}//namespace Window
+
+}//namespace Renderboi
@@ -0,0 +1,255 @@
+#ifndef RENDERBOI__WINDOW__BUFFERED_INPUT_PROCESSOR_HPP
+#define RENDERBOI__WINDOW__BUFFERED_INPUT_PROCESSOR_HPP
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <renderboi/utilities/spsc_ring_buffer.hpp>
+
+#include "input_processor.hpp"
+#include "event/input_event.hpp"
+#include "gamepad/gamepad_input_processor.hpp"
+
+namespace Renderboi
+{
+
+namespace Window
+{
+
+/// @brief Input processor which does not process input right away, but
+/// records it as timestamped events to be forwarded later on, to other
+/// input processors, from another thread. Window events and gamepad events
+/// are each recorded in their own lock-free queue, so that they may be
+/// captured from two different threads. Events are then forwarded from a
+/// single thread, in the order they were captured.
+///
+/// @note Events whose window or gamepad was destroyed by the time they are
+/// forwarded are discarded, as are events still pending when the buffered
+/// input processor is destroyed.
+class BufferedInputProcessor : public InputProcessor, public GamepadInputProcessor
+{
+public:
+    /// @brief Maximum amount of events of either kind which can be pending
+    /// at the same time. Events captured past that amount are dropped.
+    static constexpr unsigned int Capacity = 1024;
+
+private:
+    using Key = Input::Key;
+    using MButton = Input::MouseButton;
+    using GButton = Input::Gamepad::Button;
+    using Axis = Input::Gamepad::Axis;
+    using Action = Input::Action;
+    using EventQueue = SpscRingBuffer<InputEvent, Capacity>;
+
+    /// @brief Input processor to which window events are forwarded.
+    InputProcessorPtr _target;
+
+    /// @brief Input processor to which gamepad events are forwarded.
+    GamepadInputProcessorPtr _gamepadTarget;
+
+    /// @brief Pending window events.
+    EventQueue _windowEvents;
+
+    /// @brief Pending gamepad events.
+    EventQueue _gamepadEvents;
+
+    /// @brief How many events were dropped because their queue was full.
+    std::atomic<unsigned int> _droppedEventCount;
+
+    /// @brief Guards the arrays of sources.
+    std::mutex _sourcesMutex;
+
+    /// @brief Windows which triggered recorded events, which refer to them
+    /// by index. Only ever appended to.
+    std::vector<std::weak_ptr<GLWindow>> _windowSources;
+
+    /// @brief Gamepads which triggered recorded events, which refer to them
+    /// by index. Only ever appended to.
+    std::vector<std::weak_ptr<Gamepad>> _gamepadSources;
+
+    /// @brief Last window which triggered an event, and its index, so that
+    /// the thread capturing window events only looks up new windows.
+    std::weak_ptr<GLWindow> _lastWindow;
+    unsigned int _lastWindowIndex;
+
+    /// @brief Last gamepad which triggered an event, and its index, so that
+    /// the thread capturing gamepad events only looks up new gamepads.
+    std::weak_ptr<Gamepad> _lastGamepad;
+    unsigned int _lastGamepadIndex;
+
+    /// @brief Copy of the window sources, for the forwarding thread to
+    /// resolve events without locking.
+    std::vector<std::weak_ptr<GLWindow>> _knownWindows;
+
+    /// @brief Copy of the gamepad sources, for the forwarding thread to
+    /// resolve events without locking.
+    std::vector<std::weak_ptr<Gamepad>> _knownGamepads;
+
+    /// @brief Timestamp of the event being forwarded, or of the last event
+    /// which was forwarded.
+    InputEvent::Clock::time_point _currentEventTimestamp;
+
+    /// @brief Record an event in a queue, or drop it if the queue is full.
+    ///
+    /// @param queue Queue in which to record the event.
+    /// @param event Event to record. Its timestamp is set by this function.
+    void _record(EventQueue& queue, InputEvent& event);
+
+    /// @brief Get the index under which a window is known to the processor,
+    /// making it known if needed. Must only be called by the thread
+    /// capturing window events.
+    ///
+    /// @param window Pointer to the window to get the index of.
+    ///
+    /// @return The index of the window.
+    unsigned int _windowIndex(const GLWindowPtr window);
+
+    /// @brief Get the index under which a gamepad is known to the
+    /// processor, making it known if needed. Must only be called by the
+    /// thread capturing gamepad events.
+    ///
+    /// @param gamepad Pointer to the gamepad to get the index of.
+    ///
+    /// @return The index of the gamepad.
+    unsigned int _gamepadIndex(const GamepadPtr gamepad);
+
+    /// @brief Forward an event to the relevant target, unless its window or
+    /// gamepad was destroyed.
+    ///
+    /// @param event Event to forward.
+    void _dispatch(const InputEvent& event);
+
+public:
+    /// @param target Input processor to which window events will be
+    /// forwarded.
+    /// @param gamepadTarget Input processor to which gamepad events will be
+    /// forwarded. If null, gamepad events are discarded.
+    ///
+    /// @exception If the provided input processor pointer is null, the
+    /// function will throw a std::runtime_error.
+    BufferedInputProcessor(const InputProcessorPtr target, const GamepadInputProcessorPtr gamepadTarget = nullptr);
+
+    BufferedInputProcessor(const BufferedInputProcessor& other) = delete;
+    BufferedInputProcessor& operator=(const BufferedInputProcessor& other) = delete;
+
+    /// @brief Forward all events which were captured before the call, in
+    /// the order they were captured. Events captured while this function
+    /// runs are left for the next call. Must always be called from the
+    /// same thread.
+    ///
+    /// @return How many events were forwarded.
+    unsigned int processPendingEvents();
+
+    /// @brief Get the timestamp of the event being forwarded. Meant to be
+    /// called by target input processors from within their callbacks.
+    ///
+    /// @return The point in time at which the event being forwarded was
+    /// captured.
+    InputEvent::Clock::time_point getCurrentEventTimestamp() const;
+
+    /// @brief Get how many events were dropped because too many events
+    /// were pending.
+    ///
+    /// @return How many events were dropped.
+    unsigned int getDroppedEventCount() const;
+
+    //////////////////////////////////////////////
+    ///                                        ///
+    /// Methods overridden from InputProcessor ///
+    ///                                        ///
+    //////////////////////////////////////////////
+
+    /// @brief Callback for a framebuffer resize event.
+    ///
+    /// @param window Pointer to the GLWindow in which the event was
+    /// triggered.
+    /// @param width New width (in pixels) of the framebuffer.
+    /// @param height New height (in pixels) of the framebuffer.
+    void processFramebufferResize(const GLWindowPtr window, const unsigned int width, const unsigned int height) override;
+
+    /// @brief Callback for a keyboard event.
+    ///
+    /// @param window Pointer to the GLWindow in which the event was
+    /// triggered.
+    /// @param key Literal describing which key triggered the event.
+    /// @param scancode Scancode of the key which triggered the event.
+    /// Platform-dependent, but consistent over time.
+    /// @param action Literal describing what action was performed on
+    /// the key which triggered the event.
+    /// @param mods Bit field describing which modifiers were enabled
+    /// during the key event (Ctrl, Shift, etc).
+    void processKeyboard(
+        const GLWindowPtr window,
+        const Key key,
+        const int scancode,
+        const Action action,
+        const int mods
+    ) override;
+
+    /// @brief Callback for a mouse button event.
+    ///
+    /// @param window Pointer to the GLWindow in which the event was
+    /// triggered.
+    /// @param button Literal describing which button triggered the
+    /// event.
+    /// @param action Literal describing what action was performed on
+    /// the button which triggered the event.
+    /// @param mods Bit field describing which modifiers were enabled
+    /// during the button event (Ctrl, Shift, etc).
+    void processMouseButton(
+        const GLWindowPtr window,
+        const MButton button,
+        const Action action,
+        const int mods
+    ) override;
+
+    /// @brief Callback for a mouse cursor event.
+    ///
+    /// @param window Pointer to the GLWindow in which the event was
+    /// triggered.
+    /// @param xpos X coordinate of the new position of the mouse.
+    /// @param ypos Y coordinate of the new position of the mouse.
+    void processMouseCursor(const GLWindowPtr window, const double xpos, const double ypos) override;
+
+    /////////////////////////////////////////////////////
+    ///                                               ///
+    /// Methods overridden from GamepadInputProcessor ///
+    ///                                               ///
+    /////////////////////////////////////////////////////
+
+    /// @brief Callback for when the gamepad is connected.
+    void processConnected(const GamepadPtr gamepad) override;
+
+    /// @brief Callback for when the gamepad is disconnected.
+    void processDisconnected(const GamepadPtr gamepad) override;
+
+    /// @brief Callback for a gamepad button event.
+    ///
+    /// @param button Literal describing which key triggered the event.
+    /// @param action Literal describing what action was performed on
+    /// the button which triggered the event.
+    void processButton(const GamepadPtr gamepad, const GButton button, const Action action) override;
+
+    /// @brief Callback for a gamepad axis event.
+    ///
+    /// @param axis Literal describing which axis triggered the event.
+    /// @param value Value at which the axis was polled.
+    void processAxis(const GamepadPtr gamepad, const Axis axis, const float value) override;
+
+    /// @brief Callback for all the button and axis events of a single poll
+    /// of the gamepad. Recorded as a single event.
+    ///
+    /// @param change Record of the changes in the state of the gamepad.
+    void processStateChange(const GamepadPtr gamepad, const GamepadStateChange& change) override;
+};
+
+}//namespace Window
+
+using BufferedInputProcessor = Window::BufferedInputProcessor;
+using BufferedInputProcessorPtr = std::shared_ptr<BufferedInputProcessor>;
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__WINDOW__BUFFERED_INPUT_PROCESSOR_HPP
@@ -0,0 +1,62 @@
+#include "egl_gamepad_manager.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+#include <renderboi/utilities/to_string.hpp>
+
+namespace Renderboi::Window
+{
+
+EGLGamepadManager::EGLGamepadManager() :
+    GamepadManager()
+{
+
+}
+
+void EGLGamepadManager::gamepadConnected(Joystick slot) const
+{
+
+}
+
+void EGLGamepadManager::gamepadDisconnected(Joystick slot) const
+{
+
+}
+
+std::vector<Window::Input::Joystick> EGLGamepadManager::pollPresentGamepads(bool mustBeUnused) const
+{
+    return std::vector<Window::Input::Joystick>();
+}
+
+GamepadPtr EGLGamepadManager::getGamepad(Window::Input::Joystick slot)
+{
+    throw std::runtime_error("EGLGamepadManager: no gamepad on slot " + to_string(slot) + ".");
+}
+
+void EGLGamepadManager::startGamepadPolling(Window::Input::Joystick slot) const
+{
+
+}
+
+void EGLGamepadManager::stopGamepadPolling(Window::Input::Joystick slot) const
+{
+
+}
+
+void EGLGamepadManager::refreshGamepadStatuses() const
+{
+
+}
+
+void EGLGamepadManager::pollGamepadStates() const
+{
+
+}
+
+bool EGLGamepadManager::supportsSamplingThread() const
+{
+    return true;
+}
+
+}//namespace Renderboi::Window
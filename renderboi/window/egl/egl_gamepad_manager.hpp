@@ -0,0 +1,86 @@
+#ifndef RENDERBOI__WINDOW__EGL__EGL_GAMEPAD_MANAGER_HPP
+#define RENDERBOI__WINDOW__EGL__EGL_GAMEPAD_MANAGER_HPP
+
+#include <vector>
+
+#include "../enums.hpp"
+#include "../gamepad/gamepad_manager.hpp"
+
+namespace Renderboi::Window
+{
+
+/// @brief Gamepad manager of headless windows. No gamepad is ever reported
+/// as present, since there is no input device to read from.
+class EGLGamepadManager : public GamepadManager
+{
+private:
+    using Joystick = Input::Joystick;
+
+public:
+    EGLGamepadManager();
+
+    //////////////////////////////////////////////
+    ///                                        ///
+    /// Methods overridden from GamepadManager ///
+    ///                                        ///
+    //////////////////////////////////////////////
+
+    /// @brief Callback for when a gamepad is connected on a slot. Does
+    /// nothing.
+    /// 
+    /// @param slot Litteral describing the slot on which the gamepad was
+    /// connected.
+    void gamepadConnected(Joystick slot) const override;
+
+    /// @brief Callback for when a gamepad is disconnected from a slot. Does
+    /// nothing.
+    /// 
+    /// @param slot Litteral describing the slot from which the gamepad was
+    /// disconnected.
+    void gamepadDisconnected(Joystick slot) const override;
+
+    /// @brief Get an array filled with litterals representing handles to
+    /// present gamepads.
+    ///
+    /// @param mustBeUnused Whether to return all present gamepads or only those
+    /// not already in use by the window.
+    ///
+    /// @return An empty array.
+    std::vector<Joystick> pollPresentGamepads(bool mustBeUnused = true) const override;
+
+    /// @brief Get a gamepad plugged into a certain slot.
+    ///
+    /// @param slot Virtual slot on which to find the controller to manage.
+    ///
+    /// @return A pointer to the newly managed gamepad.
+    ///
+    /// @exception No gamepad is ever present, the function will always throw
+    /// a std::runtime_error.
+    GamepadPtr getGamepad(Joystick slot) override;
+
+    /// @brief Enable polling the state for a gamepad. Does nothing.
+    ///
+    /// @param slot Virtual slot on which to find the controller to start polling.
+    void startGamepadPolling(Joystick slot) const override;
+
+    /// @brief Disable polling the state for a gamepad. Does nothing.
+    ///
+    /// @param slot Virtual slot on which to find the controller to stop polling.
+    void stopGamepadPolling(Joystick slot) const override;
+
+    /// @brief Process any pending gamepad connection event. Does nothing.
+    void refreshGamepadStatuses() const override;
+
+    /// @brief Poll the state for gamepads. Does nothing.
+    void pollGamepadStates() const override;
+
+    /// @brief Tell whether gamepads may be sampled from a thread dedicated to
+    /// it.
+    ///
+    /// @return True.
+    bool supportsSamplingThread() const override;
+};
+
+}//namespace Renderboi::Window
+
+#endif//RENDERBOI__WINDOW__EGL__EGL_GAMEPAD_MANAGER_HPP
@@ -0,0 +1,318 @@
+#include "egl_window.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <glad/gl.h>
+#define EGL_NO_X11
+#include <EGL/egl.h>
+#undef EGL_NO_X11
+
+#include "../enums.hpp"
+#include "egl_gamepad_manager.hpp"
+#include "egl_window_factory.hpp"
+
+namespace Renderboi::Window
+{
+
+using EGLWindowFactory = WindowFactory<WindowBackend::EGL>;
+
+EGLWindow::EGLWindow(
+    EGLDisplay display,
+    EGLContext context,
+    EGLSurface surface,
+    const int width,
+    const int height,
+    std::string title
+) :
+    GLWindow(title),
+    _display(display),
+    _context(context),
+    _surface(surface),
+    _width(width),
+    _height(height),
+    _shouldClose(false),
+    _framebuffer(0),
+    _colorBuffer(0),
+    _depthStencilBuffer(0),
+    _eventMutex(),
+    _eventPosted(),
+    _emptyEventPosted(false)
+{
+    _gamepadManager = std::static_pointer_cast<GamepadManager>(std::make_shared<EGLGamepadManager>());
+}
+
+EGLWindow::~EGLWindow()
+{
+
+}
+
+EGLContext EGLWindow::getContext() const
+{
+    return _context;
+}
+
+GLuint EGLWindow::getFramebuffer() const
+{
+    return _framebuffer;
+}
+
+void EGLWindow::setSize(const int width, const int height)
+{
+    _width = width;
+    _height = height;
+
+    if (_framebuffer) _allocateFramebufferStorage();
+    processFramebufferResize(width, height);
+}
+
+void EGLWindow::readPixels(std::vector<unsigned char>& pixels) const
+{
+    static constexpr size_t Channels = 4;
+    const size_t rowSize = Channels * _width;
+    pixels.resize(rowSize * _height);
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, _framebuffer);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, _width, _height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+
+    // GL rows go from the bottom up, flip them
+    std::vector<unsigned char> row(rowSize);
+    for (int i = 0; i < _height / 2; i++)
+    {
+        unsigned char* top = pixels.data() + i * rowSize;
+        unsigned char* bottom = pixels.data() + (_height - 1 - i) * rowSize;
+        std::memcpy(row.data(), top, rowSize);
+        std::memcpy(top, bottom, rowSize);
+        std::memcpy(bottom, row.data(), rowSize);
+    }
+}
+
+void EGLWindow::setTitle(std::string title)
+{
+    _title = title;
+}
+
+void EGLWindow::setInputMode(Window::Input::Mode::Target target, Window::Input::Mode::Value value)
+{
+
+}
+
+void EGLWindow::hide()
+{
+
+}
+
+void EGLWindow::show()
+{
+
+}
+
+bool EGLWindow::isVisible() const
+{
+    return false;
+}
+
+void EGLWindow::focus()
+{
+
+}
+
+bool EGLWindow::isFocused() const
+{
+    return false;
+}
+
+void EGLWindow::maximize()
+{
+
+}
+
+bool EGLWindow::isMaximized() const
+{
+    return false;
+}
+
+void EGLWindow::minimize()
+{
+
+}
+
+bool EGLWindow::isMinimized() const
+{
+    return false;
+}
+
+void EGLWindow::getSize(int& width, int& height) const
+{
+    width = _width;
+    height = _height;
+}
+
+void EGLWindow::getFramebufferSize(int& width, int& height) const
+{
+    width = _width;
+    height = _height;
+}
+
+void EGLWindow::goFullscreen(MonitorPtr monitor, bool borderless)
+{
+
+}
+
+void EGLWindow::goFullscreen(MonitorPtr monitor, int width, int height, int refreshRate)
+{
+
+}
+
+bool EGLWindow::isFullscreen() const
+{
+    return false;
+}
+
+void EGLWindow::exitFullscreen()
+{
+
+}
+
+void EGLWindow::setRefreshRate(int rate)
+{
+
+}
+
+bool EGLWindow::shouldClose() const
+{
+    return _shouldClose;
+}
+
+void EGLWindow::setShouldClose(bool value)
+{
+    _exitSignaled = value;
+    _shouldClose = value;
+    postEmptyEvent();
+}
+
+void EGLWindow::swapBuffers()
+{
+    // Nothing is presented, rendering only needs to be kicked off
+    glFlush();
+}
+
+void EGLWindow::setSwapInterval(const int interval)
+{
+    eglSwapInterval(_display, interval);
+}
+
+void EGLWindow::pollEvents() const
+{
+    std::unique_lock lock(_eventMutex);
+    _emptyEventPosted = false;
+}
+
+void EGLWindow::waitEvents(const double timeout) const
+{
+    std::unique_lock lock(_eventMutex);
+    if (timeout < 0.0)
+    {
+        _eventPosted.wait(lock, [this]() { return _emptyEventPosted; });
+    }
+    else if (timeout > 0.0)
+    {
+        _eventPosted.wait_for(lock, std::chrono::duration<double>(timeout), [this]() { return _emptyEventPosted; });
+    }
+    _emptyEventPosted = false;
+}
+
+void EGLWindow::postEmptyEvent() const
+{
+    {
+        std::unique_lock lock(_eventMutex);
+        _emptyEventPosted = true;
+    }
+    _eventPosted.notify_all();
+}
+
+float EGLWindow::getAspectRatio() const
+{
+    return (float)_width / (float)_height;
+}
+
+void EGLWindow::getCursorPos(double& x, double& y) const
+{
+    x = 0.0;
+    y = 0.0;
+}
+
+void EGLWindow::makeContextCurrent(GLContextClientPtr context)
+{
+    if (!eglMakeCurrent(_display, _surface, _surface, _context))
+    {
+        throw std::runtime_error("EGLWindow: Failed to make context current.");
+    }
+
+    // Load GL pointers
+    if (!gladLoadGLLoader((GLADloadproc)eglGetProcAddress))
+    {
+        throw std::runtime_error("EGLWindow: Failed to load GL function pointers.");
+    }
+
+    if (!_framebuffer) _setupFramebuffer();
+    glBindFramebuffer(GL_FRAMEBUFFER, _framebuffer);
+
+    _glContextClient = context;
+}
+
+void EGLWindow::releaseContext()
+{
+    eglMakeCurrent(_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    _glContextClient = nullptr;
+}
+
+bool EGLWindow::extensionSupported(std::string extName)
+{
+    if (EGLWindowFactory::DisplayExtensionSupported(extName)) return true;
+
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (GLint i = 0; i < count; i++)
+    {
+        const char* name = (const char*)glGetStringi(GL_EXTENSIONS, i);
+        if (name && extName == name) return true;
+    }
+
+    return false;
+}
+
+void EGLWindow::_setupFramebuffer()
+{
+    glGenFramebuffers(1, &_framebuffer);
+    glGenRenderbuffers(1, &_colorBuffer);
+    glGenRenderbuffers(1, &_depthStencilBuffer);
+    _allocateFramebufferStorage();
+
+    glBindFramebuffer(GL_FRAMEBUFFER, _framebuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, _colorBuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, _depthStencilBuffer);
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    {
+        throw std::runtime_error("EGLWindow: Render target framebuffer is incomplete.");
+    }
+
+    // Without a surface, the viewport is not initialized to anything useful
+    glViewport(0, 0, _width, _height);
+}
+
+void EGLWindow::_allocateFramebufferStorage()
+{
+    glBindRenderbuffer(GL_RENDERBUFFER, _colorBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, _width, _height);
+    glBindRenderbuffer(GL_RENDERBUFFER, _depthStencilBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, _width, _height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+}
+
+}//namespace Renderboi::Window
@@ -0,0 +1,295 @@
+#ifndef RENDERBOI__WINDOW__EGL__EGL_WINDOW_HPP
+#define RENDERBOI__WINDOW__EGL__EGL_WINDOW_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#define EGL_NO_X11
+#include <EGL/egl.h>
+#undef EGL_NO_X11
+
+#include <glad/gl.h>
+
+#include "../window_backend.hpp"
+#include "../gl_window.hpp"
+
+namespace Renderboi::Window
+{
+
+template<WindowBackend W>
+class WindowFactory;
+
+/// @brief Headless window, backed by an EGL context which is not tied to
+/// any display. Rendering goes to a framebuffer object owned by the window,
+/// which is bound as the draw and read framebuffer whenever the context is
+/// made current, and whose contents can be read back to memory. This allows
+/// the renderer to run unchanged on machines without a display server.
+class EGLWindow : public GLWindow
+{
+private:
+    friend WindowFactory<WindowBackend::EGL>;
+
+    /// @brief Display the context was created on.
+    EGLDisplay _display;
+
+    /// @brief Context of the window.
+    EGLContext _context;
+
+    /// @brief Pbuffer surface to make current along with the context, or
+    /// EGL_NO_SURFACE if surfaceless contexts are supported.
+    EGLSurface _surface;
+
+    /// @brief Width of the render target in pixels.
+    int _width;
+
+    /// @brief Height of the render target in pixels.
+    int _height;
+
+    /// @brief Whether the window was flagged for closing.
+    std::atomic<bool> _shouldClose;
+
+    /// @brief Handle to the framebuffer object used as the render target,
+    /// or 0 if it was not created yet.
+    GLuint _framebuffer;
+
+    /// @brief Handle to the color attachment of the framebuffer.
+    GLuint _colorBuffer;
+
+    /// @brief Handle to the depth and stencil attachment of the framebuffer.
+    GLuint _depthStencilBuffer;
+
+    /// @brief Mutex protecting the empty event flag.
+    mutable std::mutex _eventMutex;
+
+    /// @brief Condition signaled when an empty event is posted.
+    mutable std::condition_variable _eventPosted;
+
+    /// @brief Whether an empty event was posted and not processed yet.
+    mutable bool _emptyEventPosted;
+
+    /// @brief Create the framebuffer object and its attachments. The context
+    /// must be current on the calling thread.
+    ///
+    /// @exception If the framebuffer is incomplete, the function will throw
+    /// a std::runtime_error.
+    void _setupFramebuffer();
+
+    /// @brief Allocate the storage of the attachments of the framebuffer
+    /// to the size of the window. The context must be current on the
+    /// calling thread.
+    void _allocateFramebufferStorage();
+
+public:
+    /// @param display Display the context was created on.
+    /// @param context Context to be used by the window.
+    /// @param surface Pbuffer surface to make current along with the
+    /// context, or EGL_NO_SURFACE.
+    /// @param width Width of the render target in pixels.
+    /// @param height Height of the render target in pixels.
+    /// @param title Title to give the window.
+    EGLWindow(
+        EGLDisplay display,
+        EGLContext context,
+        EGLSurface surface,
+        const int width,
+        const int height,
+        std::string title
+    );
+    ~EGLWindow();
+
+    /// @brief Get the EGL context of the window.
+    ///
+    /// @return The EGL context of the window.
+    EGLContext getContext() const;
+
+    /// @brief Get the handle to the framebuffer object rendered to, which
+    /// is 0 until the context was first made current.
+    ///
+    /// @return The handle to the framebuffer object rendered to.
+    GLuint getFramebuffer() const;
+
+    /// @brief Resize the render target, discarding its contents. The context
+    /// must be current on the calling thread.
+    ///
+    /// @param width New width of the render target in pixels.
+    /// @param height New height of the render target in pixels.
+    void setSize(const int width, const int height);
+
+    /// @brief Read the contents of the render target back to memory. The
+    /// context must be current on the calling thread, and the call blocks
+    /// until rendering is done.
+    ///
+    /// @param[out] pixels Will receive the RGBA pixels of the render target,
+    /// 8 bits per channel, from the top row to the bottom row.
+    void readPixels(std::vector<unsigned char>& pixels) const;
+
+    ////////////////////////////////////////
+    ///                                  ///
+    /// Methods overridden from GLWindow ///
+    ///                                  ///
+    ////////////////////////////////////////
+
+    /// @brief Set the title of the window.
+    ///
+    /// @return The title of the window.
+    void setTitle(std::string title) override;
+
+    /// @brief Set the input mode of a certain target in the window. Does
+    /// nothing.
+    ///
+    /// @param target Literal describing which aspect of the window whose
+    /// input mode should be set.
+    /// @param value Literal describing which input to set the target to.
+    void setInputMode(Window::Input::Mode::Target target, Window::Input::Mode::Value value) override;
+
+    /// @brief Hide the window. Does nothing.
+    void hide() override;
+
+    /// @brief Show the window. Does nothing.
+    void show() override;
+
+    /// @brief Whether the window is visible.
+    ///
+    /// @return False, a headless window is never visible.
+    bool isVisible() const override;
+
+    /// @brief Bring focus to the window. Does nothing.
+    void focus() override;
+
+    /// @brief Whether the window is focused.
+    ///
+    /// @return False, a headless window is never focused.
+    bool isFocused() const override;
+
+    /// @brief Maximize the window. Does nothing.
+    void maximize() override;
+
+    /// @brief Whether or not the window is maximized.
+    ///
+    /// @return False, a headless window is never maximized.
+    bool isMaximized() const override;
+
+    /// @brief Minimize the window. Does nothing.
+    void minimize() override;
+
+    /// @brief Whether or not the window is minimized.
+    ///
+    /// @return False, a headless window is never minimized.
+    bool isMinimized() const override;
+
+    /// @brief Retrieve the width and height of the render target in pixels.
+    ///
+    /// @param[out] width Will receive the width of the window.
+    /// @param[out] height Will receive the height of the window.
+    void getSize(int& width, int& height) const override;
+
+    /// @brief Retrieve the width and height of the render target in pixels.
+    ///
+    /// @param[out] width Will receive the width of the framebuffer.
+    /// @param[out] height Will receive the height of the framebuffer.
+    void getFramebufferSize(int& width, int& height) const override;
+
+    /// @brief Display the window in fullscreen. Does nothing.
+    ///
+    /// @param monitor Pointer to the monitor on which to make the window go
+    /// fullscreen.
+    /// @param borderless Whether or not to go borderless fullscreen.
+    void goFullscreen(MonitorPtr monitor = nullptr, bool borderless = false) override;
+
+    /// @brief Display the window in fullscreen. Does nothing.
+    ///
+    /// @param monitor Pointer to the monitor on which to make the window go
+    /// fullscreen.
+    /// @param width Desired width of the video mode.
+    /// @param height Desired height of the video mode.
+    /// @param refreshRate Desired refresh rate.
+    void goFullscreen(
+        MonitorPtr monitor = nullptr,
+        int width = -1,
+        int height = -1,
+        int refreshRate = -1
+    ) override;
+
+    /// @brief Whether or not the window is displayed in fullscreen mode.
+    ///
+    /// @return False, a headless window is never fullscreen.
+    bool isFullscreen() const override;
+
+    /// @brief Display the window in windowed mode. Does nothing.
+    void exitFullscreen() override;
+
+    /// @brief Set the refresh rate of a fullscreen window. Does nothing.
+    void setRefreshRate(int rate) override;
+
+    /// @brief Whether the window was flagged for closing.
+    ///
+    /// @return Whether or not the window was flagged for closing.
+    bool shouldClose() const override;
+
+    /// @brief Set the window closing flag.
+    ///
+    /// @param value Whether or not the window should be flagged for closing.
+    void setShouldClose(bool value) override;
+
+    /// @brief Mark the end of a frame, flushing the commands issued to the
+    /// render target.
+    void swapBuffers() override;
+
+    /// @brief Set how many screen refreshes to wait for before swapping the
+    /// front and back buffers of the window.
+    ///
+    /// @param interval How many screen refreshes to wait for.
+    void setSwapInterval(const int interval) override;
+
+    /// @brief Poll events recorded by the window. Does nothing, as no events
+    /// are ever recorded.
+    void pollEvents() const override;
+
+    /// @brief Wait for an empty event to be posted, or for a timeout to
+    /// elapse.
+    ///
+    /// @param timeout Maximum time (in seconds) to wait for. If negative,
+    /// wait for as long as no event is posted.
+    void waitEvents(const double timeout) const override;
+
+    /// @brief Post an empty event, waking up the thread waiting for events.
+    void postEmptyEvent() const override;
+    
+    /// @brief Get the aspect ratio of the render target.
+    ///
+    /// @return The aspect ratio of the render target.
+    float getAspectRatio() const override;
+
+    /// @brief Get position of the mouse cursor in the window.
+    ///
+    /// @param x [Output parameter] Will receive 0.
+    /// @param y [Output parameter] Will receive 0.
+    void getCursorPos(double& x, double& y) const override;
+
+    /// @brief Make the GL context current for the calling thread, and bind
+    /// the render target of the window. May be called from any thread.
+    ///
+    /// @exception If the context could not be made current, if the GL
+    /// function pointers could not be loaded or if the render target could
+    /// not be created, the function will throw a std::runtime_error.
+    void makeContextCurrent(GLContextClientPtr context) override;
+
+    /// @brief Make the GL context non- current for the calling thread. May be 
+    /// called from any thread.
+    void releaseContext() override;
+
+    /// @brief Tell whether the GL context or the EGL display supports a
+    /// certain extension. A GL context must be current on the calling thread.
+    ///
+    /// @param extName String containing the name of the extension to query.
+    bool extensionSupported(std::string extName);
+};
+
+using EGLWindowPtr = std::shared_ptr<EGLWindow>;
+
+}//namespace Renderboi::Window
+
+#endif//RENDERBOI__WINDOW__EGL__EGL_WINDOW_HPP
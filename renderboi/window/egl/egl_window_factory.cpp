@@ -0,0 +1,245 @@
+#include "egl_window_factory.hpp"
+
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <glad/gl.h>
+#define EGL_NO_X11
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#undef EGL_NO_X11
+
+#include "../enums.hpp"
+#include "../gl_window.hpp"
+#include "../window_backend.hpp"
+#include "../window_factory.hpp"
+#include "../window_creation_parameters.hpp"
+
+#include "egl_window.hpp"
+
+namespace Renderboi::Window
+{
+
+EGLDisplay WindowFactory<WindowBackend::EGL>::_display = EGL_NO_DISPLAY;
+
+bool WindowFactory<WindowBackend::EGL>::_surfacelessSupported = false;
+
+WindowFactory<WindowBackend::EGL>::ErrorCallbackSignature
+WindowFactory<WindowBackend::EGL>::_errorCallback = WindowFactory<WindowBackend::EGL>::GlobalEglErrorCallback;
+
+void WindowFactory<WindowBackend::EGL>::GlobalEglErrorCallback(const int error, const char* description)
+{
+    std::cerr << "EGL error: 0x" << std::hex << error << std::dec << ", \"" << description << "\"" << std::endl;
+}
+
+int WindowFactory<WindowBackend::EGL>::InitializeBackend()
+{
+    _display = _GetDisplay();
+    if (_display == EGL_NO_DISPLAY)
+    {
+        _ReportError("no EGL display available");
+        return 0;
+    }
+
+    EGLint major, minor;
+    if (!eglInitialize(_display, &major, &minor))
+    {
+        _ReportError("failed to initialize EGL display");
+        _display = EGL_NO_DISPLAY;
+        return 0;
+    }
+
+    if (!eglBindAPI(EGL_OPENGL_API))
+    {
+        _ReportError("OpenGL API not supported by EGL display");
+        eglTerminate(_display);
+        _display = EGL_NO_DISPLAY;
+        return 0;
+    }
+
+    _surfacelessSupported = DisplayExtensionSupported("EGL_KHR_surfaceless_context");
+
+    return 1;
+}
+
+void WindowFactory<WindowBackend::EGL>::TerminateBackend()
+{
+    if (_display == EGL_NO_DISPLAY) return;
+
+    eglTerminate(_display);
+    eglReleaseThread();
+    _display = EGL_NO_DISPLAY;
+}
+
+void WindowFactory<WindowBackend::EGL>::SetErrorCallback(const void* callback)
+{
+    _errorCallback = callback ? (ErrorCallbackSignature)callback : GlobalEglErrorCallback;
+}
+
+MonitorPtr WindowFactory<WindowBackend::EGL>::GetPrimaryMonitor()
+{
+    // Headless, no monitors
+    return nullptr;
+}
+
+std::map<unsigned int, MonitorPtr> WindowFactory<WindowBackend::EGL>::GetMonitors()
+{
+    return std::map<unsigned int, MonitorPtr>();
+}
+
+void WindowFactory<WindowBackend::EGL>::SetMonitorCallback(const void* callback)
+{
+    // Monitors are never connected, the callback would never be called
+}
+
+Monitor::VideoMode WindowFactory<WindowBackend::EGL>::GetMonitorNativeVideoMode(const MonitorPtr monitor)
+{
+    throw std::runtime_error("WindowFactory<EGL>: headless backend has no monitors, cannot retrieve video mode.");
+}
+
+GLWindowPtr WindowFactory<WindowBackend::EGL>::MakeWindow(const WindowCreationParameters& params)
+{
+    if (_display == EGL_NO_DISPLAY)
+    {
+        throw std::runtime_error("WindowFactory<EGL>: backend was not initialized, cannot create window.");
+    }
+
+    // Rendering goes to a framebuffer object, the config only matters for
+    // the pbuffer used when surfaceless contexts are not supported
+    const EGLint configAttributes[] = {
+        EGL_SURFACE_TYPE,       _surfacelessSupported ? 0 : EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE,    EGL_OPENGL_BIT,
+        EGL_RED_SIZE,           8,
+        EGL_GREEN_SIZE,         8,
+        EGL_BLUE_SIZE,          8,
+        EGL_ALPHA_SIZE,         8,
+        EGL_DEPTH_SIZE,         24,
+        EGL_STENCIL_SIZE,       8,
+        EGL_NONE
+    };
+
+    EGLConfig config;
+    EGLint configCount = 0;
+    if (!eglChooseConfig(_display, configAttributes, &config, 1, &configCount) || configCount == 0)
+    {
+        _ReportError("no matching framebuffer config");
+        throw std::runtime_error("WindowFactory<EGL>: Failed to create window.");
+    }
+
+    // Context attributes
+    std::vector<EGLint> contextAttributes = {
+        EGL_CONTEXT_MAJOR_VERSION,  params.glVersionMajor,
+        EGL_CONTEXT_MINOR_VERSION,  params.glVersionMinor,
+        EGL_CONTEXT_OPENGL_DEBUG,   params.debug ? EGL_TRUE : EGL_FALSE
+    };
+
+    if (params.glProfile != OpenGLProfile::Any)
+    {
+        contextAttributes.push_back(EGL_CONTEXT_OPENGL_PROFILE_MASK);
+        contextAttributes.push_back(params.glProfile == OpenGLProfile::Core
+            ? EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT
+            : EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT
+        );
+    }
+    contextAttributes.push_back(EGL_NONE);
+
+    // Shared GL context
+    EGLContext sharedContext = EGL_NO_CONTEXT;
+    if (params.shareContext != nullptr)
+    {
+        EGLWindowPtr eglSharedWindow = std::static_pointer_cast<EGLWindow>(params.shareContext);
+        sharedContext = eglSharedWindow->_context;
+    }
+
+    EGLContext context = eglCreateContext(_display, config, sharedContext, contextAttributes.data());
+    if (context == EGL_NO_CONTEXT)
+    {
+        _ReportError("failed to create context");
+        throw std::runtime_error("WindowFactory<EGL>: Failed to create window.");
+    }
+
+    EGLSurface surface = EGL_NO_SURFACE;
+    if (!_surfacelessSupported)
+    {
+        const EGLint pbufferAttributes[] = {
+            EGL_WIDTH,  params.width,
+            EGL_HEIGHT, params.height,
+            EGL_NONE
+        };
+
+        surface = eglCreatePbufferSurface(_display, config, pbufferAttributes);
+        if (surface == EGL_NO_SURFACE)
+        {
+            _ReportError("failed to create pbuffer surface");
+            eglDestroyContext(_display, context);
+            throw std::runtime_error("WindowFactory<EGL>: Failed to create window.");
+        }
+    }
+
+    const EGLWindowPtr eglWindow = std::make_shared<EGLWindow>(_display, context, surface, params.width, params.height, params.title);
+    return std::static_pointer_cast<GLWindow>(eglWindow);
+}
+
+void WindowFactory<WindowBackend::EGL>::DestroyWindow(GLWindowPtr window)
+{
+    EGLWindowPtr eglWindow = std::static_pointer_cast<EGLWindow>(window);
+    eglWindow->setShouldClose(true);
+
+    // Destruction is deferred by EGL if the context is still current somewhere
+    if (eglWindow->_surface != EGL_NO_SURFACE)
+    {
+        eglDestroySurface(_display, eglWindow->_surface);
+        eglWindow->_surface = EGL_NO_SURFACE;
+    }
+    eglDestroyContext(_display, eglWindow->_context);
+    eglWindow->_context = EGL_NO_CONTEXT;
+}
+
+bool WindowFactory<WindowBackend::EGL>::DisplayExtensionSupported(const std::string& extName)
+{
+    if (_display == EGL_NO_DISPLAY) return false;
+
+    return _ExtensionListed(eglQueryString(_display, EGL_EXTENSIONS), extName);
+}
+
+EGLDisplay WindowFactory<WindowBackend::EGL>::_GetDisplay()
+{
+    const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    if (_ExtensionListed(clientExtensions, "EGL_MESA_platform_surfaceless"))
+    {
+        PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+            (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+
+        if (getPlatformDisplay)
+        {
+            EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+            if (display != EGL_NO_DISPLAY) return display;
+        }
+    }
+
+    return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+}
+
+void WindowFactory<WindowBackend::EGL>::_ReportError(const std::string& description)
+{
+    if (_errorCallback) _errorCallback(eglGetError(), description.c_str());
+}
+
+bool WindowFactory<WindowBackend::EGL>::_ExtensionListed(const char* extensions, const std::string& extName)
+{
+    if (!extensions) return false;
+
+    std::istringstream stream(extensions);
+    std::string name;
+    while (stream >> name)
+    {
+        if (name == extName) return true;
+    }
+
+    return false;
+}
+
+}//namespace Renderboi::Window
@@ -0,0 +1,89 @@
+#ifndef RENDERBOI__WINDOW__EGL__EGL_WINDOW_FACTORY_HPP
+#define RENDERBOI__WINDOW__EGL__EGL_WINDOW_FACTORY_HPP
+
+#include <map>
+#include <string>
+
+#define EGL_NO_X11
+#include <EGL/egl.h>
+#undef EGL_NO_X11
+
+#include "../window_factory.hpp"
+#include "../window_backend.hpp"
+#include "../window_creation_parameters.hpp"
+
+namespace Renderboi::Window
+{
+
+/// @brief EGL specialization of the window factory, creating headless
+/// windows which need no display server (see EGLWindow). The Mesa
+/// surfaceless platform is used when available, so that rendering works
+/// on machines without any display. These functions may be called only from
+/// the main thread.
+template<>
+class WindowFactory<WindowBackend::EGL>
+{
+public:
+    using ErrorCallbackSignature = void(*)(const int error, const char* description);
+
+private:
+    /// @brief Display on which contexts are created.
+    static EGLDisplay _display;
+
+    /// @brief Whether contexts can be made current without a surface.
+    static bool _surfacelessSupported;
+
+    /// @brief Pointer to the callback for error reporting.
+    static ErrorCallbackSignature _errorCallback;
+
+    /// @brief Get the display to create contexts on, preferring the Mesa
+    /// surfaceless platform.
+    static EGLDisplay _GetDisplay();
+
+    /// @brief Report the last EGL error through the error callback.
+    ///
+    /// @param description Description of the operation which failed.
+    static void _ReportError(const std::string& description);
+
+    /// @brief Tell whether an extension is part of a space-separated list of
+    /// extensions.
+    ///
+    /// @param extensions Space-separated list of extensions, may be null.
+    /// @param extName Name of the extension to look for.
+    static bool _ExtensionListed(const char* extensions, const std::string& extName);
+
+public:
+    /// @brief Default error callback, printing errors to the standard error
+    /// output.
+    ///
+    /// @param error Code of the EGL error.
+    /// @param description Description of the operation which failed.
+    static void GlobalEglErrorCallback(const int error, const char* description);
+
+    static int InitializeBackend();
+
+    static void TerminateBackend();
+
+    static void SetErrorCallback(const void* callback);
+
+    static MonitorPtr GetPrimaryMonitor();
+
+    static std::map<unsigned int, MonitorPtr> GetMonitors();
+
+    static void SetMonitorCallback(const void* callback);
+
+    static Monitor::VideoMode GetMonitorNativeVideoMode(const MonitorPtr monitor);
+
+    static GLWindowPtr MakeWindow(const WindowCreationParameters& params);
+
+    static void DestroyWindow(GLWindowPtr window);
+
+    /// @brief Tell whether the display supports a certain EGL extension.
+    ///
+    /// @param extName String containing the name of the extension to query.
+    static bool DisplayExtensionSupported(const std::string& extName);
+};
+
+}//namespace Renderboi::Window
+
+#endif//RENDERBOI__WINDOW__EGL__EGL_WINDOW_FACTORY_HPP
@@ -38,6 +38,12 @@ namespace rbw = rb::Window;
       static const void* AppWindowErrorCallback = (void*)(&rbw::GLFW3Utilities::globalGlfwErrorCallback);
 #endif
 
+#if 0
+      #include <renderboi/window/egl/egl_window_factory.hpp>
+
+      static const void* AppWindowErrorCallback = (void*)(&rbw::WindowFactory<rbw::WindowBackend::EGL>::GlobalEglErrorCallback);
+#endif
+
 #include "window_backend.hpp"
 
 static constexpr rbw::WindowBackend AppBackend = rbw::WindowBackend::GLFW3;
@@ -0,0 +1,101 @@
+#ifndef RENDERBOI__WINDOW__EVENT__INPUT_EVENT_HPP
+#define RENDERBOI__WINDOW__EVENT__INPUT_EVENT_HPP
+
+#include <chrono>
+
+#include "../enums.hpp"
+#include "../gamepad/gamepad_state.hpp"
+
+namespace Renderboi
+{
+
+namespace Window
+{
+
+/// @brief Trivially copyable record of an input event, captured on the
+/// thread polling for events so that it can be processed later on another
+/// thread.
+struct InputEvent
+{
+    /// @brief Clock used to timestamp input events.
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief Collection of litterals describing the different kinds of
+    /// input events.
+    enum class Type
+    {
+        FramebufferResize,
+        Keyboard,
+        MouseButton,
+        MouseCursor,
+        GamepadConnected,
+        GamepadDisconnected,
+        GamepadButton,
+        GamepadAxis,
+        GamepadStateChange
+    };
+
+    /// @brief Kind of the input event.
+    Type type;
+
+    /// @brief Point in time at which the event was captured.
+    Clock::time_point timestamp;
+
+    /// @brief Index of the window (for window events) or of the gamepad
+    /// (for gamepad events) which triggered the event, among the sources
+    /// known to the entity which captured it.
+    unsigned int source;
+
+    /// @brief Parameters of the event, depending on its kind.
+    union
+    {
+        struct
+        {
+            unsigned int width;
+            unsigned int height;
+        } framebufferResize;
+
+        struct
+        {
+            Input::Key key;
+            int scancode;
+            Input::Action action;
+            int mods;
+        } keyboard;
+
+        struct
+        {
+            Input::MouseButton button;
+            Input::Action action;
+            int mods;
+        } mouseButton;
+
+        struct
+        {
+            double xpos;
+            double ypos;
+        } mouseCursor;
+
+        struct
+        {
+            Input::Gamepad::Button button;
+            Input::Action action;
+        } gamepadButton;
+
+        struct
+        {
+            Input::Gamepad::Axis axis;
+            float value;
+        } gamepadAxis;
+
+        Window::GamepadStateChange gamepadStateChange;
+    };
+};
+
+}//namespace Window
+
+using InputEvent = Window::InputEvent;
+
+}//namespace Renderboi
+
+#endif//RENDERBOI__WINDOW__EVENT__INPUT_EVENT_HPP
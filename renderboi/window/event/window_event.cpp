@@ -0,0 +1,30 @@
+#include "window_event.hpp"
+
+#include <unordered_map>
+
+namespace Renderboi
+{
+
+using Window::WindowEvent;
+
+std::string to_string(const WindowEvent& event)
+{
+    static bool runOnce = false;
+    static std::unordered_map<WindowEvent, std::string> enumNames;
+
+    if (!runOnce)
+    {
+        enumNames[WindowEvent::GoFullscreen]     = "GoFullscreen";
+        enumNames[WindowEvent::ExitFullscreen]   = "ExitFullscreen";
+        enumNames[WindowEvent::ToggleFullscreen] = "ToggleFullscreen";
+
+        runOnce = true;
+    }
+
+    auto it = enumNames.find(event);
+    if (it != enumNames.end()) return it->second;
+
+    return "Unknown";
+}
+
+} // namespace Renderboi
@@ -0,0 +1,27 @@
+#ifndef RENDERBOI__WINDOW__EVENT__WINDOW_EVENT_HPP
+#define RENDERBOI__WINDOW__EVENT__WINDOW_EVENT_HPP
+
+#include <string>
+
+namespace Renderboi
+{
+
+namespace Window
+{
+
+/// @brief Collection of litterals describing window management actions,
+/// which may be queued from any thread to be performed on the main thread.
+enum class WindowEvent
+{
+    GoFullscreen,
+    ExitFullscreen,
+    ToggleFullscreen
+};
+
+} // namespace Window
+
+std::string to_string(const Window::WindowEvent& event);
+
+} // namespace Renderboi
+
+#endif//RENDERBOI__WINDOW__EVENT__WINDOW_EVENT_HPP
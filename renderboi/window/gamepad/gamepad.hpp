@@ -1,11 +1,14 @@
 #ifndef RENDERBOI__WINDOW__GAMEPAD__GAMEPAD_HPP
 #define RENDERBOI__WINDOW__GAMEPAD__GAMEPAD_HPP
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
 
+#include <renderboi/utilities/seqlock.hpp>
+
 #include "../enums.hpp"
 #include "gamepad_state.hpp"
 #include "gamepad_input_processor.hpp"
@@ -31,19 +34,29 @@ private:
     /// @param manager Pointer to the gamepad manager which the gamepad will be linked to.
     Gamepad(GamepadManagerPtr manager, const Window::Input::Joystick slot, const std::string name);
 
-    /// @brief Current state of the gamepad (buttons and axes).
+    /// @brief Current state of the gamepad (buttons and axes). Only accessed
+    /// by the thread sampling the gamepad.
     GamepadState _state;
 
+    /// @brief Copy of the current state of the gamepad, which any thread may
+    /// read while the gamepad is being sampled.
+    SeqLock<GamepadState> _publishedState;
+
     /// @brief Whether or not to poll the gamepad state.
     bool _enabled;
 
-    /// @brief Structure mapping a pair of floats between which axis input 
-    /// should not be forwarded.
-    std::unordered_map<Axis, std::pair<float, float>> _axisDeadZones;
+    /// @brief Lower bounds of the dead zones of all axes, between which and
+    /// the upper bounds axis input should not be forwarded. Padded like the
+    /// axes of a gamepad state.
+    alignas(32) float _deadZoneLows[GamepadState::AxisSlotCount];
 
-    /// @brief Structure telling whether an axis value was in its dead zone in
-    /// the previous state.
-    std::unordered_map<Axis, bool> _axisWasInDeadZone;
+    /// @brief Upper bounds of the dead zones of all axes. Padded like the
+    /// axes of a gamepad state.
+    alignas(32) float _deadZoneHighs[GamepadState::AxisSlotCount];
+
+    /// @brief Bit mask telling which axes were in their dead zone in the
+    /// previous state.
+    uint8_t _axesInDeadZone;
 
     /// @brief Entity to which gamepad events should be forwarded.
     GamepadInputProcessorPtr _inputProcessor;
@@ -59,26 +72,12 @@ private:
     void _processDisconnected();
 
     /// @brief Set the state of the gamepad, and compare it with the previous
-    /// state to fire appropriate events to the gamepad input manager.
+    /// state to fire a single batch of events to the gamepad input processor.
+    /// Changed buttons are found with a single XOR of the button masks, and
+    /// dead zones are applied to all axes in a single branchless pass.
     ///
     /// @param newState New state to set the gamepad to.
-    void _setNewState(const GamepadState newState);
-
-    /// @brief Compare two gamepad states and fire events based on the 
-    /// difference between both.
-    ///
-    /// @param before Gamepad state to compare the new one to.
-    /// @param after Gamepad state to compare to the old one.
-    void _compareAndFireEvents(const GamepadState& before, const GamepadState& after);
-
-    /// @brief Tell whether a value is in the dead zone for a given axis.
-    ///
-    /// @param axis Litteral describing the axis whose dead zone to test.
-    /// @param value Value to test against the axis dead zone.
-    ///
-    /// @return Whether or not the provided value is in the dead zone of the 
-    /// provided axis.
-    inline bool _valueIsInAxisDeadZone(const float& value, const Axis& axis) const;
+    void _setNewState(const GamepadState& newState);
 
 public:
     /// @brief Enable polling the state of the gamepad.
@@ -91,9 +90,12 @@ public:
     void setEnabled(const bool enabled);
 
     /// @brief Get the current state of the gamepad managed by the instance.
+    /// May be called from any thread, without blocking the thread sampling
+    /// the gamepad.
     ///
-    /// @return The current state of the gamepad managed by the instance.
-    const GamepadState& getState() const;
+    /// @return A copy of the current state of the gamepad managed by the
+    /// instance.
+    GamepadState getState() const;
 
     /// @brief Tells whether a button is currently pressed on the gamepad.
     ///
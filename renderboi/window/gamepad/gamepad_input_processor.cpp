@@ -1,5 +1,7 @@
 #include "gamepad_input_processor.hpp"
 
+#include <bit>
+
 namespace Renderboi::Window
 {
 
@@ -31,4 +33,23 @@ void GamepadInputProcessor::processAxis(const GamepadPtr gamepad, const Window::
 
 }
 
+void GamepadInputProcessor::processStateChange(const GamepadPtr gamepad, const GamepadStateChange& change)
+{
+    for (unsigned int bits = change.pressedButtons; bits; bits &= bits - 1)
+    {
+        processButton(gamepad, (Button)std::countr_zero(bits), Input::Action::Press);
+    }
+
+    for (unsigned int bits = change.releasedButtons; bits; bits &= bits - 1)
+    {
+        processButton(gamepad, (Button)std::countr_zero(bits), Input::Action::Release);
+    }
+
+    for (unsigned int bits = change.changedAxes; bits; bits &= bits - 1)
+    {
+        const int i = std::countr_zero(bits);
+        processAxis(gamepad, (Axis)i, change.axes[i]);
+    }
+}
+
 }//namespace Renderboi::Window
\ No newline at end of file
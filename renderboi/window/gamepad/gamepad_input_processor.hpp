@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "../enums.hpp"
+#include "gamepad_state.hpp"
 
 namespace Renderboi
 {
@@ -67,6 +68,13 @@ public:
     /// @param value Value at which the axis was polled.
     virtual void processAxis(const GamepadPtr gamepad, const Input::Gamepad::Axis axis, const float value);
 
+    /// @brief Callback for all the button and axis events of a single poll
+    /// of the gamepad. By default, forwards each event to processButton or
+    /// processAxis, pressed buttons first, then released buttons, then axes.
+    ///
+    /// @param change Record of the changes in the state of the gamepad.
+    virtual void processStateChange(const GamepadPtr gamepad, const GamepadStateChange& change);
+
     /// @brief Unique identifier of the gamepad input processor.
     const unsigned int id;
 };
@@ -11,7 +11,7 @@ GamepadManager::GamepadManager() :
 
 }
 
-void GamepadManager::setGamepadState(GamepadPtr gamepad, GamepadState state)
+void GamepadManager::setGamepadState(GamepadPtr gamepad, const GamepadState& state)
 {
     gamepad->_setNewState(state);
 }
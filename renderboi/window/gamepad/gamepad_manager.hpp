@@ -67,12 +67,23 @@ public:
     /// thread.
     virtual void stopGamepadPolling(Joystick slat) const = 0;
 
-    /// @brief Process any pending gamepad connection event.
+    /// @brief Process any pending gamepad connection event. Must be called
+    /// from the same thread as pollGamepadStates().
     virtual void refreshGamepadStatuses() const = 0;
 
     /// @brief Poll the state for gamepads and forward it to gamepad entities.
+    /// May be called from the main thread, or from a thread dedicated to
+    /// sampling gamepads if the manager supports it (see 
+    /// supportsSamplingThread()).
     virtual void pollGamepadStates() const = 0;
 
+    /// @brief Tell whether gamepads may be sampled from a thread dedicated to
+    /// it (see GLWindow::startGamepadSamplingThread()), rather than from the 
+    /// main thread only.
+    ///
+    /// @return Whether gamepads may be sampled from a dedicated thread.
+    virtual bool supportsSamplingThread() const = 0;
+
     /// @brief Unique ID of the gamepad manager.
     const unsigned int id;
 
@@ -82,7 +93,7 @@ protected:
     ///
     /// @param gamepad Pointer to the gamepad instance whose state to set.
     /// @param state State to set within the gamepad.
-    static void setGamepadState(GamepadPtr gamepad, GamepadState state);
+    static void setGamepadState(GamepadPtr gamepad, const GamepadState& state);
 
     /// @brief Method allowing inheriting classes to notify a gamepad about its
     /// connection status without privileged access to it.
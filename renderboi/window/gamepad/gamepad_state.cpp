@@ -4,58 +4,37 @@ namespace Renderboi::Window
 {
 
 GamepadState::GamepadState() :
-    Buttons{
-        false,  // A
-        false,  // B
-        false,  // X
-        false,  // Y
-        false,  // LeftBumper
-        false,  // RightBumper
-        false,  // DPadUp
-        false,  // DPadRight
-        false,  // DPadDown
-        false,  // DPadLeft
-        false,  // LeftThumb
-        false,  // RightThumb
-        false,  // Select
-        false,  // Start
-        false   // Home
-    },
+    DPad(DPadDirection::None),
+    Buttons(0),
     Axes{
          0.f,   // LeftX
          0.f,   // LeftY
          0.f,   // RightX
          0.f,   // RightY
         -1.f,   // LeftTrigger
-        -1.f    // RightTrigger
-    },
-    DPad(DPadDirection::None)
+        -1.f,   // RightTrigger
+         0.f,   // Padding
+         0.f    // Padding
+    }
 {
 
 }
 
-GamepadState::GamepadState(const GamepadState& other)
+bool GamepadState::operator[](const Button& button) const
 {
-    std::copy(other.Buttons, other.Buttons + 15, Buttons);
-    std::copy(other.Axes, other.Axes + 6, Axes);
-    DPad = other.DPad;
+    return Buttons & ButtonBit(button);
 }
 
-GamepadState& GamepadState::operator=(GamepadState other)
+void GamepadState::setPressed(const Button button, const bool pressed)
 {
-    swap(*this, other);
-
-    return *this;
-}
-
-bool& GamepadState::operator[](const Button& button)
-{
-    return Buttons[(unsigned int)button];
-}
-
-const bool& GamepadState::operator[](const Button& button) const
-{
-    return Buttons[(unsigned int)button];
+    if (pressed)
+    {
+        Buttons |= ButtonBit(button);
+    }
+    else
+    {
+        Buttons &= (uint16_t)~ButtonBit(button);
+    }
 }
 
 float& GamepadState::operator[](const Axis& axis)
@@ -68,13 +47,4 @@ const float& GamepadState::operator[](const Axis& axis) const
     return Axes[(unsigned int)axis];
 }
 
-void swap(GamepadState& left, GamepadState& right)
-{
-    using std::swap;
-
-    swap(left.DPad,    right.DPad);
-    swap(left.Buttons, right.Buttons);
-    swap(left.Axes,    right.Axes);
-}
-
 }//namespace Renderboi::Window
\ No newline at end of file
@@ -1,6 +1,8 @@
 #ifndef RENDERBOI__WINDOW__GAMEPAD__GAMEPAD_STATE_HPP
 #define RENDERBOI__WINDOW__GAMEPAD__GAMEPAD_STATE_HPP
 
+#include <cstdint>
+
 #include "../enums.hpp"
 
 namespace Renderboi
@@ -8,20 +10,26 @@ namespace Renderboi
 namespace Window
 {
 
-/// @brief Class representing the state of a gamepad controller as a collection 
-/// of buttons which are pressed or released, as well as axes whose assigned 
+/// @brief Class representing the state of a gamepad controller as a collection
+/// of buttons which are pressed or released, as well as axes whose assigned
 /// values vary continuously.
 class GamepadState
 {
-friend void swap(GamepadState&, GamepadState&);
-
 public:
     using Button = Window::Input::Gamepad::Button;
     using Axis = Window::Input::Gamepad::Axis;
 
-    GamepadState();
+    /// @brief How many buttons a gamepad has.
+    static constexpr unsigned int ButtonCount = 15;
 
-    GamepadState(const GamepadState& other);
+    /// @brief How many axes a gamepad has.
+    static constexpr unsigned int AxisCount = 6;
+
+    /// @brief How many values the array of axes holds. Axes are padded to 8
+    /// lanes so that passes over all of them can be vectorised.
+    static constexpr unsigned int AxisSlotCount = 8;
+
+    GamepadState();
 
     /// @brief Collection of litterals describing the possible state of a DPad.
     enum DPadDirection : unsigned char
@@ -36,90 +44,38 @@ public:
     /// @brief Direction in which the DPad is pressed of the gamepad.
     DPadDirection DPad;
 
-    /// @brief Array containing the state of all buttons on the gamepad.
-    bool Buttons[15];
-
-    /// @brief Array containing the value of all axes on the gamepad.
-    float Axes[6];
-
-    /// @brief Whether or not button A is pressed on the gamepad.
-    bool& A = Buttons[(unsigned int)Button::A];
-
-    /// @brief Whether or not button B is pressed on the gamepad.
-    bool& B = Buttons[(unsigned int)Button::B];
-
-    /// @brief Whether or not button X is pressed on the gamepad.
-    bool& X = Buttons[(unsigned int)Button::X];
-
-    /// @brief Whether or not button Y is pressed on the gamepad.
-    bool& Y = Buttons[(unsigned int)Button::Y];
-
-    /// @brief Whether or not the left bumper is pressed on the gamepad.
-    bool& LeftBumper = Buttons[(unsigned int)Button::LeftBumper];
-
-    /// @brief Whether or not the right bumper is pressed on the gamepad.
-    bool& RightBumper = Buttons[(unsigned int)Button::RightBumper];
-
-    /// @brief Whether or not the Select button is pressed on the gamepad.
-    bool& Select = Buttons[(unsigned int)Button::Select];
-
-    /// @brief Whether or not the Start button is pressed on the gamepad.
-    bool& Start = Buttons[(unsigned int)Button::Start];
-
-    /// @brief Whether or not the Home button is pressed on the gamepad.
-    bool& Home = Buttons[(unsigned int)Button::Home];
-
-    /// @brief Whether or not the left thumbstick is pressed on the gamepad.
-    bool& LeftThumb = Buttons[(unsigned int)Button::LeftThumb];
+    /// @brief Bit mask containing the state of all buttons on the gamepad,
+    /// the bit of a button being set if it is pressed (see ButtonBit).
+    uint16_t Buttons;
 
-    /// @brief Whether or not the right thumbstick is pressed on the gamepad.
-    bool& RightThumb = Buttons[(unsigned int)Button::RightThumb];
+    /// @brief Array containing the value of all axes on the gamepad, followed
+    /// by padding values which are always 0.f. Axis values are guaranteed to
+    /// be in [-1.f ; 1.f]. Thumbstick axes rest at 0.f, trigger axes rest at
+    /// -1.f.
+    alignas(32) float Axes[AxisSlotCount];
 
-    /// @brief Whether or not the DPad is pressed upwards on the gamepad.
-    bool& DPadUp = Buttons[(unsigned int)Button::DPadUp];
-
-    /// @brief Whether or not the DPad is pressed to the right on the gamepad.
-    bool& DPadRight = Buttons[(unsigned int)Button::DPadRight];
-
-    /// @brief Whether or not the DPad is pressed downwards on the gamepad.
-    bool& DPadDown = Buttons[(unsigned int)Button::DPadDown];
-
-    /// @brief Whether or not the DPad is pressed to the left on the gamepad.
-    bool& DPadLeft = Buttons[(unsigned int)Button::DPadLeft];
-
-    /// @brief Value of the X axis of the left thumbstick on the gamepad.
-    /// Guaranteed to be in [-1.f ; 1.f]. Rest position at 0.f.
-    float& LeftX = Axes[(unsigned int)Axis::LeftX];
-
-    /// @brief Value of the Y axis of the left thumbstick on the gamepad.
-    /// Guaranteed to be in [-1.f ; 1.f]. Rest position at 0.f.
-    float& LeftY = Axes[(unsigned int)Axis::LeftY];
-
-    /// @brief Value of the X axis of the right thumbstick on the gamepad.
-    /// Guaranteed to be in [-1.f ; 1.f]. Rest position at 0.f.
-    float& RightX = Axes[(unsigned int)Axis::RightX];
-
-    /// @brief Value of the Y axis of the right thumbstick on the gamepad.
-    /// Guaranteed to be in [-1.f ; 1.f]. Rest position at 0.f.
-    float& RightY = Axes[(unsigned int)Axis::RightY];
-
-    /// @brief Value of the left trigger axis on the gamepad.
-    /// Guaranteed to be in [-1.f ; 1.f]. Rest position at -1.f.
-    float& LeftTrigger = Axes[(unsigned int)Axis::LeftTrigger];
-
-    /// @brief Value of the right trigger axis on the gamepad.
-    /// Guaranteed to be in [-1.f ; 1.f]. Rest position at -1.f.
-    float& RightTrigger = Axes[(unsigned int)Axis::RightTrigger];
+    /// @brief Get the bit standing for a button in the button mask.
+    ///
+    /// @param button Litteral describing the button whose bit to get.
+    ///
+    /// @return The bit standing for the button in the button mask.
+    static constexpr uint16_t ButtonBit(const Button button)
+    {
+        return (uint16_t)(1u << (unsigned int)button);
+    }
 
-    /// @brief Quick access for a button in the array.
+    /// @brief Tell whether a button is pressed.
     ///
     /// @param button Litteral describing the button whose state to access.
-    bool& operator[](const Button& button);
+    ///
+    /// @return Whether the button is pressed.
+    bool operator[](const Button& button) const;
 
-    /// @brief Quick access for a button in the array.
+    /// @brief Set whether a button is pressed.
     ///
-    /// @param button Litteral describing the button whose state to access.
-    const bool& operator[](const Button& button) const;
+    /// @param button Litteral describing the button whose state to set.
+    /// @param pressed Whether the button is pressed.
+    void setPressed(const Button button, const bool pressed);
 
     /// @brief Quick access for an axis in the array.
     ///
@@ -130,14 +86,34 @@ public:
     ///
     /// @param button Litteral describing the axis whose value to access.
     const float& operator[](const Axis& button) const;
+};
 
-    /// @param other GamepadState to copy state from.
-    GamepadState& operator=(GamepadState other);
+/// @brief Trivially copyable record of the changes between two successive
+/// states of a gamepad, dispatched once per poll.
+struct GamepadStateChange
+{
+    /// @brief Bit mask of the buttons which were pressed (see
+    /// GamepadState::ButtonBit).
+    uint16_t pressedButtons;
+
+    /// @brief Bit mask of the buttons which were released (see
+    /// GamepadState::ButtonBit).
+    uint16_t releasedButtons;
+
+    /// @brief Bit mask of the axes whose value is to be reported, the bit of
+    /// an axis being 1 shifted left by the axis index.
+    uint8_t changedAxes;
+
+    /// @brief Values to report for the axes, only meaningful for those whose
+    /// bit is set in the mask of changed axes. Axes which went back into
+    /// their dead zone are reported at their rest value.
+    float axes[GamepadState::AxisCount];
 };
 
 }//namespace Window
 
 using GamepadState = Window::GamepadState;
+using GamepadStateChange = Window::GamepadStateChange;
 
 }//namespace Renderboi
 
@@ -1,7 +1,12 @@
 #include "gl_window.hpp"
 
+#include <chrono>
 #include <iostream>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
 #include <string>
+#include <thread>
 
 #include "input_processor.hpp"
 
@@ -14,14 +19,25 @@ GLWindow::GLWindow(std::string title) :
     _inputProcessor(_DefaultInputProcessor),
     _title(title),
     _exitSignaled(false),
-    _gamepadManager(nullptr)
+    _gamepadSamplingRate(DefaultGamepadSamplingRate),
+    _gamepadSamplingThreadRunning(false),
+    _gamepadSamplingThread(),
+    _gamepadManager(nullptr),
+    _eventMutex(),
+    _eventQueue()
 {
 
 }
 
 GLWindow::~GLWindow()
 {
-
+    // Virtual functions may not be called anymore, the polling loop is not
+    // notified
+    if (_gamepadSamplingThreadRunning)
+    {
+        _gamepadSamplingThreadRunning = false;
+        _gamepadSamplingThread.join();
+    }
 }
 
 void GLWindow::processFramebufferResize(const int width, const int height)
@@ -81,23 +97,101 @@ GLContextClientPtr GLWindow::getGlContextClient() const
 void GLWindow::pollAllEvents()
 {
     pollEvents();
-
-    _gamepadManager->refreshGamepadStatuses();
-    _gamepadManager->pollGamepadStates();
+    _processPendingEvents();
+    _sampleGamepads();
 }
 
 void GLWindow::startPollingLoop()
 {
+    using Clock = std::chrono::steady_clock;
+    using Seconds = std::chrono::duration<double>;
+
     _exitSignaled = false;
+    Clock::time_point nextSample = Clock::now();
     while (!_exitSignaled)
     {
-        pollAllEvents();
+        _processPendingEvents();
+
+        // No need to wake up for gamepads when they are sampled elsewhere
+        const unsigned int rate = _gamepadSamplingThreadRunning ? 0 : _gamepadSamplingRate.load();
+        if (!rate)
+        {
+            waitEvents(-1.0);
+            _sampleGamepads();
+            continue;
+        }
+
+        // Sleep until an event comes in or the next gamepad sample is due
+        const Clock::time_point now = Clock::now();
+        if (now < nextSample)
+        {
+            waitEvents(Seconds(nextSample - now).count());
+            continue;
+        }
+
+        _sampleGamepads();
+
+        // Skip samples which were missed rather than catching up on them
+        const Clock::duration period = std::chrono::duration_cast<Clock::duration>(Seconds(1.0 / rate));
+        nextSample += period;
+        if (nextSample <= now)
+        {
+            nextSample = now + period;
+        }
+    }
+}
+
+void GLWindow::setGamepadSamplingRate(const unsigned int rate)
+{
+    _gamepadSamplingRate = rate;
+
+    // Let the polling loop pick up the new rate
+    postEmptyEvent();
+}
+
+unsigned int GLWindow::getGamepadSamplingRate() const
+{
+    return _gamepadSamplingRate;
+}
+
+void GLWindow::startGamepadSamplingThread()
+{
+    if (_gamepadSamplingThreadRunning) return;
+
+    if (!_gamepadManager->supportsSamplingThread())
+    {
+        throw std::runtime_error("GLWindow: gamepad manager does not support sampling gamepads from a dedicated thread.");
     }
+
+    _gamepadSamplingThreadRunning = true;
+    _gamepadSamplingThread = std::thread(&GLWindow::_gamepadSamplingLoop, this);
+
+    // Let the polling loop stop waking up for gamepads
+    postEmptyEvent();
+}
+
+void GLWindow::stopGamepadSamplingThread()
+{
+    if (!_gamepadSamplingThreadRunning) return;
+
+    _gamepadSamplingThreadRunning = false;
+    _gamepadSamplingThread.join();
+
+    // Let the polling loop resume sampling gamepads
+    postEmptyEvent();
+}
+
+bool GLWindow::gamepadSamplingThreadRunning() const
+{
+    return _gamepadSamplingThreadRunning;
 }
 
 void GLWindow::signalExit(bool value)
 {
     _exitSignaled = value;
+
+    // Wake up the polling loop so that it notices the signal
+    postEmptyEvent();
 }
 
 bool GLWindow::exitSignaled()
@@ -105,10 +199,102 @@ bool GLWindow::exitSignaled()
     return _exitSignaled;
 }
 
+void GLWindow::queueEvent(const WindowEvent event)
+{
+    {
+        std::unique_lock lock(_eventMutex);
+        _eventQueue.push(event);
+    }
+
+    // Wake up the polling loop so that it performs the action
+    postEmptyEvent();
+}
+
 GamepadManagerPtr GLWindow::getGamepadManager()
 {
     return _gamepadManager;
 }
 
+void GLWindow::_processPendingEvents()
+{
+    std::queue<WindowEvent> events;
+    {
+        std::unique_lock lock(_eventMutex);
+        std::swap(events, _eventQueue);
+    }
+
+    while (!events.empty())
+    {
+        _processEvent(events.front());
+        events.pop();
+    }
+}
+
+void GLWindow::_processEvent(const WindowEvent event)
+{
+    switch (event)
+    {
+    case WindowEvent::GoFullscreen:
+        if (!isFullscreen()) goFullscreen(nullptr, true);
+        break;
+
+    case WindowEvent::ExitFullscreen:
+        if (isFullscreen()) exitFullscreen();
+        break;
+
+    case WindowEvent::ToggleFullscreen:
+        if (isFullscreen())
+        {
+            exitFullscreen();
+        }
+        else
+        {
+            goFullscreen(nullptr, true);
+        }
+        break;
+
+    default:
+        std::string s = "GLWindow: cannot process unknown event \""
+        + to_string(event) + "\".";
+        throw std::runtime_error(s.c_str());
+    }
+}
+
+void GLWindow::_sampleGamepads()
+{
+    // Gamepad events must all be fired from the same thread
+    if (_gamepadSamplingThreadRunning) return;
+
+    _gamepadManager->refreshGamepadStatuses();
+    _gamepadManager->pollGamepadStates();
+}
+
+void GLWindow::_gamepadSamplingLoop()
+{
+    using Clock = std::chrono::steady_clock;
+    using Seconds = std::chrono::duration<double>;
+
+    Clock::time_point nextSample = Clock::now();
+    while (_gamepadSamplingThreadRunning)
+    {
+        _gamepadManager->refreshGamepadStatuses();
+        _gamepadManager->pollGamepadStates();
+
+        const unsigned int setRate = _gamepadSamplingRate;
+        const unsigned int rate = setRate ? setRate : DefaultGamepadSamplingRate;
+        const Clock::duration period = std::chrono::duration_cast<Clock::duration>(Seconds(1.0 / rate));
+
+        // Skip samples which were missed rather than catching up on them
+        const Clock::time_point now = Clock::now();
+        nextSample += period;
+        if (nextSample <= now)
+        {
+            nextSample = now + period;
+        }
+
+        std::this_thread::sleep_until(nextSample);
+    }
+}
+
 
 }//namespace Renderboi::Window
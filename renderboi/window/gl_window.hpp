@@ -3,14 +3,18 @@
 
 #include <atomic>
 #include <memory>
+#include <mutex>
+#include <queue>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "enums.hpp"
 #include "gl_context_client.hpp"
 #include "input_processor.hpp"
 #include "monitor.hpp"
+#include "event/window_event.hpp"
 #include "gamepad/gamepad_manager.hpp"
 
 namespace Renderboi
@@ -24,6 +28,10 @@ namespace Window
 class GLWindow : public std::enable_shared_from_this<GLWindow>
 {
 public:
+    /// @brief Rate (in Hz) at which gamepads are sampled by default in the
+    /// polling loop.
+    static constexpr unsigned int DefaultGamepadSamplingRate = 250;
+
     /// @param title Title of the window.
     GLWindow(std::string title);
     
@@ -92,6 +100,14 @@ public:
     /// @param value Whether the exit signal sent is positive or negative.
     virtual void signalExit(bool value = true);
 
+    /// @brief Queue a window management action, to be performed on the main
+    /// thread by the event polling loop. May be called from any thread, in
+    /// particular from input processors running elsewhere than on the main
+    /// thread, which must not manage the window directly.
+    ///
+    /// @param event Literal describing the action to queue.
+    void queueEvent(const WindowEvent event);
+
     /// @brief Get a pointer to the entity which manages gamepads. May be called
     /// from any thread.
     ///
@@ -122,13 +138,61 @@ public:
     /// @param value Literal describing which input to set the target to.
     virtual void setInputMode(const Window::Input::Mode::Target target, const Window::Input::Mode::Value value) = 0;
 
-    /// @brief Poll and process input and queued events until requested to exit.
+    /// @brief Poll and process input and queued events once. May only be
+    /// called from the main thread.
     void pollAllEvents();
 
-    /// @brief Call pollAllEvents() in a loop until requested to exit (see 
-    /// signalExit() and exitSignaled()).
+    /// @brief Wait for and process input and queued events until requested 
+    /// to exit (see signalExit() and exitSignaled()). The calling thread
+    /// sleeps while no event is queued, and wakes up to sample gamepads at
+    /// the configured rate (see setGamepadSamplingRate()). May only be called
+    /// from the main thread.
     void startPollingLoop();
 
+    /// @brief Set the rate at which gamepads are sampled in the polling 
+    /// loop, or on the dedicated sampling thread if it runs. May be called
+    /// from any thread.
+    ///
+    /// @param rate Rate (in Hz) at which gamepads should be sampled. If 0, 
+    /// gamepads are only sampled when window events wake up the polling
+    /// loop.
+    void setGamepadSamplingRate(const unsigned int rate);
+
+    /// @brief Get the rate at which gamepads are sampled in the polling 
+    /// loop. May be called from any thread.
+    ///
+    /// @return The rate (in Hz) at which gamepads are sampled.
+    unsigned int getGamepadSamplingRate() const;
+
+    /// @brief Start sampling gamepad states on a dedicated thread, at the
+    /// configured sampling rate (see setGamepadSamplingRate()), or at the
+    /// default rate if it is 0. Gamepad connections are then also processed
+    /// on that thread, and the polling loop only processes window events, so
+    /// that gamepad input latency does not depend on window event traffic.
+    /// All gamepad events are fired from the sampling thread: register a
+    /// BufferedInputProcessor to the gamepads to process them on another
+    /// thread, or read their latest states with Gamepad::getState(). Input
+    /// processors of gamepads must not be changed while the thread runs. May
+    /// only be called from the main thread.
+    ///
+    /// @exception If the gamepad manager of the window does not support
+    /// sampling gamepads from a dedicated thread (see 
+    /// GamepadManager::supportsSamplingThread()), the function will throw a
+    /// std::runtime_error.
+    void startGamepadSamplingThread();
+
+    /// @brief Stop sampling gamepad states on a dedicated thread, and have
+    /// the polling loop sample them again. May only be called from the main
+    /// thread.
+    void stopGamepadSamplingThread();
+
+    /// @brief Tell whether gamepad states are being sampled on a dedicated
+    /// thread. May be called from any thread.
+    ///
+    /// @return Whether gamepad states are being sampled on a dedicated
+    /// thread.
+    bool gamepadSamplingThreadRunning() const;
+
     /// @brief Hide the window. May be called only from the main thread.
     virtual void hide() = 0;
 
@@ -239,9 +303,29 @@ public:
     /// any thread.
     virtual void swapBuffers() = 0;
 
+    /// @brief Set how many screen refreshes to wait for before swapping the
+    /// front and back buffers of the window. The GL context of the window
+    /// must be current on the calling thread.
+    ///
+    /// @param interval How many screen refreshes to wait for. 0 disables
+    /// vertical sync, 1 syncs buffer swaps to every screen refresh.
+    virtual void setSwapInterval(const int interval) = 0;
+
     /// @brief Poll the event queue of the window. May only be called from the 
     /// main thread.
     virtual void pollEvents() const = 0;
+
+    /// @brief Wait until events are queued in the event queue of the window,
+    /// or until a timeout elapses, then process them. May only be called 
+    /// from the main thread.
+    ///
+    /// @param timeout Maximum time (in seconds) to wait for. If negative,
+    /// wait for as long as no event is queued.
+    virtual void waitEvents(const double timeout) const = 0;
+
+    /// @brief Queue an empty event in the event queue of the window, waking 
+    /// up the thread waiting for events. May be called from any thread.
+    virtual void postEmptyEvent() const = 0;
     
     /// @brief Get the aspect ratio of the framebuffer used by the window.
     ///
@@ -282,12 +366,47 @@ protected:
     /// @brief Flag to indicate exiting the event polling loop.
     std::atomic<bool> _exitSignaled;
 
+    /// @brief Rate (in Hz) at which gamepads are sampled in the polling loop.
+    std::atomic<unsigned int> _gamepadSamplingRate;
+
+    /// @brief Whether gamepad states are sampled on a dedicated thread.
+    std::atomic<bool> _gamepadSamplingThreadRunning;
+
+    /// @brief Thread sampling gamepad states, if any.
+    std::thread _gamepadSamplingThread;
+
     /// @brief Entity to manage gamepads. Must be initialized at construction
     /// by inheriting classes.
     GamepadManagerPtr _gamepadManager;
 
     /// @brief Entity which utilizes the context painted by the window.
     GLContextClientPtr _glContextClient;
+
+    /// @brief Mutex for accessing the window event queue.
+    std::mutex _eventMutex;
+
+    /// @brief Window management actions yet to be performed on the main
+    /// thread.
+    std::queue<WindowEvent> _eventQueue;
+
+    /// @brief Perform all queued window management actions, and clear the
+    /// queue. May only be called from the main thread.
+    void _processPendingEvents();
+
+    /// @brief Perform a single window management action.
+    ///
+    /// @param event Literal describing the action to perform.
+    ///
+    /// @exception If the event is unknown, the function will throw a
+    /// std::runtime_error.
+    void _processEvent(const WindowEvent event);
+
+    /// @brief Refresh the statuses of gamepads and poll their states,
+    /// unless they are sampled on a dedicated thread.
+    void _sampleGamepads();
+
+    /// @brief Routine run by the gamepad sampling thread.
+    void _gamepadSamplingLoop();
 };
 
 using GLWindowPtr = std::shared_ptr<GLWindow>;
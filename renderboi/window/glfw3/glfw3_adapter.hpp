@@ -1,47 +1,16 @@
 #ifndef RENDERBOI__WINDOW__GLFW3_ADAPTER_HPP
 #define RENDERBOI__WINDOW__GLFW3_ADAPTER_HPP
 
-#include <unordered_map>
-
 #include "../enums.hpp"
 
 namespace Renderboi::Window
 {
 
 /// @brief Contains utilities to translate GLFW constants to RenderBoi enums 
-/// and the other way around.
+/// and the other way around. Translations are looked up in tables built at
+/// compile time.
 namespace GLFW3Adapter
 {
-    /// @brief Contains mapping data from RenderBoi enums to GLFW3 macros.
-    namespace ValueMaps
-    {
-        const std::unordered_map<Input::Mode::Target, unsigned int>& InputModeTargetValues();
-        const std::unordered_map<Input::Mode::Value, unsigned int>& InputModeValueValues();
-        const std::unordered_map<Input::Action, unsigned int>& ActionValues();
-        const std::unordered_map<Input::Key, unsigned int>& KeyValues();
-        const std::unordered_map<Input::Modifier, unsigned int>& KeyModifierValues();
-        const std::unordered_map<Input::MouseButton, unsigned int>& MouseButtonValues();
-        const std::unordered_map<Input::Joystick, unsigned int>& JoystickValues();
-        const std::unordered_map<Input::Gamepad::Button, unsigned int>& GamepadButtonValues();
-        const std::unordered_map<Input::Gamepad::Axis, unsigned int>& GamepadAxisValues();
-        const std::unordered_map<OpenGLProfile, unsigned int>& GlProfileValues();
-    }
-
-    /// @brief Contains mapping data from GLFW3 macros to RenderBoi enums.
-    namespace EnumMaps
-    {
-        const std::unordered_map<unsigned int, Input::Mode::Target>& InputModeTargetEnums();
-        const std::unordered_map<unsigned int, Input::Mode::Value>& InputModeValueEnums();
-        const std::unordered_map<unsigned int, Input::Action>& ActionEnums();
-        const std::unordered_map<unsigned int, Input::Key>& KeyEnums();
-        const std::unordered_map<unsigned int, Input::Modifier>& KeyModifierEnums();
-        const std::unordered_map<unsigned int, Input::MouseButton>& MouseButtonEnums();
-        const std::unordered_map<unsigned int, Input::Joystick>& JoystickEnums();
-        const std::unordered_map<unsigned int, Input::Gamepad::Button>& GamepadButtonEnums();
-        const std::unordered_map<unsigned int, Input::Gamepad::Axis>& GamepadAxisEnums();
-        const std::unordered_map<unsigned int, OpenGLProfile>& GlProfileEnums();
-    }
-
     /// @brief Get the RenderBoi enum corresponding to the given GLFW3 macro.
     ///
     /// @tparam E Type of the literal to find.
@@ -49,6 +18,10 @@ namespace GLFW3Adapter
     /// @param constant GLFW3 macro to translate into a RenderBoi literal.
     ///
     /// @return A literal of type E which describes the provided GLFW3 macro.
+    ///
+    /// @exception If no literal of type E corresponds to the provided macro,
+    /// the function will throw a std::out_of_range. Key codes are the
+    /// exception: unknown ones are translated to Input::Key::Unknown.
     template<typename E>
     E getEnum(int constant);
 
@@ -89,6 +62,9 @@ namespace GLFW3Adapter
     /// @param literal The literal to translate.
     ///
     /// @return The GLFW3 macro which corresponds to the given literal.
+    ///
+    /// @exception If no GLFW3 macro corresponds to the provided literal, the
+    /// function will throw a std::out_of_range.
     template<typename E>
     int getValue(E literal);
 
@@ -1,6 +1,7 @@
 #include "glfw3_gamepad_manager.hpp"
 
 #include <atomic>
+#include <mutex>
 #include <stdexcept>
 #include <unordered_map>
 #include <vector>
@@ -26,6 +27,7 @@ std::atomic<bool> GLFW3GamepadManager::_JoystickStatusRefreshFlag = true;
 GLFW3GamepadManager::GLFW3GamepadManager() :
     GamepadManager(),
     _managedGamepads(),
+    _managedGamepadsMutex(),
     _enabledGamepads()
 {
     using Window::Input::Joysticks;
@@ -80,8 +82,11 @@ GamepadPtr GLFW3GamepadManager::getGamepad(Window::Input::Joystick slot)
     }
 
     std::string gamepadName(glfwGetGamepadName(jid));
-    _managedGamepads[slot] = GamepadManager::createGamepad(shared_from_this(), slot, gamepadName);
-    return _managedGamepads[slot];
+    GamepadPtr gamepad = GamepadManager::createGamepad(shared_from_this(), slot, gamepadName);
+
+    std::unique_lock lock(_managedGamepadsMutex);
+    _managedGamepads[slot] = gamepad;
+    return gamepad;
 }
 
 void GLFW3GamepadManager::startGamepadPolling(Window::Input::Joystick slot) const
@@ -126,6 +131,7 @@ void GLFW3GamepadManager::refreshGamepadStatuses() const
 
 void GLFW3GamepadManager::pollGamepadStates() const
 {
+    std::unique_lock lock(_managedGamepadsMutex);
     for (auto it = _managedGamepads.cbegin(); it != _managedGamepads.cend(); it++)
     {
         if (!_enabledGamepads.at(it->first)) continue;
@@ -138,36 +144,35 @@ void GLFW3GamepadManager::pollGamepadStates() const
     }
 }
 
+bool GLFW3GamepadManager::supportsSamplingThread() const
+{
+    return false;
+}
+
 GamepadState GLFW3GamepadManager::_GamepadStateFromGlfwGamepadState(const GLFWgamepadstate& glfwState)
 {
+    using Button = GamepadState::Button;
+    using Axis = GamepadState::Axis;
+
     GamepadState state;
-    state.A             = glfwState.buttons[GLFW_GAMEPAD_BUTTON_A];
-    state.B             = glfwState.buttons[GLFW_GAMEPAD_BUTTON_B];
-    state.X             = glfwState.buttons[GLFW_GAMEPAD_BUTTON_X];
-    state.Y             = glfwState.buttons[GLFW_GAMEPAD_BUTTON_Y];
-    state.LeftBumper    = glfwState.buttons[GLFW_GAMEPAD_BUTTON_LEFT_BUMPER];
-    state.RightBumper   = glfwState.buttons[GLFW_GAMEPAD_BUTTON_RIGHT_BUMPER];
-    state.Select        = glfwState.buttons[GLFW_GAMEPAD_BUTTON_BACK];
-    state.Start         = glfwState.buttons[GLFW_GAMEPAD_BUTTON_START];
-    state.Home          = glfwState.buttons[GLFW_GAMEPAD_BUTTON_GUIDE];
-    state.LeftThumb     = glfwState.buttons[GLFW_GAMEPAD_BUTTON_LEFT_THUMB];
-    state.RightThumb    = glfwState.buttons[GLFW_GAMEPAD_BUTTON_RIGHT_THUMB];
-    state.DPadUp        = glfwState.buttons[GLFW_GAMEPAD_BUTTON_DPAD_UP];
-    state.DPadRight     = glfwState.buttons[GLFW_GAMEPAD_BUTTON_DPAD_RIGHT];
-    state.DPadDown      = glfwState.buttons[GLFW_GAMEPAD_BUTTON_DPAD_DOWN];
-    state.DPadLeft      = glfwState.buttons[GLFW_GAMEPAD_BUTTON_DPAD_LEFT];
-    state.DPad          = state.DPadUp    ? GamepadState::DPadDirection::Up
-                        : state.DPadRight ? GamepadState::DPadDirection::Right
-                        : state.DPadDown  ? GamepadState::DPadDirection::Down
-                        : state.DPadLeft  ? GamepadState::DPadDirection::Left
+    for (int i = 0; i <= GLFW_GAMEPAD_BUTTON_LAST; i++)
+    {
+        if (glfwState.buttons[i] == GLFW_PRESS)
+        {
+            state.Buttons |= GamepadState::ButtonBit(Window::GLFW3Adapter::getEnum<Button>(i));
+        }
+    }
+
+    state.DPad          = state[Button::DPadUp]    ? GamepadState::DPadDirection::Up
+                        : state[Button::DPadRight] ? GamepadState::DPadDirection::Right
+                        : state[Button::DPadDown]  ? GamepadState::DPadDirection::Down
+                        : state[Button::DPadLeft]  ? GamepadState::DPadDirection::Left
                         : GamepadState::DPadDirection::None;
-                        
-    state.LeftX         = glfwState.axes[GLFW_GAMEPAD_AXIS_LEFT_X];
-    state.LeftY         = glfwState.axes[GLFW_GAMEPAD_AXIS_LEFT_Y];
-    state.RightX        = glfwState.axes[GLFW_GAMEPAD_AXIS_RIGHT_X];
-    state.RightY        = glfwState.axes[GLFW_GAMEPAD_AXIS_RIGHT_Y];
-    state.LeftTrigger   = glfwState.axes[GLFW_GAMEPAD_AXIS_LEFT_TRIGGER];
-    state.RightTrigger  = glfwState.axes[GLFW_GAMEPAD_AXIS_RIGHT_TRIGGER];
+
+    for (int i = 0; i <= GLFW_GAMEPAD_AXIS_LAST; i++)
+    {
+        state[Window::GLFW3Adapter::getEnum<Axis>(i)] = glfwState.axes[i];
+    }
 
     return state;
 }
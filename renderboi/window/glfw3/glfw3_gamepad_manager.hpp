@@ -2,6 +2,7 @@
 #define RENDERBOI__WINDOW__GLFW3__GLFW3_GAMEPAD_MANAGER_HPP
 
 #include <atomic>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -30,6 +31,10 @@ private:
     /// slot which they are assigned to.
     mutable std::map<Joystick, GamepadPtr> _managedGamepads;
 
+    /// @brief Mutex keeping gamepads from being added to the managed
+    /// gamepads while they are polled on another thread.
+    mutable std::mutex _managedGamepadsMutex;
+
     /// @brief Structure mapping managed gamepad to whether or not polling for
     /// them is enabled.
     mutable std::map<Joystick, std::atomic<bool>> _enabledGamepads;
@@ -112,6 +117,12 @@ public:
 
     /// @brief Poll the state for gamepads. And forward it to gamepads.
     void pollGamepadStates() const override;
+
+    /// @brief Tell whether gamepads may be sampled from a thread dedicated to
+    /// it. GLFW only allows querying gamepads from the main thread.
+    ///
+    /// @return False.
+    bool supportsSamplingThread() const override;
 };
 
 }//namespace Renderboi::Window
@@ -196,6 +196,7 @@ void GLFW3Window::setShouldClose(bool value)
 {
     _exitSignaled = value;
     glfwSetWindowShouldClose(_w, value);
+    glfwPostEmptyEvent();
 }
 
 void GLFW3Window::swapBuffers()
@@ -203,11 +204,37 @@ void GLFW3Window::swapBuffers()
     glfwSwapBuffers(_w);
 }
 
+void GLFW3Window::setSwapInterval(const int interval)
+{
+    glfwSwapInterval(interval);
+}
+
 void GLFW3Window::pollEvents() const
 {
     glfwPollEvents();
 }
 
+void GLFW3Window::waitEvents(const double timeout) const
+{
+    if (timeout < 0.0)
+    {
+        glfwWaitEvents();
+    }
+    else if (timeout > 0.0)
+    {
+        glfwWaitEventsTimeout(timeout);
+    }
+    else
+    {
+        glfwPollEvents();
+    }
+}
+
+void GLFW3Window::postEmptyEvent() const
+{
+    glfwPostEmptyEvent();
+}
+
 float GLFW3Window::getAspectRatio() const
 {
     int width, height;
@@ -176,8 +176,24 @@ public:
     /// @brief Swap the front and back buffers of the window.
     void swapBuffers() override;
 
+    /// @brief Set how many screen refreshes to wait for before swapping the
+    /// front and back buffers of the window.
+    ///
+    /// @param interval How many screen refreshes to wait for.
+    void setSwapInterval(const int interval) override;
+
     /// @brief Poll events recorded by the window.
     void pollEvents() const override;
+
+    /// @brief Wait for events to be recorded by the window, or for a timeout
+    /// to elapse, then process them.
+    ///
+    /// @param timeout Maximum time (in seconds) to wait for. If negative,
+    /// wait for as long as no event is queued.
+    void waitEvents(const double timeout) const override;
+
+    /// @brief Post an empty event, waking up the thread waiting for events.
+    void postEmptyEvent() const override;
     
     /// @brief Get the aspect ratio of the framebuffer used by the window.
     ///
@@ -8,7 +8,8 @@ namespace Renderboi::Window
 enum class WindowBackend
 {
     Unknown,
-    GLFW3
+    GLFW3,
+    EGL
 };
 
 }//namespace Renderboi::Window
@@ -0,0 +1,106 @@
+#include <catch2/catch2.hpp>
+
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <renderboi/window/enums.hpp>
+#include <renderboi/toolbox/controls/control.hpp>
+#include <renderboi/toolbox/controls/control_binding_table.hpp>
+
+namespace rb = Renderboi;
+
+using Key = rb::Window::Input::Key;
+using MouseButton = rb::Window::Input::MouseButton;
+using Table = rb::ControlBindingTable<int>;
+
+namespace
+{
+
+std::vector<int> actionsOf(const Table& table, const rb::Control& control)
+{
+    const std::span<const int> actions = table.getActions(control);
+    return std::vector<int>(actions.begin(), actions.end());
+}
+
+}//namespace
+
+TEST_CASE("ControlBindingTable: empty table", "[toolbox][control_binding_table]")
+{
+    const Table table;
+
+    CHECK(table.size() == 0);
+    CHECK(table.getActions(Key::Space).empty());
+    CHECK(table.getActions(MouseButton::Left).empty());
+}
+
+TEST_CASE("ControlBindingTable: actions are found under their control", "[toolbox][control_binding_table]")
+{
+    // Bindings are given out of slot order, with several actions per control
+    const Table table({
+        {Key::W,            1},
+        {MouseButton::B8,   2},
+        {Key::Unknown,      3},
+        {Key::W,            4},
+        {Key::Menu,         5},
+        {MouseButton::Left, 6},
+        {Key::Space,        7},
+        {MouseButton::B8,   8},
+        {Key::W,            9}
+    });
+
+    CHECK(table.size() == 9);
+
+    // Actions of a control come out in the order they were provided
+    CHECK(actionsOf(table, Key::W) == std::vector<int>{1, 4, 9});
+    CHECK(actionsOf(table, MouseButton::B8) == std::vector<int>{2, 8});
+
+    // First and last slots of both the key and the mouse button ranges
+    CHECK(actionsOf(table, Key::Unknown) == std::vector<int>{3});
+    CHECK(actionsOf(table, Key::Menu) == std::vector<int>{5});
+    CHECK(actionsOf(table, MouseButton::Left) == std::vector<int>{6});
+    CHECK(actionsOf(table, Key::Space) == std::vector<int>{7});
+
+    // Neighbouring slots are left empty
+    CHECK(table.getActions(Key::Apostrophe).empty());
+    CHECK(table.getActions(Key::V).empty());
+    CHECK(table.getActions(Key::X).empty());
+    CHECK(table.getActions(Key::RightSuper).empty());
+    CHECK(table.getActions(MouseButton::Right).empty());
+    CHECK(table.getActions(MouseButton::B7).empty());
+}
+
+TEST_CASE("ControlBindingTable: key and mouse button slots do not overlap", "[toolbox][control_binding_table]")
+{
+    // Key and mouse button codes overlap, their slots must not
+    const Table table({
+        {Key::Unknown,      1},
+        {MouseButton::B1,   2},
+        {Key::Space,        3},
+        {MouseButton::B2,   4}
+    });
+
+    REQUIRE((unsigned int)Key::Unknown == (unsigned int)MouseButton::B1);
+    REQUIRE((unsigned int)Key::Space == (unsigned int)MouseButton::B2);
+
+    CHECK(actionsOf(table, Key::Unknown) == std::vector<int>{1});
+    CHECK(actionsOf(table, MouseButton::B1) == std::vector<int>{2});
+    CHECK(actionsOf(table, Key::Space) == std::vector<int>{3});
+    CHECK(actionsOf(table, MouseButton::B2) == std::vector<int>{4});
+}
+
+TEST_CASE("ControlBindingTable: controls which are not tabulated are ignored", "[toolbox][control_binding_table]")
+{
+    rb::Control gamepadButton(Key::Unknown);
+    gamepadButton.kind = rb::ControlKind::GamepadButton;
+    gamepadButton.gamepadButton = rb::Window::Input::Gamepad::Button::A;
+
+    const Table table({
+        {gamepadButton, 1},
+        {Key::A,        2}
+    });
+
+    CHECK(table.size() == 1);
+    CHECK(table.getActions(gamepadButton).empty());
+    CHECK(actionsOf(table, Key::A) == std::vector<int>{2});
+}
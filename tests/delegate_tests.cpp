@@ -0,0 +1,206 @@
+#include <catch2/catch2.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#include <renderboi/utilities/delegate.hpp>
+
+namespace rb = Renderboi;
+
+namespace
+{
+
+/// @brief Tallies of the instances of the counted callables.
+struct Counts
+{
+    int live = 0;
+    int copies = 0;
+    int moves = 0;
+};
+
+/// @brief Callable counting its instances, returning its own address plus
+/// the argument it was invoked with. Padded to the requested size.
+template<std::size_t Size>
+struct Counted
+{
+    Counts* counts;
+    unsigned char padding[Size - sizeof(Counts*)];
+
+    Counted(Counts& c) :
+        counts(&c),
+        padding()
+    {
+        counts->live++;
+    }
+
+    Counted(const Counted& other) :
+        counts(other.counts),
+        padding()
+    {
+        counts->live++;
+        counts->copies++;
+    }
+
+    Counted(Counted&& other) noexcept :
+        counts(other.counts),
+        padding()
+    {
+        counts->live++;
+        counts->moves++;
+    }
+
+    ~Counted()
+    {
+        counts->live--;
+    }
+
+    uintptr_t operator()(const uintptr_t arg) const
+    {
+        return (uintptr_t)this + arg;
+    }
+};
+
+using Small = Counted<rb::Delegate<uintptr_t(uintptr_t)>::BufferSize>;
+using Large = Counted<2 * rb::Delegate<uintptr_t(uintptr_t)>::BufferSize>;
+using Delegate = rb::Delegate<uintptr_t(uintptr_t)>;
+
+/// @brief Tell whether the callable held by a delegate is stored inside of
+/// the delegate itself.
+bool storedInline(const Delegate& delegate)
+{
+    const uintptr_t address = delegate(0);
+    const uintptr_t begin = (uintptr_t)&delegate;
+    return address >= begin && address < begin + sizeof(Delegate);
+}
+
+}//namespace
+
+TEST_CASE("Delegate: empty delegate", "[utilities][delegate]")
+{
+    const Delegate delegate;
+
+    CHECK_FALSE(delegate);
+    CHECK_THROWS_AS(delegate(0), std::runtime_error);
+
+    Delegate empty;
+    Delegate moved(std::move(empty));
+    CHECK_FALSE(moved);
+}
+
+TEST_CASE("Delegate: invocation", "[utilities][delegate]")
+{
+    int calls = 0;
+    rb::Delegate<int(int, int)> add([&calls](int a, int b) { calls++; return a + b; });
+
+    REQUIRE(add);
+    CHECK(add(2, 3) == 5);
+    CHECK(add(-1, 1) == 0);
+    CHECK(calls == 2);
+}
+
+TEST_CASE("Delegate: small callables are stored inline", "[utilities][delegate]")
+{
+    Counts counts;
+    {
+        Delegate delegate{Small(counts)};
+        CHECK(storedInline(delegate));
+        CHECK(counts.live == 1);
+
+        SECTION("Copy")
+        {
+            Delegate copy(delegate);
+            CHECK(counts.copies == 1);
+            CHECK(counts.live == 2);
+            CHECK(storedInline(copy));
+            CHECK(storedInline(delegate));
+
+            Delegate assigned;
+            assigned = copy;
+            CHECK(counts.live == 3);
+            CHECK(storedInline(assigned));
+        }
+
+        SECTION("Move")
+        {
+            const int moves = counts.moves;
+            Delegate moved(std::move(delegate));
+            CHECK_FALSE(delegate);
+            CHECK(counts.moves == moves + 1);
+            CHECK(counts.live == 1);
+            CHECK(storedInline(moved));
+
+            Delegate assigned;
+            assigned = std::move(moved);
+            CHECK_FALSE(moved);
+            CHECK(counts.live == 1);
+            CHECK(storedInline(assigned));
+        }
+    }
+    CHECK(counts.live == 0);
+}
+
+TEST_CASE("Delegate: large callables are stored on the heap", "[utilities][delegate]")
+{
+    Counts counts;
+    {
+        Delegate delegate{Large(counts)};
+        CHECK_FALSE(storedInline(delegate));
+        CHECK(counts.live == 1);
+
+        SECTION("Copy")
+        {
+            Delegate copy(delegate);
+            CHECK(counts.copies == 1);
+            CHECK(counts.live == 2);
+            CHECK_FALSE(storedInline(copy));
+
+            // Both delegates own their own callable
+            CHECK(copy(0) != delegate(0));
+        }
+
+        SECTION("Move")
+        {
+            // Moving hands over the callable without moving it
+            const uintptr_t address = delegate(0);
+            const int moves = counts.moves;
+            Delegate moved(std::move(delegate));
+            CHECK_FALSE(delegate);
+            CHECK(counts.moves == moves);
+            CHECK(counts.live == 1);
+            CHECK(moved(0) == address);
+
+            Delegate assigned{Large(counts)};
+            CHECK(counts.live == 2);
+            assigned = std::move(moved);
+            CHECK(counts.live == 1);
+            CHECK(assigned(0) == address);
+        }
+    }
+    CHECK(counts.live == 0);
+}
+
+TEST_CASE("Delegate: assignment replaces the stored callable", "[utilities][delegate]")
+{
+    Counts smallCounts;
+    Counts largeCounts;
+    {
+        Delegate delegate{Small(smallCounts)};
+        delegate = Delegate{Large(largeCounts)};
+        CHECK(smallCounts.live == 0);
+        CHECK(largeCounts.live == 1);
+        CHECK_FALSE(storedInline(delegate));
+
+        delegate = Delegate{Small(smallCounts)};
+        CHECK(smallCounts.live == 1);
+        CHECK(largeCounts.live == 0);
+        CHECK(storedInline(delegate));
+
+        // Self-assignment leaves the callable in place
+        Delegate& self = delegate;
+        delegate = self;
+        CHECK(smallCounts.live == 1);
+        CHECK(storedInline(delegate));
+    }
+    CHECK(smallCounts.live == 0);
+}
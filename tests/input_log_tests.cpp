@@ -0,0 +1,223 @@
+#include <catch2/catch2.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#include <renderboi/toolbox/input_log.hpp>
+
+namespace rb = Renderboi;
+namespace rbw = Renderboi::Window;
+namespace fs = std::filesystem;
+
+using Type = rb::InputEvent::Type;
+using Record = rb::InputLog::Record;
+
+namespace
+{
+
+/// @brief Make a record of the given type, captured the given amount of
+/// milliseconds after the origin of the clock.
+Record makeRecord(const uint32_t step, const Type type, const int milliseconds)
+{
+    Record record = {};
+    record.step = step;
+    record.event.type = type;
+    record.event.timestamp = rb::InputEvent::Clock::time_point(std::chrono::milliseconds(milliseconds));
+    return record;
+}
+
+/// @brief Path to a file in the temporary directory, removed on destruction.
+struct TemporaryFile
+{
+    fs::path path;
+
+    TemporaryFile(const char* name) :
+        path(fs::temp_directory_path() / name)
+    {
+
+    }
+
+    ~TemporaryFile()
+    {
+        std::error_code ec;
+        fs::remove(path, ec);
+    }
+};
+
+/// @brief A log holding one event of every type.
+rb::InputLog makeLogOfEveryType()
+{
+    using namespace rbw::Input;
+
+    rb::InputLog log;
+
+    Record resize = makeRecord(0, Type::FramebufferResize, 1000);
+    resize.event.framebufferResize = {1920, 1080};
+    log.append(resize);
+
+    Record keyboard = makeRecord(0, Type::Keyboard, 1001);
+    keyboard.event.keyboard = {Key::W, 17, Action::Press, (int)Modifier::Shift | (int)Modifier::Control};
+    log.append(keyboard);
+
+    Record mouseButton = makeRecord(1, Type::MouseButton, 1002);
+    mouseButton.event.mouseButton = {MouseButton::Right, Action::Release, (int)Modifier::Alt};
+    log.append(mouseButton);
+
+    Record mouseCursor = makeRecord(1, Type::MouseCursor, 1003);
+    mouseCursor.event.mouseCursor = {640.25, -12.5};
+    log.append(mouseCursor);
+
+    log.append(makeRecord(2, Type::GamepadConnected, 1004));
+
+    Record gamepadButton = makeRecord(2, Type::GamepadButton, 1005);
+    gamepadButton.event.gamepadButton = {Gamepad::Button::Y, Action::Press};
+    log.append(gamepadButton);
+
+    Record gamepadAxis = makeRecord(3, Type::GamepadAxis, 1006);
+    gamepadAxis.event.gamepadAxis = {Gamepad::Axis::RightTrigger, 0.75f};
+    log.append(gamepadAxis);
+
+    // Only axes 0, 2 and 5 changed
+    Record stateChange = makeRecord(3, Type::GamepadStateChange, 1007);
+    stateChange.event.gamepadStateChange.pressedButtons = 0x0005;
+    stateChange.event.gamepadStateChange.releasedButtons = 0x0100;
+    stateChange.event.gamepadStateChange.changedAxes = 0b100101;
+    stateChange.event.gamepadStateChange.axes[0] = -0.5f;
+    stateChange.event.gamepadStateChange.axes[2] = 1.f;
+    stateChange.event.gamepadStateChange.axes[5] = 0.125f;
+    log.append(stateChange);
+
+    log.append(makeRecord(4, Type::GamepadDisconnected, 1008));
+
+    return log;
+}
+
+}//namespace
+
+TEST_CASE("InputLog: save and load round-trip every event type", "[toolbox][input_log]")
+{
+    const rb::InputLog log = makeLogOfEveryType();
+    TemporaryFile file("renderboi_input_log_round_trip.rbinput");
+    log.save(file.path);
+
+    const rb::InputLog loaded = rb::InputLog::Load(file.path);
+    const std::vector<Record>& expected = log.getRecords();
+    const std::vector<Record>& actual = loaded.getRecords();
+
+    REQUIRE(actual.size() == expected.size());
+    REQUIRE(loaded.getLastStep() == log.getLastStep());
+
+    for (std::size_t i = 0; i < actual.size(); i++)
+    {
+        const rb::InputEvent& e = expected[i].event;
+        const rb::InputEvent& a = actual[i].event;
+
+        CHECK(actual[i].step == expected[i].step);
+        REQUIRE(a.type == e.type);
+
+        // Timestamps are saved relative to that of the first event
+        CHECK(a.timestamp.time_since_epoch() == e.timestamp - expected.front().event.timestamp);
+
+        switch (e.type)
+        {
+            case Type::FramebufferResize:
+                CHECK(a.framebufferResize.width == e.framebufferResize.width);
+                CHECK(a.framebufferResize.height == e.framebufferResize.height);
+                break;
+            case Type::Keyboard:
+                CHECK(a.keyboard.key == e.keyboard.key);
+                CHECK(a.keyboard.scancode == e.keyboard.scancode);
+                CHECK(a.keyboard.action == e.keyboard.action);
+                CHECK(a.keyboard.mods == e.keyboard.mods);
+                break;
+            case Type::MouseButton:
+                CHECK(a.mouseButton.button == e.mouseButton.button);
+                CHECK(a.mouseButton.action == e.mouseButton.action);
+                CHECK(a.mouseButton.mods == e.mouseButton.mods);
+                break;
+            case Type::MouseCursor:
+                CHECK(a.mouseCursor.xpos == e.mouseCursor.xpos);
+                CHECK(a.mouseCursor.ypos == e.mouseCursor.ypos);
+                break;
+            case Type::GamepadConnected:
+            case Type::GamepadDisconnected:
+                break;
+            case Type::GamepadButton:
+                CHECK(a.gamepadButton.button == e.gamepadButton.button);
+                CHECK(a.gamepadButton.action == e.gamepadButton.action);
+                break;
+            case Type::GamepadAxis:
+                CHECK(a.gamepadAxis.axis == e.gamepadAxis.axis);
+                CHECK(a.gamepadAxis.value == e.gamepadAxis.value);
+                break;
+            case Type::GamepadStateChange:
+                CHECK(a.gamepadStateChange.pressedButtons == e.gamepadStateChange.pressedButtons);
+                CHECK(a.gamepadStateChange.releasedButtons == e.gamepadStateChange.releasedButtons);
+                CHECK(a.gamepadStateChange.changedAxes == e.gamepadStateChange.changedAxes);
+                for (unsigned int j = 0; j < rb::GamepadState::AxisCount; j++)
+                {
+                    // Axes which did not change are loaded at 0
+                    const bool changed = e.gamepadStateChange.changedAxes & (1u << j);
+                    CHECK(a.gamepadStateChange.axes[j] == (changed ? e.gamepadStateChange.axes[j] : 0.f));
+                }
+                break;
+        }
+    }
+}
+
+TEST_CASE("InputLog: empty log round-trip", "[toolbox][input_log]")
+{
+    TemporaryFile file("renderboi_input_log_empty.rbinput");
+    rb::InputLog().save(file.path);
+
+    const rb::InputLog loaded = rb::InputLog::Load(file.path);
+    CHECK(loaded.getRecords().empty());
+    CHECK(loaded.getLastStep() == 0);
+}
+
+TEST_CASE("InputLog: events cannot be appended out of step order", "[toolbox][input_log]")
+{
+    rb::InputLog log;
+    log.append(makeRecord(3, Type::GamepadConnected, 0));
+
+    CHECK_THROWS_AS(log.append(makeRecord(2, Type::GamepadConnected, 0)), std::runtime_error);
+    CHECK_NOTHROW(log.append(makeRecord(3, Type::GamepadDisconnected, 0)));
+}
+
+TEST_CASE("InputLog: truncated files fail to load", "[toolbox][input_log]")
+{
+    const rb::InputLog log = makeLogOfEveryType();
+    TemporaryFile file("renderboi_input_log_truncated.rbinput");
+    log.save(file.path);
+    const std::uintmax_t fullSize = fs::file_size(file.path);
+
+    // Every prefix of the file is missing something, be it part of the
+    // header, of an event, or the sparse axis values of the state change
+    for (std::uintmax_t size = 0; size < fullSize; size++)
+    {
+        log.save(file.path);
+        fs::resize_file(file.path, size);
+
+        INFO("Truncated to " << size << " bytes out of " << fullSize);
+        CHECK_THROWS_AS(rb::InputLog::Load(file.path), std::runtime_error);
+    }
+}
+
+TEST_CASE("InputLog: files which are not input logs fail to load", "[toolbox][input_log]")
+{
+    TemporaryFile file("renderboi_input_log_not_a_log.rbinput");
+    rb::InputLog().save(file.path);
+
+    // Corrupt the magic bytes
+    {
+        std::fstream stream(file.path, std::ios::binary | std::ios::in | std::ios::out);
+        stream.put('X');
+    }
+
+    CHECK_THROWS_AS(rb::InputLog::Load(file.path), std::runtime_error);
+    CHECK_THROWS_AS(rb::InputLog::Load(fs::temp_directory_path() / "renderboi_input_log_missing.rbinput"), std::runtime_error);
+}
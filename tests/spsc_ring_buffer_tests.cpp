@@ -0,0 +1,120 @@
+#include <catch2/catch2.hpp>
+
+#include <cstddef>
+#include <thread>
+
+#include <renderboi/utilities/spsc_ring_buffer.hpp>
+
+namespace rb = Renderboi;
+
+TEST_CASE("SpscRingBuffer: empty queue", "[utilities][spsc_ring_buffer]")
+{
+    rb::SpscRingBuffer<int, 4> queue;
+    int element = -1;
+
+    CHECK(queue.size() == 0);
+    CHECK(queue.front() == nullptr);
+    CHECK_FALSE(queue.pop(element));
+    CHECK(element == -1);
+}
+
+TEST_CASE("SpscRingBuffer: full queue", "[utilities][spsc_ring_buffer]")
+{
+    rb::SpscRingBuffer<int, 4> queue;
+    REQUIRE(queue.capacity() == 4);
+
+    for (int i = 0; i < 4; i++)
+    {
+        CHECK(queue.push(i));
+    }
+    CHECK(queue.size() == 4);
+
+    // Elements pushed past capacity are rejected, and leave the queue intact
+    CHECK_FALSE(queue.push(4));
+    CHECK(queue.size() == 4);
+
+    int element;
+    for (int i = 0; i < 4; i++)
+    {
+        REQUIRE(queue.front() != nullptr);
+        CHECK(*queue.front() == i);
+        REQUIRE(queue.pop(element));
+        CHECK(element == i);
+    }
+    CHECK_FALSE(queue.pop(element));
+
+    // Room was made
+    CHECK(queue.push(5));
+}
+
+TEST_CASE("SpscRingBuffer: wraparound", "[utilities][spsc_ring_buffer]")
+{
+    rb::SpscRingBuffer<int, 4> queue;
+    int element;
+    int next = 0;
+    int expected = 0;
+
+    // Keep the queue between 1 and 3 elements full over many laps
+    for (int lap = 0; lap < 10; lap++)
+    {
+        while (queue.size() < 3)
+        {
+            REQUIRE(queue.push(next++));
+        }
+        while (queue.size() > 1)
+        {
+            REQUIRE(queue.pop(element));
+            CHECK(element == expected++);
+        }
+    }
+
+    // Fill it up entirely across the wrap point
+    while (queue.push(next))
+    {
+        next++;
+    }
+    CHECK(queue.size() == 4);
+
+    while (queue.pop(element))
+    {
+        CHECK(element == expected++);
+    }
+    CHECK(expected == next);
+}
+
+TEST_CASE("SpscRingBuffer: one producer and one consumer", "[utilities][spsc_ring_buffer]")
+{
+    constexpr std::size_t Count = 100000;
+    rb::SpscRingBuffer<std::size_t, 64> queue;
+
+    std::thread producer([&queue]()
+    {
+        for (std::size_t i = 0; i < Count; i++)
+        {
+            while (!queue.push(i))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    // Elements come out in order, none missing
+    bool ordered = true;
+    std::size_t expected = 0;
+    std::size_t element;
+    while (expected < Count)
+    {
+        if (!queue.pop(element))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        ordered = ordered && (element == expected);
+        expected++;
+    }
+    producer.join();
+
+    CHECK(ordered);
+    CHECK(queue.size() == 0);
+}